@@ -32,6 +32,10 @@
 
 CONFIG += c++11
 
+# Configurations are evaluated in parallel (std::thread)
+QMAKE_CXXFLAGS += -pthread
+LIBS += -pthread
+
 mac {
     CONFIG -= app_bundle
     INCLUDEPATH += /opt/boost/include
@@ -52,11 +56,39 @@ HEADERS += core/Bank.h
 HEADERS += core/Channel.h
 HEADERS += core/Timing.h
 HEADERS += core/Current.h
+HEADERS += core/SpeedBinTable.h
+HEADERS += core/VoltageSweep.h
+HEADERS += core/TemperatureSweep.h
+HEADERS += core/ProcessCornerTable.h
+
+HEADERS += trace/CommandTrace.h
+HEADERS += trace/TraceEnergy.h
+HEADERS += trace/TimingChecker.h
+
+HEADERS += workload/WorkloadPower.h
+
+HEADERS += thermal/TemperatureProfile.h
+HEADERS += thermal/SelfHeating.h
 
 HEADERS += utils/utils.h
+HEADERS += utils/BoundedQueue.h
+HEADERS += utils/MappedFile.h
+HEADERS += utils/NumberFormat.h
+HEADERS += utils/MetricsServer.h
 HEADERS += parser/ArgumentsParser.h
 HEADERS += parser/TechnologyValues.h
 HEADERS += parser/DramSpec.h
+HEADERS += parser/ResultFields.h
+HEADERS += parser/ResultCache.h
+HEADERS += parser/JSONDocumentCache.h
+HEADERS += parser/ParameterSweep.h
+HEADERS += parser/InputParameters.h
+HEADERS += parser/StreamProcessor.h
+HEADERS += parser/ColumnarResultReader.h
+HEADERS += parser/ColumnarResultWriter.h
+HEADERS += parser/ShardManifest.h
+HEADERS += parser/RunCheckpoint.h
+HEADERS += parser/RunProgress.h
 
 # Expanded BOOST/UNITS
 HEADERS += expandedBoostUnits/BaseDimensions/clock.h
@@ -93,12 +125,41 @@ SOURCES += core/Bank.cpp
 SOURCES += core/Channel.cpp
 SOURCES += core/Timing.cpp
 SOURCES += core/Current.cpp
+SOURCES += core/SpeedBinTable.cpp
+SOURCES += core/VoltageSweep.cpp
+SOURCES += core/TemperatureSweep.cpp
+SOURCES += core/ProcessCornerTable.cpp
+
+#DRAMSpec trace source files
+SOURCES += trace/CommandTrace.cpp
+SOURCES += trace/TraceEnergy.cpp
+SOURCES += trace/TimingChecker.cpp
+
+#DRAMSpec workload source files
+SOURCES += workload/WorkloadPower.cpp
+
+#DRAMSpec thermal source files
+SOURCES += thermal/TemperatureProfile.cpp
+SOURCES += thermal/SelfHeating.cpp
 
 #DRAMSpec other source files
 SOURCES += utils/utils.cpp
+SOURCES += utils/MappedFile.cpp
+SOURCES += utils/NumberFormat.cpp
+SOURCES += utils/MetricsServer.cpp
 SOURCES += parser/ArgumentsParser.cpp
 SOURCES += parser/TechnologyValues.cpp
 SOURCES += parser/DramSpec.cpp
+SOURCES += parser/ResultCache.cpp
+SOURCES += parser/JSONDocumentCache.cpp
+SOURCES += parser/ParameterSweep.cpp
+SOURCES += parser/InputParameters.cpp
+SOURCES += parser/StreamProcessor.cpp
+SOURCES += parser/ColumnarResultReader.cpp
+SOURCES += parser/ColumnarResultWriter.cpp
+SOURCES += parser/ShardManifest.cpp
+SOURCES += parser/RunCheckpoint.cpp
+SOURCES += parser/RunProgress.cpp
 
 #Choose output directories
 # and source files to be compiled
@@ -112,6 +173,9 @@ CONFIG(release, debug|release) {
     UI_DIR = build/release/.ui
 
     QMAKE_CXXFLAGS += -Wextra -Wall
+    # Loops over arrays whose length is only known at run time (as the
+    #  workload profiles) are vectorized, which -O2 alone does not do
+    QMAKE_CXXFLAGS_RELEASE += -ftree-vectorize -fvect-cost-model=dynamic
 
     SOURCES += main.cpp
 
@@ -137,6 +201,25 @@ CONFIG(debug, debug|release) {
     SOURCES += unit_tests/unit_tests/ChannelTest.cpp
     SOURCES += unit_tests/unit_tests/TimingTest.cpp
     SOURCES += unit_tests/unit_tests/CurrentTest.cpp
+    SOURCES += unit_tests/unit_tests/ResultCacheTest.cpp
+    SOURCES += unit_tests/unit_tests/JSONDocumentCacheTest.cpp
+    SOURCES += unit_tests/unit_tests/ParameterSweepTest.cpp
+    SOURCES += unit_tests/unit_tests/StreamProcessorTest.cpp
+    SOURCES += unit_tests/unit_tests/MappedFileTest.cpp
+    SOURCES += unit_tests/unit_tests/ColumnarResultTest.cpp
+    SOURCES += unit_tests/unit_tests/NumberFormatTest.cpp
+    SOURCES += unit_tests/unit_tests/ShardManifestTest.cpp
+    SOURCES += unit_tests/unit_tests/RunCheckpointTest.cpp
+    SOURCES += unit_tests/unit_tests/RunProgressTest.cpp
+    SOURCES += unit_tests/unit_tests/TraceEnergyTest.cpp
+    SOURCES += unit_tests/unit_tests/TimingCheckerTest.cpp
+    SOURCES += unit_tests/unit_tests/WorkloadPowerTest.cpp
+    SOURCES += unit_tests/unit_tests/SpeedBinTableTest.cpp
+    SOURCES += unit_tests/unit_tests/VoltageSweepTest.cpp
+    SOURCES += unit_tests/unit_tests/TemperatureSweepTest.cpp
+    SOURCES += unit_tests/unit_tests/ProcessCornerTableTest.cpp
+    SOURCES += unit_tests/unit_tests/TemperatureProfileTest.cpp
+    SOURCES += unit_tests/unit_tests/SelfHeatingTest.cpp
     #SOURCES += unit_tests/unit_tests/DramSpecTest.cpp
 
     SOURCES += unit_tests/unitTestRunner.cpp
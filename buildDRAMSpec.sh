@@ -10,6 +10,12 @@ qmake CONFIG+=release DRAMSpec.pro;
 echo "Compiling...";
 make -s -j4;
 
+echo "Compiling dramspec-convert...";
+(cd tools/dramspec-convert && qmake CONFIG+=release dramspec-convert.pro && make -s -j4);
+
+echo "Compiling dramspec-merge...";
+(cd tools/dramspec-merge && qmake CONFIG+=release dramspec-merge.pro && make -s -j4);
+
 ENDTIME=$(date +%s)
 echo "Ready after $(($ENDTIME - $STARTTIME)) seconds!";
 
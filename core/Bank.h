@@ -67,6 +67,13 @@ class Bank : public Tile
         bankCompute();
     }
 
+    Bank(const TechnologyValues& technologyValues):
+        Tile(technologyValues)
+    {
+        bankInitialize();
+        bankCompute();
+    }
+
     // Size in number of bits of a single bank
     bu::quantity<drs::bit_unit> bankStorage;
 
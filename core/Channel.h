@@ -68,6 +68,13 @@ class Channel : public Bank
         channelCompute();
     }
 
+    Channel(const TechnologyValues& technologyValues) :
+        Bank(technologyValues)
+    {
+        channelInitialize();
+        channelCompute();
+    }
+
     // Size in number of bits of the channel
     bu::quantity<drs::gibibit_unit> channelStorage;
 
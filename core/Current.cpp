@@ -412,3 +412,61 @@ Current::currentCompute()
       throw exceptionMsgThrown;
   }
 }
+
+void
+Current::frequencyCompute(bu::quantity<drs::megahertz_clock_unit> frequency)
+{
+  try{
+    Timing::frequencyCompute(frequency);
+    // Every current depends on the clock, through IDD2N or the timings
+    //  rounded to clock cycles
+    currentCompute();
+  } catch(string exceptionMsgThrown) {
+      throw exceptionMsgThrown;
+  }
+}
+
+void
+Current::temperatureCompute(
+        bu::quantity<bu::celsius::temperature> newTemperature)
+{
+  try{
+    Timing::temperatureCompute(newTemperature);
+    currentCompute();
+  } catch(string exceptionMsgThrown) {
+      throw exceptionMsgThrown;
+  }
+}
+
+void
+Current::voltageCompute(bu::quantity<si::electric_potential> newVdd,
+                        bu::quantity<si::electric_potential> newVpp)
+{
+  try{
+    Timing::voltageCompute(newVdd, newVpp);
+    currentCompute();
+  } catch(string exceptionMsgThrown) {
+      throw exceptionMsgThrown;
+  }
+}
+
+void
+Current::cornerCompute(const ProcessCorner& corner)
+{
+  Issa = corner.currentFactor * Issa;
+  idd2nFreqSlope = corner.currentFactor * idd2nFreqSlope;
+  idd2nTempAlpha = corner.currentFactor * idd2nTempAlpha;
+  idd2nOffset = corner.currentFactor * idd2nOffset;
+  IddOcdRcvSlope = corner.currentFactor * IddOcdRcvSlope;
+  fullySharedResourcesCurrent = corner.currentFactor
+                                * fullySharedResourcesCurrent;
+  semiSharedResourcesCurrent = corner.currentFactor
+                               * semiSharedResourcesCurrent;
+  activeBankLeakage = corner.currentFactor * activeBankLeakage;
+  try{
+    Timing::cornerCompute(corner);
+    currentCompute();
+  } catch(string exceptionMsgThrown) {
+      throw exceptionMsgThrown;
+  }
+}
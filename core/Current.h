@@ -69,6 +69,20 @@ class Current : public Timing
           }
       }
 
+      // Computes the DRAM from already parsed technology values
+      Current(const TechnologyValues& technologyValues,
+              const bool IOTerminationCurrentFlag) :
+          Timing(technologyValues)
+      {
+          currentInitialize();
+          includeIOTerminationCurrent = IOTerminationCurrentFlag;
+          try {
+              currentCompute();
+          }catch (string exceptionMsgThrown){
+              throw exceptionMsgThrown;
+          }
+      }
+
     // !! Hard-coded values converted to variables !!
     double IDD2nPercentageIfNotDll;
     bu::quantity<drs::milliampere_unit> activeBankLeakage;
@@ -155,6 +169,23 @@ class Current : public Timing
 
     void currentCompute();
 
+    // Recomputes the timings and the currents for another frequency,
+    //  keeping the delays of the array and the charges
+    void frequencyCompute(bu::quantity<drs::megahertz_clock_unit> frequency);
+
+    // Recomputes the timings and the currents for another temperature
+    void temperatureCompute(
+            bu::quantity<bu::celsius::temperature> newTemperature);
+
+    // Recomputes the timings and the currents for other supply voltages,
+    //  keeping the geometry and the wires
+    void voltageCompute(bu::quantity<si::electric_potential> newVdd,
+                        bu::quantity<si::electric_potential> newVpp);
+
+    // Recomputes the timings and the currents with the resistances,
+    //  capacitances and currents of a process corner, keeping the geometry
+    void cornerCompute(const ProcessCorner& corner);
+
     //function for printing Currents
     void printCurrent();
 
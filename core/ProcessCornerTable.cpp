@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+#include "ProcessCornerTable.h"
+#include "../utils/NumberFormat.h"
+
+#include <fstream>
+
+namespace {
+
+// Pads a line of the report to the column starting at width
+void padTo(string& line, size_t width)
+{
+    line.append( line.size() < width ? width - line.size() : 1, ' ' );
+}
+
+}
+
+ProcessCornerTable::ProcessCornerTable(const Current& dram)
+{
+    if ( dram.processCorners.empty() ) {
+        string exceptionMsgThrown;
+        exceptionMsgThrown.append("[ERROR] ");
+        exceptionMsgThrown.append("Technology file ");
+        exceptionMsgThrown.append(dram.techFileName);
+        exceptionMsgThrown.append(" defines no process corners ");
+        exceptionMsgThrown.append("(member \"ProcessCorners\")!\n");
+        throw exceptionMsgThrown;
+    }
+
+    corners.resize(dram.processCorners.size());
+    for ( size_t cornerID = 0; cornerID < corners.size(); cornerID++ ) {
+        // Each copy keeps the geometry already computed for dram
+        Current cornerDram(dram);
+        try {
+            cornerDram.cornerCompute(dram.processCorners[cornerID]);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+
+        CornerResult& result = corners[cornerID];
+        result.corner = dram.processCorners[cornerID];
+        result.trcd = cornerDram.trcd.value();
+        result.tcas = cornerDram.tcas.value();
+        result.tras = cornerDram.tras.value();
+        result.trp = cornerDram.trp.value();
+        result.trc = cornerDram.trc.value();
+        result.trfc = cornerDram.trfc.value();
+        result.trcdClocks = cornerDram.trcd_clk.value();
+        result.tcasClocks = cornerDram.tcas_clk.value();
+        result.trasClocks = cornerDram.tras_clk.value();
+        result.trpClocks = cornerDram.trp_clk.value();
+        result.trcClocks = cornerDram.trc_clk.value();
+        result.trfcClocks = cornerDram.trfc_clk.value();
+        result.idd0 = cornerDram.IDD0.value();
+        result.ipp0 = cornerDram.IPP0.value();
+        result.idd1 = cornerDram.IDD1.value();
+        result.idd2n = cornerDram.IDD2n.value();
+        result.idd3n = cornerDram.IDD3n.value();
+        result.idd4r = cornerDram.IDD4R.value();
+        result.idd4w = cornerDram.IDD4W.value();
+        result.idd5b = cornerDram.IDD5b.value();
+        result.isTooFast = cornerDram.dramCoreFreq > cornerDram.maxCoreFreq;
+    }
+}
+
+void
+ProcessCornerTable::write(const string& cornersFileName) const
+{
+    string lines("corner,resistance[-],capacitance[-],current[-],"
+                 "trcd[ns],tcl[ns],tras[ns],trp[ns],trc[ns],trfc[ns],"
+                 "trcd[clk],tcl[clk],tras[clk],trp[clk],trc[clk],trfc[clk],"
+                 "idd0[mA],ipp0[mA],idd1[mA],idd2n[mA],idd3n[mA],"
+                 "idd4r[mA],idd4w[mA],idd5b[mA],too_fast\n");
+    for ( const CornerResult& result : corners ) {
+        lines.append(result.corner.name);
+        const double values[9] = {
+            result.corner.resistanceFactor, result.corner.capacitanceFactor,
+            result.corner.currentFactor, result.trcd, result.tcas,
+            result.tras, result.trp, result.trc, result.trfc
+        };
+        for ( double value : values ) {
+            lines.push_back(',');
+            appendNumber(lines, value);
+        }
+        const unsigned int clocks[6] = {
+            result.trcdClocks, result.tcasClocks, result.trasClocks,
+            result.trpClocks, result.trcClocks, result.trfcClocks
+        };
+        for ( unsigned int clock : clocks ) {
+            lines.push_back(',');
+            lines.append(to_string(clock));
+        }
+        const double currents[8] = {
+            result.idd0, result.ipp0, result.idd1, result.idd2n,
+            result.idd3n, result.idd4r, result.idd4w, result.idd5b
+        };
+        for ( double current : currents ) {
+            lines.push_back(',');
+            appendNumber(lines, current);
+        }
+        lines.append( result.isTooFast ? ",1\n" : ",0\n" );
+    }
+    ofstream cornersFile(cornersFileName, ofstream::trunc);
+    cornersFile << lines;
+}
+
+void
+ProcessCornerTable::appendReport(string& report) const
+{
+    report.append("Process corners (");
+    report.append(to_string(corners.size()));
+    report.append(" corners)\n");
+    report.append("  Corner  tRCD [ns]  tCL [ns]  tRC [ns]  "
+                  "tRCD-tCL-tRP  IDD0 [mA]  IDD4R [mA]  IDD5B [mA]\n");
+    for ( const CornerResult& result : corners ) {
+        string line("  ");
+        line.append(result.corner.name);
+        padTo(line, 10);
+        appendNumber(line, result.trcd);
+        padTo(line, 21);
+        appendNumber(line, result.tcas);
+        padTo(line, 31);
+        appendNumber(line, result.trc);
+        padTo(line, 41);
+        line.append(to_string(result.trcdClocks));
+        line.push_back('-');
+        line.append(to_string(result.tcasClocks));
+        line.push_back('-');
+        line.append(to_string(result.trpClocks));
+        padTo(line, 55);
+        appendNumber(line, result.idd0);
+        padTo(line, 66);
+        appendNumber(line, result.idd4r);
+        padTo(line, 78);
+        appendNumber(line, result.idd5b);
+        if ( result.isTooFast ) {
+            line.append("  (core too fast)");
+        }
+        report.append(line);
+        report.push_back('\n');
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+// Timings and currents of a configuration at every process corner of its
+//  technology file (e.g. SS, TT, FF). The geometry of the array does not
+//  depend on the corner, so it is computed once, and for every corner only
+//  its resistances, capacitances and currents are scaled and the RC timing
+//  stages, the clocks and the currents recomputed.
+#ifndef PROCESSCORNERTABLE_H
+#define PROCESSCORNERTABLE_H
+
+#include "Current.h"
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class ProcessCornerTable
+{
+  public:
+    // Corners of the technology values of dram
+    ProcessCornerTable(const Current& dram);
+
+    // Writes one line per corner to a CSV file
+    void write(const string& cornersFileName) const;
+    // Appends one line per corner to a result table
+    void appendReport(string& report) const;
+
+    struct CornerResult {
+        ProcessCorner corner;
+        // ns
+        double trcd;
+        double tcas;
+        double tras;
+        double trp;
+        double trc;
+        double trfc;
+        // Clock cycles at the frequency of the configuration
+        unsigned int trcdClocks;
+        unsigned int tcasClocks;
+        unsigned int trasClocks;
+        unsigned int trpClocks;
+        unsigned int trcClocks;
+        unsigned int trfcClocks;
+        // mA
+        double idd0;
+        double ipp0;
+        double idd1;
+        double idd2n;
+        double idd3n;
+        double idd4r;
+        double idd4w;
+        double idd5b;
+        // Set if the core is clocked faster than the array allows
+        bool isTooFast;
+    };
+    vector<CornerResult> corners;
+};
+
+#endif // PROCESSCORNERTABLE_H
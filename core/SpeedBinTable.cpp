@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+#include "SpeedBinTable.h"
+#include "../utils/NumberFormat.h"
+
+#include <fstream>
+
+namespace {
+
+// Pads a line of the report to the column starting at width
+void padTo(string& line, size_t width)
+{
+    line.append( line.size() < width ? width - line.size() : 1, ' ' );
+}
+
+}
+
+SpeedBinTable::SpeedBinTable(const Current& dram,
+                             const vector<double>& frequencies)
+{
+    // The copy keeps the delays and charges already computed for dram
+    Current speedBinDram(dram);
+    speedBins.resize(frequencies.size());
+    for ( size_t binID = 0; binID < frequencies.size(); binID++ ) {
+        try {
+            speedBinDram.frequencyCompute(
+                        frequencies[binID]*drs::megahertz_clock);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+
+        SpeedBin& speedBin = speedBins[binID];
+        speedBin.frequency = speedBinDram.dramFreq.value();
+        speedBin.coreFrequency = speedBinDram.dramCoreFreq.value();
+        speedBin.trcd = speedBinDram.trcd_clk.value();
+        speedBin.tcas = speedBinDram.tcas_clk.value();
+        speedBin.tras = speedBinDram.tras_clk.value();
+        speedBin.trp = speedBinDram.trp_clk.value();
+        speedBin.trc = speedBinDram.trc_clk.value();
+        speedBin.trl = speedBinDram.trl_clk.value();
+        speedBin.twl = speedBinDram.twl_clk.value();
+        speedBin.trtp = speedBinDram.trtp_clk.value();
+        speedBin.tccd = speedBinDram.tccd_clk.value();
+        speedBin.twr = speedBinDram.twr_clk.value();
+        speedBin.trfc = speedBinDram.trfc_clk.value();
+        speedBin.trefI = speedBinDram.trefI_clk.value();
+        speedBin.IDD0 = speedBinDram.IDD0.value();
+        speedBin.IPP0 = speedBinDram.IPP0.value();
+        speedBin.IDD1 = speedBinDram.IDD1.value();
+        speedBin.IPP1 = speedBinDram.IPP1.value();
+        speedBin.IDD2N = speedBinDram.IDD2n.value();
+        speedBin.IDD3N = speedBinDram.IDD3n.value();
+        speedBin.IPP3N = speedBinDram.IPP3n.value();
+        speedBin.IDD4R = speedBinDram.IDD4R.value();
+        speedBin.IDD4W = speedBinDram.IDD4W.value();
+        speedBin.IDD5B = speedBinDram.IDD5b.value();
+        speedBin.IPP5B = speedBinDram.IPP5b.value();
+        speedBin.isTooFast = speedBinDram.dramCoreFreq
+                             > speedBinDram.maxCoreFreq;
+    }
+}
+
+void
+SpeedBinTable::write(const string& tableFileName) const
+{
+    string lines("frequency[MHz],core_frequency[MHz],"
+                 "trcd[clk],tcl[clk],tras[clk],trp[clk],trc[clk],trl[clk],"
+                 "twl[clk],trtp[clk],tccd[clk],twr[clk],trfc[clk],"
+                 "trefi[clk],"
+                 "idd0[mA],ipp0[mA],idd1[mA],ipp1[mA],idd2n[mA],idd3n[mA],"
+                 "ipp3n[mA],idd4r[mA],idd4w[mA],idd5b[mA],ipp5b[mA],"
+                 "too_fast\n");
+    for ( const SpeedBin& speedBin : speedBins ) {
+        appendNumber(lines, speedBin.frequency);
+        lines.push_back(',');
+        appendNumber(lines, speedBin.coreFrequency);
+        const unsigned int clocks[12] = {
+            speedBin.trcd, speedBin.tcas, speedBin.tras, speedBin.trp,
+            speedBin.trc, speedBin.trl, speedBin.twl, speedBin.trtp,
+            speedBin.tccd, speedBin.twr, speedBin.trfc, speedBin.trefI
+        };
+        for ( unsigned int clock : clocks ) {
+            lines.push_back(',');
+            lines.append(to_string(clock));
+        }
+        const double currents[11] = {
+            speedBin.IDD0, speedBin.IPP0, speedBin.IDD1, speedBin.IPP1,
+            speedBin.IDD2N, speedBin.IDD3N, speedBin.IPP3N, speedBin.IDD4R,
+            speedBin.IDD4W, speedBin.IDD5B, speedBin.IPP5B
+        };
+        for ( double current : currents ) {
+            lines.push_back(',');
+            appendNumber(lines, current);
+        }
+        lines.append( speedBin.isTooFast ? ",1\n" : ",0\n" );
+    }
+    ofstream tableFile(tableFileName, ofstream::trunc);
+    tableFile << lines;
+}
+
+void
+SpeedBinTable::appendReport(string& report) const
+{
+    report.append("Speed bins (");
+    report.append(to_string(speedBins.size()));
+    report.append(" frequencies)\n");
+    report.append("  Frequency [MHz]  tRCD-tCL-tRP  tRAS  tRC  tRFC  "
+                  "IDD0 [mA]  IDD4R [mA]\n");
+    for ( const SpeedBin& speedBin : speedBins ) {
+        string line("  ");
+        appendNumber(line, speedBin.frequency);
+        padTo(line, 19);
+        line.append(to_string(speedBin.trcd));
+        line.push_back('-');
+        line.append(to_string(speedBin.tcas));
+        line.push_back('-');
+        line.append(to_string(speedBin.trp));
+        padTo(line, 33);
+        line.append(to_string(speedBin.tras));
+        padTo(line, 39);
+        line.append(to_string(speedBin.trc));
+        padTo(line, 44);
+        line.append(to_string(speedBin.trfc));
+        padTo(line, 50);
+        appendNumber(line, speedBin.IDD0);
+        padTo(line, 61);
+        appendNumber(line, speedBin.IDD4R);
+        if ( speedBin.isTooFast ) {
+            line.append("  (core too fast)");
+        }
+        report.append(line);
+        report.push_back('\n');
+    }
+}
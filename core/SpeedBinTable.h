@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+// Clock-cycle timings and currents of a configuration at every frequency of
+//  a speed-bin table (e.g. DDR4-1600 to DDR4-3200). The delays of the array
+//  in ns do not depend on the frequency, so they are computed once, and for
+//  every frequency only the clock, the timings in clock cycles, tRFC (whose
+//  refresh cycles are counted in clocks) and the currents are recomputed.
+#ifndef SPEEDBINTABLE_H
+#define SPEEDBINTABLE_H
+
+#include "Current.h"
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class SpeedBinTable
+{
+  public:
+    // frequencies in MHz
+    SpeedBinTable(const Current& dram, const vector<double>& frequencies);
+
+    // Writes one line per frequency to a CSV file
+    void write(const string& tableFileName) const;
+    // Appends one line per frequency to a result table
+    void appendReport(string& report) const;
+
+    struct SpeedBin {
+        // MHz
+        double frequency;
+        double coreFrequency;
+        // Clock cycles
+        unsigned int trcd;
+        unsigned int tcas;
+        unsigned int tras;
+        unsigned int trp;
+        unsigned int trc;
+        unsigned int trl;
+        unsigned int twl;
+        unsigned int trtp;
+        unsigned int tccd;
+        unsigned int twr;
+        unsigned int trfc;
+        unsigned int trefI;
+        // mA
+        double IDD0;
+        double IPP0;
+        double IDD1;
+        double IPP1;
+        double IDD2N;
+        double IDD3N;
+        double IPP3N;
+        double IDD4R;
+        double IDD4W;
+        double IDD5B;
+        double IPP5B;
+        // Set if the core is clocked faster than the array allows
+        bool isTooFast;
+    };
+    vector<SpeedBin> speedBins;
+};
+
+#endif // SPEEDBINTABLE_H
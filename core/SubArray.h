@@ -73,6 +73,18 @@ class SubArray : public TechnologyValues
         driverUpdate();
     }
 
+    SubArray(const TechnologyValues& technologyValues) :
+        TechnologyValues(technologyValues)
+    {
+        subArrayInitialize();
+        try {
+            subArrayCompute();
+        }catch (string exceptionMsgThrown){
+            throw exceptionMsgThrown;
+        }
+        driverUpdate();
+    }
+
     // Size in number of bits of a single subarray
     bu::quantity<drs::bit_unit> subArrayStorage;
 
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+#include "TemperatureSweep.h"
+#include "../utils/NumberFormat.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace {
+
+// Pads a line of the report to the column starting at width
+void padTo(string& line, size_t width)
+{
+    line.append( line.size() < width ? width - line.size() : 1, ' ' );
+}
+
+// Span in C between the two temperatures the delays are computed at
+const double slopeSpan = 100;
+
+}
+
+TemperatureSweep::TemperatureSweep(const Current& dram,
+                                   const vector<double>& sweepTemperatures)
+    : temperatures(sweepTemperatures)
+{
+    // Delays at the reference temperature of the resistances and their
+    //  slopes, from a copy that keeps the geometry and the wires
+    Timing rcDram(dram);
+    double referenceTemperature = dram.resistanceRefTemp.value();
+    rcDram.temperature = referenceTemperature*bu::celsius::degrees;
+    rcDram.resistiveDelayCompute();
+    const double referenceDelays[5] = {
+        rcDram.trcd.value(), rcDram.tcas.value(), rcDram.tras.value(),
+        rcDram.trp.value(), rcDram.trc.value()
+    };
+    rcDram.temperature = (referenceTemperature + slopeSpan)
+                         * bu::celsius::degrees;
+    rcDram.resistiveDelayCompute();
+    const double spanDelays[5] = {
+        rcDram.trcd.value(), rcDram.tcas.value(), rcDram.tras.value(),
+        rcDram.trp.value(), rcDram.trc.value()
+    };
+    vector<double>* delays[5] = { &trcd, &tcas, &tras, &trp, &trc };
+    vector<double>* clocks[5] = {
+        &trcdClocks, &tcasClocks, &trasClocks, &trpClocks, &trcClocks
+    };
+
+    size_t nTemperatures = temperatures.size();
+    const double* temperature = temperatures.data();
+    double clkPeriod = dram.clkPeriod.value();
+    for ( int delayID = 0; delayID < 5; delayID++ ) {
+        double referenceDelay = referenceDelays[delayID];
+        double slope = (spanDelays[delayID] - referenceDelay) / slopeSpan;
+        delays[delayID]->resize(nTemperatures);
+        clocks[delayID]->resize(nTemperatures);
+        double* delay = delays[delayID]->data();
+        double* clock = clocks[delayID]->data();
+        for ( size_t pointID = 0; pointID < nTemperatures; pointID++ ) {
+            delay[pointID] = referenceDelay
+                             + slope * (temperature[pointID]
+                                        - referenceTemperature);
+            clock[pointID] = ceil(delay[pointID] / clkPeriod);
+        }
+    }
+
+    // Slack of the timings of the configuration, in its clock cycles
+    double trcdTime = dram.trcd_clk.value() * clkPeriod;
+    double tcasTime = dram.tcas_clk.value() * clkPeriod;
+    double trasTime = dram.tras_clk.value() * clkPeriod;
+    double trpTime = dram.trp_clk.value() * clkPeriod;
+    margins.resize(nTemperatures);
+    for ( size_t pointID = 0; pointID < nTemperatures; pointID++ ) {
+        margins[pointID] = min( min(trcdTime - trcd[pointID],
+                                    tcasTime - tcas[pointID]),
+                                min(trasTime - tras[pointID],
+                                    trpTime - trp[pointID]) );
+    }
+}
+
+void
+TemperatureSweep::write(const string& sweepFileName) const
+{
+    string lines("temperature[C],trcd[ns],tcl[ns],tras[ns],trp[ns],trc[ns],"
+                 "trcd[clk],tcl[clk],tras[clk],trp[clk],trc[clk],"
+                 "margin[ns]\n");
+    for ( size_t pointID = 0; pointID < temperatures.size(); pointID++ ) {
+        appendNumber(lines, temperatures[pointID]);
+        const double delays[5] = {
+            trcd[pointID], tcas[pointID], tras[pointID], trp[pointID],
+            trc[pointID]
+        };
+        for ( double delay : delays ) {
+            lines.push_back(',');
+            appendNumber(lines, delay);
+        }
+        const double clocks[5] = {
+            trcdClocks[pointID], tcasClocks[pointID], trasClocks[pointID],
+            trpClocks[pointID], trcClocks[pointID]
+        };
+        for ( double clock : clocks ) {
+            lines.push_back(',');
+            lines.append(to_string(static_cast<unsigned int>(clock)));
+        }
+        lines.push_back(',');
+        appendNumber(lines, margins[pointID]);
+        lines.push_back('\n');
+    }
+    ofstream sweepFile(sweepFileName, ofstream::trunc);
+    sweepFile << lines;
+}
+
+void
+TemperatureSweep::appendReport(string& report) const
+{
+    report.append("Temperature sweep (");
+    report.append(to_string(temperatures.size()));
+    report.append(" temperatures)\n");
+    report.append("  Temperature [C]  tRCD [ns]  tCL [ns]  tRAS [ns]  "
+                  "tRP [ns]  Margin [ns]\n");
+    for ( size_t pointID = 0; pointID < temperatures.size(); pointID++ ) {
+        string line("  ");
+        appendNumber(line, temperatures[pointID]);
+        padTo(line, 19);
+        appendNumber(line, trcd[pointID]);
+        padTo(line, 30);
+        appendNumber(line, tcas[pointID]);
+        padTo(line, 40);
+        appendNumber(line, tras[pointID]);
+        padTo(line, 51);
+        appendNumber(line, trp[pointID]);
+        padTo(line, 61);
+        appendNumber(line, margins[pointID]);
+        if ( margins[pointID] < 0 ) {
+            line.append("  (timings too short)");
+        }
+        report.append(line);
+        report.push_back('\n');
+    }
+}
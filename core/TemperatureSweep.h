@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+// Latencies of the array of a configuration at every temperature of a
+//  sweep, e.g. to check the latency margins of a device in a hot aisle.
+//  The wire, cell and driver resistances grow linearly with the
+//  temperature and the capacitances do not depend on it, so every delay
+//  of the array is linear in the temperature. The delays are computed
+//  from the RC stages at two temperatures, and all points of the sweep
+//  are evaluated in one pass over arrays of temperatures, which the
+//  compiler vectorizes.
+#ifndef TEMPERATURESWEEP_H
+#define TEMPERATURESWEEP_H
+
+#include "Current.h"
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class TemperatureSweep
+{
+  public:
+    // temperatures in C
+    TemperatureSweep(const Current& dram, const vector<double>& temperatures);
+
+    // Writes one line per temperature to a CSV file
+    void write(const string& sweepFileName) const;
+    // Appends one line per temperature to a result table
+    void appendReport(string& report) const;
+
+    vector<double> temperatures;
+    // Delays in ns
+    vector<double> trcd;
+    vector<double> tcas;
+    vector<double> tras;
+    vector<double> trp;
+    vector<double> trc;
+    // Clock cycles at the frequency of the configuration
+    vector<double> trcdClocks;
+    vector<double> tcasClocks;
+    vector<double> trasClocks;
+    vector<double> trpClocks;
+    vector<double> trcClocks;
+    // Smallest slack in ns of tRCD, tCL, tRAS and tRP at the clock cycles
+    //  of the configuration, negative where they are too short
+    vector<double> margins;
+};
+
+#endif // TEMPERATURESWEEP_H
@@ -72,6 +72,17 @@ class Tile : public SubArray
         }
     }
 
+    Tile(const TechnologyValues& technologyValues):
+        SubArray(technologyValues)
+    {
+        tileInitialize();
+        try {
+            tileCompute();
+        }catch (string exceptionMsgThrown){
+            throw exceptionMsgThrown;
+        }
+    }
+
     // Size in number of bits of a single tile
     bu::quantity<drs::bit_unit> tileStorage;
 
@@ -43,10 +43,43 @@
 #include <iostream>
 #include <fstream>
 
+namespace {
+
+// Resistance of a transistor driven at voltage, relative to the one at
+//  referenceVoltage, from the alpha-power law (Sakurai and Newton): the
+//  saturation current grows with (V - Vth)^alpha, so R ~ V / (V - Vth)^alpha
+double alphaPowerFactor(double voltage, double referenceVoltage,
+                        double thresholdVoltage, double alpha,
+                        const char* voltageName)
+{
+    if ( voltage == referenceVoltage ) {
+        return 1.0;
+    }
+    if ( voltage <= thresholdVoltage || referenceVoltage <= thresholdVoltage ) {
+        std::string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append(voltageName);
+        exceptionMsgThrown.append(" must be higher than the threshold ");
+        exceptionMsgThrown.append("voltage of its drivers!\n");
+        throw exceptionMsgThrown;
+    }
+    return voltage / pow(voltage - thresholdVoltage, alpha)
+           * pow(referenceVoltage - thresholdVoltage, alpha)
+           / referenceVoltage;
+}
+
+}
+
 void
 Timing::timingInitialize()
 {
 
+    vddDriverFactor = 1.0;
+    vppDriverFactor = 1.0;
+
+    wireTemperatureFactor = 1.0;
+    cellTemperatureFactor = 1.0;
+    driverTemperatureFactor = 1.0;
+
     cellDelay = 0*drs::nanoseconds;
 
     localWordlineResistance = 0*drs::ohms;
@@ -119,6 +152,42 @@ Timing::timingInitialize()
 
 }
 
+void
+Timing::driverVoltageCalc()
+{
+    // The resistances of the technology file are the ones at the reference
+    //  voltages, by default Vdd and Vpp themselves. The periphery drivers
+    //  (CSL, GDL, DQ) are supplied by Vdd, while the wordline drivers and
+    //  the gates of the cell transistors are at Vpp.
+    double vddReference = ( referenceVdd > 0*si::volts
+                            ? referenceVdd.value() : vdd.value() );
+    double vppReference = ( referenceVpp > 0*si::volts
+                            ? referenceVpp.value() : vpp.value() );
+    try {
+        vddDriverFactor = alphaPowerFactor(vdd.value(), vddReference,
+                                           driverThresholdVoltage.value(),
+                                           alphaPowerExponent, "Vdd");
+        vppDriverFactor = alphaPowerFactor(vpp.value(), vppReference,
+                                           wordlineThresholdVoltage.value(),
+                                           alphaPowerExponent, "Vpp");
+    }catch (std::string exceptionMsgThrown){
+        throw exceptionMsgThrown;
+    }
+}
+
+void
+Timing::resistanceTemperatureCalc()
+{
+    // Resistances grow linearly with the temperature, from the values of
+    //  the technology file at the reference temperature
+    wireTemperatureFactor = 1.0 + wireResistanceTempCoefficient
+                                  * (temperature - resistanceRefTemp);
+    cellTemperatureFactor = 1.0 + cellResistanceTempCoefficient
+                                  * (temperature - resistanceRefTemp);
+    driverTemperatureFactor = 1.0 + driverResistanceTempCoefficient
+                                    * (temperature - resistanceRefTemp);
+}
+
 void
 Timing::trcdCalc()
 {
@@ -135,9 +204,11 @@ Timing::trcdCalc()
     // Calculating tau for cell celltau ( in ns )
     cellDelay = timeToPercentage(90)
               * SCALE_QUANTITY(capacitancePerCell, drs::nanofarad_unit)
-              * SCALE_QUANTITY(resistancePerCell, drs::ohm_unit);
+              * SCALE_QUANTITY(resistancePerCell, drs::ohm_unit)
+              * vppDriverFactor * cellTemperatureFactor;
 
-    localWordlineResistance = LWLDriverResistance
+    localWordlineResistance = vppDriverFactor * driverTemperatureFactor
+                              * LWLDriverResistance
                               + (cellsPerLWL *  resistancePerWLCell);
 
     // Calculating wordline total capacitance
@@ -166,7 +237,7 @@ Timing::trcdCalc()
     //  WLDV signal seems to be the "bottleneck"
     //calculating GWL decoder + wiring delay
     //calculating global wordline total capa
-    globalWordlineResistance = wireResistance
+    globalWordlineResistance = wireTemperatureFactor * wireResistance
            * SCALE_QUANTITY(tileWidth, drs::millimeter_unit);
 
     globalWordlineCapacitance =
@@ -177,7 +248,8 @@ Timing::trcdCalc()
 
     // Calculating delay through global wordline driver and wiring
     globalWordlineDelay = driverEnableDelay
-        + timeToPercentage(90) * GWLDriverResistance
+        + timeToPercentage(90) * vppDriverFactor * driverTemperatureFactor
+          * GWLDriverResistance
           * globalWordlineCapacitance
         + timeToPercentage(63) * globalWordlineResistance
           * globalWordlineCapacitance;
@@ -205,7 +277,7 @@ Timing::trasCalc()
 {
 
     CSLResistance = SCALE_QUANTITY(bankHeight, drs::millimeter_unit)
-                      * wireResistance;
+                      * wireTemperatureFactor * wireResistance;
 
     CSLCapacitance = SCALE_QUANTITY(bankHeight, drs::millimeter_unit)
                       * SCALE_QUANTITY(wireCapacitance, drs::nanofarad_per_millimeter_unit)
@@ -213,21 +285,23 @@ Timing::trasCalc()
 
     // delay through CSL
     tcsl = driverEnableDelay
-           + timeToPercentage(90) * CSLDriverResistance
+           + timeToPercentage(90) * vddDriverFactor * driverTemperatureFactor
+            * CSLDriverResistance
             * CSLCapacitance
            + timeToPercentage(63) * CSLResistance
             * CSLCapacitance;
 
 
     globalDatalineResistance = SCALE_QUANTITY(bankHeight, drs::millimeter_unit)
-                      * wireResistance;
+                      * wireTemperatureFactor * wireResistance;
 
     globalDatalineCapacitance = SCALE_QUANTITY(bankHeight, drs::millimeter_unit)
                       * SCALE_QUANTITY(wireCapacitance, drs::nanofarad_per_millimeter_unit);
 
     // delay through global dataline
     tgdl = driverEnableDelay
-           + timeToPercentage(90) * GDLDriverResistance
+           + timeToPercentage(90) * vddDriverFactor * driverTemperatureFactor
+             * GDLDriverResistance
              * globalDatalineCapacitance
            + timeToPercentage(63) * globalDatalineResistance
              * globalDatalineCapacitance;
@@ -249,14 +323,15 @@ Timing::trasCalc()
     }
 
     DQWireResistance = SCALE_QUANTITY(DQWireLength, drs::millimeter_unit)
-                        * wireResistance;
+                        * wireTemperatureFactor * wireResistance;
 
     DQWireCapacitance = DQWireLength
                       * SCALE_QUANTITY(wireCapacitance, drs::nanofarad_per_micrometer_unit);
 
     // delay through global dataline
     tdq = driverEnableDelay
-           + timeToPercentage(90) * DQDriverResistance
+           + timeToPercentage(90) * vddDriverFactor * driverTemperatureFactor
+             * DQDriverResistance
              * DQWireCapacitance
            + timeToPercentage(63) * DQWireResistance
              * DQWireCapacitance;
@@ -456,10 +531,54 @@ void
 Timing::timingCompute()
 {
     try {
-        trcdCalc();
-        trasCalc();
-        trpCalc();
-        trcCalc();
+        driverVoltageCalc();
+        resistiveDelayCompute();
+        tckCalc();
+        trefICalc();
+        trfcCalc();
+
+        clkTiming();
+    }catch (std::string exceptionMsgThrown){
+        throw exceptionMsgThrown;
+    }
+
+}
+
+void
+Timing::resistiveDelayCompute()
+{
+    resistanceTemperatureCalc();
+    trcdCalc();
+    trasCalc();
+    trpCalc();
+    trcCalc();
+}
+
+void
+Timing::frequencyCompute(bu::quantity<drs::megahertz_clock_unit> frequency)
+{
+    dramFreq = frequency;
+    // Calculated again from the frequency, as in timingInitialize()
+    dramCoreFreq = 0*drs::megahertz_clock;
+    try {
+        tckCalc();
+        // trfc is counted in clock cycles while refreshing
+        trfcCalc();
+
+        clkTiming();
+    }catch (std::string exceptionMsgThrown){
+        throw exceptionMsgThrown;
+    }
+}
+
+void
+Timing::temperatureCompute(
+        bu::quantity<bu::celsius::temperature> newTemperature)
+{
+    temperature = newTemperature;
+    try {
+        resistiveDelayCompute();
+        // The highest core frequency follows tccd
         tckCalc();
         trefICalc();
         trfcCalc();
@@ -468,7 +587,66 @@ Timing::timingCompute()
     }catch (std::string exceptionMsgThrown){
         throw exceptionMsgThrown;
     }
+}
+
+void
+Timing::voltageCompute(bu::quantity<si::electric_potential> newVdd,
+                       bu::quantity<si::electric_potential> newVpp)
+{
+    // The resistances stay the ones at the voltages of the configuration
+    if ( referenceVdd <= 0*si::volts ) {
+        referenceVdd = vdd;
+    }
+    if ( referenceVpp <= 0*si::volts ) {
+        referenceVpp = vpp;
+    }
+    vdd = newVdd;
+    vpp = newVpp;
+    try {
+        driverVoltageCalc();
+        resistiveDelayCompute();
+        // The highest core frequency follows tccd
+        tckCalc();
+        trfcCalc();
+
+        clkTiming();
+    }catch (std::string exceptionMsgThrown){
+        throw exceptionMsgThrown;
+    }
+}
+
+void
+Timing::cornerCompute(const ProcessCorner& corner)
+{
+    // The driver resistances are the ones sized for the geometry
+    wireResistance = corner.resistanceFactor * wireResistance;
+    resistancePerCell = corner.resistanceFactor * resistancePerCell;
+    resistancePerBLCell = corner.resistanceFactor * resistancePerBLCell;
+    resistancePerWLCell = corner.resistanceFactor * resistancePerWLCell;
+    LWLDriverResistance = corner.resistanceFactor * LWLDriverResistance;
+    GWLDriverResistance = corner.resistanceFactor * GWLDriverResistance;
+    WRDriverResistance = corner.resistanceFactor * WRDriverResistance;
+    CSLDriverResistance = corner.resistanceFactor * CSLDriverResistance;
+    GDLDriverResistance = corner.resistanceFactor * GDLDriverResistance;
+    DQDriverResistance = corner.resistanceFactor * DQDriverResistance;
+
+    wireCapacitance = corner.capacitanceFactor * wireCapacitance;
+    capacitancePerCell = corner.capacitanceFactor * capacitancePerCell;
+    capacitancePerBLCell = corner.capacitanceFactor * capacitancePerBLCell;
+    capacitancePerWLCell = corner.capacitanceFactor * capacitancePerWLCell;
+    CSLLoadCapacitance = corner.capacitanceFactor * CSLLoadCapacitance;
+
+    try {
+        driverVoltageCalc();
+        resistiveDelayCompute();
+        tckCalc();
+        trefICalc();
+        trfcCalc();
 
+        clkTiming();
+    }catch (std::string exceptionMsgThrown){
+        throw exceptionMsgThrown;
+    }
 }
 
 void
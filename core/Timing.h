@@ -71,7 +71,28 @@ class Timing : public Channel
             throw exceptionMsgThrown;
         }
     }
+
+    Timing(const TechnologyValues& technologyValues) :
+        Channel(technologyValues)
+    {
+        timingInitialize();
+        try {
+            timingCompute();
+        }catch (string exceptionMsgThrown){
+            throw exceptionMsgThrown;
+        }
+    }
   
+    //Scaling of the resistances of the drivers supplied by Vdd
+    double vddDriverFactor;
+    //Scaling of the resistances of the wordline drivers and cells (Vpp)
+    double vppDriverFactor;
+
+    //Scaling of the wire, cell and driver resistances with the temperature
+    double wireTemperatureFactor;
+    double cellTemperatureFactor;
+    double driverTemperatureFactor;
+
     //Delay of cell
     bu::quantity<drs::nanosecond_unit> cellDelay;
 
@@ -216,6 +237,10 @@ class Timing : public Channel
 
     void timingInitialize();
 
+    void driverVoltageCalc();
+
+    void resistanceTemperatureCalc();
+
     void trcdCalc();
 
     void trasCalc();
@@ -234,6 +259,31 @@ class Timing : public Channel
 
     void timingCompute();
 
+    // Recomputes the delays in ns through the wires, drivers and cells
+    //  (from tRCD to tRC) at the current temperature
+    void resistiveDelayCompute();
+
+    // Recomputes the timings for another frequency. Only the clock and
+    //  what depends on it are recomputed, the delays of the array in ns
+    //  are kept.
+    void frequencyCompute(bu::quantity<drs::megahertz_clock_unit> frequency);
+
+    // Recomputes the timings for another temperature: the delays through
+    //  the resistances and the refresh timings
+    void temperatureCompute(
+            bu::quantity<bu::celsius::temperature> newTemperature);
+
+    // Recomputes the timings for other supply voltages. The geometry and
+    //  the wires are kept, only the delays through the drivers and cells
+    //  and what depends on them are recomputed.
+    void voltageCompute(bu::quantity<si::electric_potential> newVdd,
+                        bu::quantity<si::electric_potential> newVpp);
+
+    // Recomputes the timings with the resistances and capacitances of a
+    //  process corner, keeping the geometry. The corner multiplies the
+    //  input values, so it must be applied to a device once.
+    void cornerCompute(const ProcessCorner& corner);
+
     void printTimings();
 };
 
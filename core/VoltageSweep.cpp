@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+#include "VoltageSweep.h"
+#include "../workload/WorkloadPower.h"
+#include "../utils/NumberFormat.h"
+
+#include <fstream>
+
+namespace {
+
+// Pads a line of the report to the column starting at width
+void padTo(string& line, size_t width)
+{
+    line.append( line.size() < width ? width - line.size() : 1, ' ' );
+}
+
+}
+
+VoltageSweep::VoltageSweep(const Current& dram,
+                           const vector<double>& vdds,
+                           const vector<double>& vpps)
+{
+    // The copy keeps the geometry and the wires already computed for dram
+    Current sweepDram(dram);
+    points.resize(vdds.size());
+    for ( size_t pointID = 0; pointID < vdds.size(); pointID++ ) {
+        try {
+            sweepDram.voltageCompute(vdds[pointID]*si::volts,
+                                     vpps[pointID]*si::volts);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+
+        WorkloadEnergies energies(sweepDram, sweepDram);
+        VoltagePoint& point = points[pointID];
+        point.vdd = vdds[pointID];
+        point.vpp = vpps[pointID];
+        point.trcd = sweepDram.trcd.value();
+        point.tcas = sweepDram.tcas.value();
+        point.tras = sweepDram.tras.value();
+        point.trp = sweepDram.trp.value();
+        point.trc = sweepDram.trc.value();
+        point.trcdClocks = sweepDram.trcd_clk.value();
+        point.tcasClocks = sweepDram.tcas_clk.value();
+        point.trcClocks = sweepDram.trc_clk.value();
+        point.activateEnergy = energies.activateEnergy;
+        point.readBitEnergy = energies.readByteEnergy / 8;
+        point.writeBitEnergy = energies.writeByteEnergy / 8;
+        point.backgroundPower = energies.idlePower;
+        point.refreshPower = energies.refreshPower;
+        point.isTooFast = sweepDram.dramCoreFreq > sweepDram.maxCoreFreq;
+    }
+}
+
+void
+VoltageSweep::write(const string& sweepFileName) const
+{
+    string lines("vdd[V],vpp[V],trcd[ns],tcl[ns],tras[ns],trp[ns],trc[ns],"
+                 "trcd[clk],tcl[clk],trc[clk],"
+                 "activate[pJ],read[pJ/bit],write[pJ/bit],"
+                 "background[mW],refresh[mW],too_fast\n");
+    for ( const VoltagePoint& point : points ) {
+        const double values[7] = {
+            point.vdd, point.vpp, point.trcd, point.tcas, point.tras,
+            point.trp, point.trc
+        };
+        for ( size_t valueID = 0; valueID < 7; valueID++ ) {
+            if ( valueID > 0 ) {
+                lines.push_back(',');
+            }
+            appendNumber(lines, values[valueID]);
+        }
+        const unsigned int clocks[3] = {
+            point.trcdClocks, point.tcasClocks, point.trcClocks
+        };
+        for ( unsigned int clock : clocks ) {
+            lines.push_back(',');
+            lines.append(to_string(clock));
+        }
+        const double energies[5] = {
+            point.activateEnergy, point.readBitEnergy, point.writeBitEnergy,
+            point.backgroundPower, point.refreshPower
+        };
+        for ( double energy : energies ) {
+            lines.push_back(',');
+            appendNumber(lines, energy);
+        }
+        lines.append( point.isTooFast ? ",1\n" : ",0\n" );
+    }
+    ofstream sweepFile(sweepFileName, ofstream::trunc);
+    sweepFile << lines;
+}
+
+void
+VoltageSweep::appendReport(string& report) const
+{
+    report.append("Voltage sweep (");
+    report.append(to_string(points.size()));
+    report.append(" points)\n");
+    report.append("  Vdd [V]  Vpp [V]  tRCD [ns]  tCL [ns]  tRC [ns]  "
+                  "ACT [pJ]  RD [pJ/bit]  WR [pJ/bit]\n");
+    for ( const VoltagePoint& point : points ) {
+        string line("  ");
+        appendNumber(line, point.vdd);
+        padTo(line, 11);
+        appendNumber(line, point.vpp);
+        padTo(line, 20);
+        appendNumber(line, point.trcd);
+        padTo(line, 31);
+        appendNumber(line, point.tcas);
+        padTo(line, 41);
+        appendNumber(line, point.trc);
+        padTo(line, 51);
+        appendNumber(line, point.activateEnergy);
+        padTo(line, 61);
+        appendNumber(line, point.readBitEnergy);
+        padTo(line, 74);
+        appendNumber(line, point.writeBitEnergy);
+        if ( point.isTooFast ) {
+            line.append("  (core too fast)");
+        }
+        report.append(line);
+        report.push_back('\n');
+    }
+}
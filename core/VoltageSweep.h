@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+// Latencies and energies of a configuration over a sweep of its supply
+//  voltages (Vdd, Vpp), e.g. to trade energy against latency when
+//  undervolting. The geometry and the wires do not depend on the voltages,
+//  so they are computed once, and for every point only the delays through
+//  the drivers and cells (alpha-power law), the timings that follow them
+//  and the currents are recomputed. The energies are the ones of the
+//  workload power estimate (see WorkloadPower.h).
+#ifndef VOLTAGESWEEP_H
+#define VOLTAGESWEEP_H
+
+#include "Current.h"
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class VoltageSweep
+{
+  public:
+    // Voltages in V, one Vdd and one Vpp per point
+    VoltageSweep(const Current& dram,
+                 const vector<double>& vdds,
+                 const vector<double>& vpps);
+
+    // Writes one line per point to a CSV file
+    void write(const string& sweepFileName) const;
+    // Appends one line per point to a result table
+    void appendReport(string& report) const;
+
+    struct VoltagePoint {
+        // V
+        double vdd;
+        double vpp;
+        // ns
+        double trcd;
+        double tcas;
+        double tras;
+        double trp;
+        double trc;
+        // Clock cycles at the frequency of the configuration
+        unsigned int trcdClocks;
+        unsigned int tcasClocks;
+        unsigned int trcClocks;
+        // pJ per ACT-PRE pair, pJ per bit read or written
+        double activateEnergy;
+        double readBitEnergy;
+        double writeBitEnergy;
+        // mW, with all banks precharged and for refresh
+        double backgroundPower;
+        double refreshPower;
+        // Set if the core is clocked faster than the array allows
+        bool isTooFast;
+    };
+    vector<VoltagePoint> points;
+};
+
+#endif // VOLTAGESWEEP_H
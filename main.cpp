@@ -41,12 +41,16 @@
 
 int main(int argc, char** argv)
 {
-   DRAMSpec * dramSpec;
+   // Only C++ streams are used, and long pair lists may come from stdin
+   std::ios::sync_with_stdio(false);
 
    try {
-       dramSpec = new DRAMSpec(argc, argv);
-       std::cout << dramSpec->output.str();
+       // The results are written to the standard output as they come
+       DRAMSpec dramSpec(argc, argv);
+       std::cout.flush();
    } catch(string exceptionMsgThrown) {
+       // After the results of the configurations before the error
+       std::cout.flush();
        std::cerr << exceptionMsgThrown;
        return -1;
    }
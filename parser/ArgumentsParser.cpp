@@ -39,6 +39,14 @@
 
 
 #include "ArgumentsParser.h"
+#include "../utils/utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <dirent.h>
+#include <glob.h>
+#include <sys/stat.h>
 
 using namespace std;
 
@@ -52,62 +60,158 @@ ArgumentsParser::ArgumentsParser(int argc, char** argv)
     nConfigurations = 0;
     IOTerminationCurrentFlag = false;
     printInternalTimings = false;
+    cacheDirectory = "";
+    columnarFileName = "";
+    prettyJSONFlag = false;
+    printResultTable = true;
+    nThreads = 0;
+    streamMode = false;
+    isUnorderedStream = false;
+    shardID = 0;
+    nShards = 0;
+    checkpointFileName = "";
+    isResumed = false;
+    progressFlag = false;
+    statusFileName = "";
+    metricsPort = 0;
+    energyTraceFileName = "";
+    checkTraceFileName = "";
+    checkSummaryFlag = false;
+    workloadFileName = "";
+    speedBinFrequencies.clear();
+    voltageSweepVdds.clear();
+    voltageSweepVpps.clear();
+    temperatureSweepPoints.clear();
+    cornersFlag = false;
+    temperatureLogFileName = "";
+    thermalResistance = 0;
+    ambientTemperature = 0;
 }
 
 void ArgumentsParser::runArgParser()
 {
-    if ( argvID >= cpargc ) {
-        // Help run (no arguments)
-        if ( cpargc == 1 ) {
-            helpStrStream << helpMessage;
-        }
-        // Or end of parsing
+    // Help run (no arguments)
+    if ( cpargc == 1 ) {
+        helpStrStream << helpMessage;
         return;
     }
 
-    // Help run (by argument)
-    if ( cpargv[argvID] == "-h" ) {
-        helpStrStream << helpMessage;
+    try {
+        expandListFiles();
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
     }
 
-    // Normal run
-    if( cpargv[argvID] == "-t") {
-        argvID++;
-        if(!getTechFileName()) {
+    // Arguments are read one after the other. File names are added to
+    //  the list of the last "-t" or "-p" flag.
+    vector<string> * fileNameList = NULL;
+    while ( argvID < cpargc ) {
+        // Help run (by argument)
+        if ( cpargv[argvID] == "-h" ) {
+            helpStrStream << helpMessage;
+            return;
+        }
+
+        if( cpargv[argvID] == "-t") {
+            fileNameList = &technologyFileName;
+            argvID++;
+        }
+        else if( cpargv[argvID] == "-p") {
+            fileNameList = &architectureFileName;
+            argvID++;
+        }
+        else if( getOptionalFlag() ) {
+            continue;
+        }
+        else if ( fileNameList == NULL || cpargv[argvID][0] == '-' ) {
             string exceptionMsgThrown("[ERROR] ");
             exceptionMsgThrown.append("Unexpected argument \'");
             exceptionMsgThrown.append(cpargv[argvID]);
             exceptionMsgThrown.append("\'\n");
             exceptionMsgThrown.append(helpMessage);
             throw exceptionMsgThrown;
-       }
+        }
+        else {
+            addFileNames(cpargv[argvID], *fileNameList);
+            argvID++;
+        }
     }
-    else if( cpargv[argvID] == "-p") {
-        argvID++;
-        if(!getArchFileName()) {
+
+    // Configurations of a stream are given in the standard input
+    if ( streamMode ) {
+        if ( !technologyFileName.empty() || !architectureFileName.empty() ) {
             string exceptionMsgThrown("[ERROR] ");
-            exceptionMsgThrown.append("Unexpected argument \'");
-            exceptionMsgThrown.append(cpargv[argvID]);
-            exceptionMsgThrown.append("\'\n");
+            exceptionMsgThrown.append("Input files cannot be given ");
+            exceptionMsgThrown.append("together with -stream!\n");
+            exceptionMsgThrown.append(helpMessage);
+            throw exceptionMsgThrown;
+        }
+        // Flags of the runs over input files only
+        string batchFlag;
+        if ( nShards > 0 ) {
+            batchFlag = "--shard";
+        }
+        else if ( !checkpointFileName.empty() ) {
+            batchFlag = "-checkpoint";
+        }
+        else if ( !energyTraceFileName.empty() ) {
+            batchFlag = "-energytrace";
+        }
+        else if ( !checkTraceFileName.empty() ) {
+            batchFlag = "-checktrace";
+        }
+        else if ( !workloadFileName.empty() ) {
+            batchFlag = "-workloads";
+        }
+        else if ( thermalResistance > 0 ) {
+            batchFlag = "-thermal";
+        }
+        else if ( !speedBinFrequencies.empty() ) {
+            batchFlag = "-speedbins";
+        }
+        else if ( !voltageSweepVdds.empty() ) {
+            batchFlag = "-voltages";
+        }
+        else if ( !temperatureSweepPoints.empty() ) {
+            batchFlag = "-temperaturesweep";
+        }
+        else if ( cornersFlag ) {
+            batchFlag = "-corners";
+        }
+        else if ( !temperatureLogFileName.empty() ) {
+            batchFlag = "-temperatures";
+        }
+        if ( !batchFlag.empty() ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append(batchFlag);
+            exceptionMsgThrown.append(" cannot be given ");
+            exceptionMsgThrown.append("together with -stream!\n");
             exceptionMsgThrown.append(helpMessage);
             throw exceptionMsgThrown;
-       }
+        }
+        return;
     }
-    else if( cpargv[argvID] == "-term") {
-        IOTerminationCurrentFlag = true;
-        argvID++;
-        runArgParser();
+
+    if ( isResumed && checkpointFileName.empty() ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("--resume needs a checkpoint file ");
+        exceptionMsgThrown.append("(-checkpoint <path/to/checkpointfile>)!\n");
+        exceptionMsgThrown.append(helpMessage);
+        throw exceptionMsgThrown;
     }
-    else if( cpargv[argvID] == "-internaltimings") {
-        printInternalTimings = true;
-        argvID++;
-        runArgParser();
+
+    if ( checkSummaryFlag && checkTraceFileName.empty() ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("-checksummary needs a trace file ");
+        exceptionMsgThrown.append("(-checktrace <path/to/tracefile>)!\n");
+        exceptionMsgThrown.append(helpMessage);
+        throw exceptionMsgThrown;
     }
-    else {
+
+    if ( thermalResistance > 0 && workloadFileName.empty() ) {
         string exceptionMsgThrown("[ERROR] ");
-        exceptionMsgThrown.append("Unexpected argument \'");
-        exceptionMsgThrown.append(cpargv[argvID]);
-        exceptionMsgThrown.append("\'\n");
+        exceptionMsgThrown.append("-thermal needs workload profiles ");
+        exceptionMsgThrown.append("(-workloads <path/to/profilefile.csv>)!\n");
         exceptionMsgThrown.append(helpMessage);
         throw exceptionMsgThrown;
     }
@@ -140,69 +244,462 @@ void ArgumentsParser::runArgParser()
 
 }
 
+void ArgumentsParser::expandListFiles()
+{
+    // Replaces every "@path/to/listfile" argument by the lines of the file
+    bool hasListFile = false;
+    for ( int argID = argvID; argID < cpargc; argID++ ) {
+        if ( cpargv[argID].size() > 1 && cpargv[argID][0] == '@' ) {
+            hasListFile = true;
+            break;
+        }
+    }
+    if ( !hasListFile ) {
+        return;
+    }
+
+    vector<string> expandedArgv(cpargv.begin(), cpargv.begin() + argvID);
+    for ( int argID = argvID; argID < cpargc; argID++ ) {
+        if ( cpargv[argID].size() <= 1 || cpargv[argID][0] != '@' ) {
+            expandedArgv.push_back(cpargv[argID]);
+            continue;
+        }
+
+        string listFileName = cpargv[argID].substr(1);
+        ifstream listFile(listFileName);
+        if ( listFile.is_open() == false ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Could not open list file: ");
+            exceptionMsgThrown.append(listFileName);
+            exceptionMsgThrown.append("!\n");
+            throw exceptionMsgThrown;
+        }
+
+        // One argument per line. Empty lines and comments (#) are skipped.
+        string line;
+        while ( getline(listFile, line) ) {
+            line = trimmed(line);
+            if ( line.empty() || line[0] == '#' ) {
+                continue;
+            }
+            expandedArgv.push_back(line);
+        }
+    }
 
-bool ArgumentsParser::getTechFileName()
+    cpargv.swap(expandedArgv);
+    cpargc = cpargv.size();
+}
+
+void ArgumentsParser::addFileNames(const string& fileName,
+                                   vector<string>& fileNameList)
 {
-    while (argvID < cpargc) {
+    struct stat fileStatus;
+    bool fileExists = ( stat(fileName.c_str(), &fileStatus) == 0 );
 
-        if( cpargv[argvID] == "-p") {
-            argvID++;
-            if(!getArchFileName()) { return false; }
+    // A directory stands for all its JSON files, in alphabetical order
+    if ( fileExists && S_ISDIR(fileStatus.st_mode) ) {
+        DIR * directory = opendir(fileName.c_str());
+        if ( directory == NULL ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Could not open directory: ");
+            exceptionMsgThrown.append(fileName);
+            exceptionMsgThrown.append("!\n");
+            throw exceptionMsgThrown;
         }
-        else if( cpargv[argvID] == "-term") {
-            IOTerminationCurrentFlag = true;
-            argvID++;
-            if(!getTechFileName()) { return false; }
+        string directoryName(fileName);
+        if ( directoryName[directoryName.size() - 1] != '/' ) {
+            directoryName.append("/");
         }
-        else if( cpargv[argvID] == "-internaltimings") {
-            printInternalTimings = true;
-            argvID++;
-            if(!getTechFileName()) { return false; }
+        vector<string> directoryFileNames;
+        struct dirent * entry;
+        while ( (entry = readdir(directory)) != NULL ) {
+            string entryName(entry->d_name);
+            if ( entryName.size() > 5
+                 && entryName.compare(entryName.size() - 5, 5, ".json") == 0 ) {
+                directoryFileNames.push_back(directoryName + entryName);
+            }
         }
-        else if (cpargv[argvID][0] == '-') {
-            return false;
+        closedir(directory);
+        sort(directoryFileNames.begin(), directoryFileNames.end());
+        fileNameList.insert(fileNameList.end(),
+                            directoryFileNames.begin(),
+                            directoryFileNames.end());
+        return;
+    }
+
+    // Patterns not expanded by the shell (e.g., read from a list file).
+    // Patterns matching nothing are kept, so opening them reports the error.
+    if ( !fileExists && fileName.find_first_of("*?[") != string::npos ) {
+        glob_t globResult;
+        if ( glob(fileName.c_str(), 0, NULL, &globResult) == 0 ) {
+            for ( size_t pathID = 0; pathID < globResult.gl_pathc; pathID++ ) {
+                fileNameList.push_back(globResult.gl_pathv[pathID]);
+            }
+            globfree(&globResult);
+            return;
         }
-        else {
-            technologyFileName.push_back(cpargv[argvID]);
-            argvID++;
-            if(!getTechFileName()) { return false; }
+        globfree(&globResult);
+    }
+
+    fileNameList.push_back(fileName);
+}
+
+void ArgumentsParser::readFilePairs(istream& pairsStream,
+                                    const string& pairsName)
+{
+    // One "<technology file> <architecture file>" pair per line.
+    // Empty lines and comments (#) are skipped.
+    string line;
+    unsigned int lineNumber = 0;
+    while ( getline(pairsStream, line) ) {
+        lineNumber++;
+        line = trimmed(line);
+        if ( line.empty() || line[0] == '#' ) {
+            continue;
         }
 
-        argvID++;
+        // The line is already trimmed, so a pair has a single gap
+        size_t gapBegin = line.find_first_of(" \t");
+        size_t gapEnd = line.find_first_not_of(" \t", gapBegin);
+        if ( gapBegin == string::npos
+             || line.find_first_of(" \t", gapEnd) != string::npos ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Line ");
+            exceptionMsgThrown.append(to_string(lineNumber));
+            exceptionMsgThrown.append(" of ");
+            exceptionMsgThrown.append(pairsName);
+            exceptionMsgThrown.append(" is not a pair of file names: ");
+            exceptionMsgThrown.append(line);
+            exceptionMsgThrown.append("\n");
+            throw exceptionMsgThrown;
+        }
+        technologyFileName.push_back(line.substr(0, gapBegin));
+        architectureFileName.push_back(line.substr(gapEnd));
     }
+}
 
-    return true;
+string ArgumentsParser::trimmed(const string& str)
+{
+    const char* whitespace = " \t\r\n";
+    size_t first = str.find_first_not_of(whitespace);
+    if ( first == string::npos ) {
+        return "";
+    }
+    size_t last = str.find_last_not_of(whitespace);
+    return str.substr(first, last - first + 1);
 }
 
-bool ArgumentsParser::getArchFileName()
+vector<string> ArgumentsParser::runArguments() const
 {
-    while (argvID < cpargc) {
+    vector<string> arguments;
+    for ( int argID = 1; argID < cpargc; argID++ ) {
+        if ( cpargv[argID] == "-threads" || cpargv[argID] == "-status"
+             || cpargv[argID] == "-metrics" ) {
+            argID++;
+            continue;
+        }
+        if ( cpargv[argID] == "--resume" || cpargv[argID] == "-progress" ) {
+            continue;
+        }
+        arguments.push_back(cpargv[argID]);
+    }
+    return arguments;
+}
 
-        if( cpargv[argvID] == "-t") {
-            argvID++;
-            if(!getTechFileName()) { return false; }
+string ArgumentsParser::filePairsHash() const
+{
+    // Chained pair by pair, so that long lists are never copied into one
+    //  string
+    string pairsHash = hashString("");
+    for ( size_t pairID = 0; pairID < technologyFileName.size(); pairID++ ) {
+        pairsHash = hashString(pairsHash + "\n"
+                               + technologyFileName[pairID] + "\t"
+                               + architectureFileName[pairID]);
+    }
+    return pairsHash;
+}
+
+bool ArgumentsParser::getOptionalFlag()
+{
+    // Flags that may appear anywhere in the arguments list.
+    // Returns false if the current argument is not one of them.
+    if( cpargv[argvID] == "-term") {
+        IOTerminationCurrentFlag = true;
+        argvID++;
+    }
+    else if( cpargv[argvID] == "-internaltimings") {
+        printInternalTimings = true;
+        argvID++;
+    }
+    else if( cpargv[argvID] == "-cache") {
+        argvID++;
+        cacheDirectory = getFlagValue("-cache");
+    }
+    else if( cpargv[argvID] == "-columnar") {
+        argvID++;
+        columnarFileName = getFlagValue("-columnar");
+    }
+    else if( cpargv[argvID] == "-pretty") {
+        prettyJSONFlag = true;
+        argvID++;
+    }
+    else if( cpargv[argvID] == "-notable") {
+        printResultTable = false;
+        argvID++;
+    }
+    else if( cpargv[argvID] == "-set") {
+        argvID++;
+        parameterOverrides.push_back(getFlagValue("-set"));
+    }
+    else if( cpargv[argvID] == "-threads") {
+        argvID++;
+        string nThreadsStr = getFlagValue("-threads");
+        if ( nThreadsStr.empty()
+             || nThreadsStr.find_first_not_of("0123456789") != string::npos
+             || nThreadsStr.size() > 4 || stoi(nThreadsStr) == 0 ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Invalid value for flag \'-threads\': ");
+            exceptionMsgThrown.append(nThreadsStr);
+            exceptionMsgThrown.append("\n");
+            exceptionMsgThrown.append(helpMessage);
+            throw exceptionMsgThrown;
         }
-        else if( cpargv[argvID] == "-term") {
-            IOTerminationCurrentFlag = true;
-            argvID++;
-            if(!getArchFileName()) { return false; }
+        nThreads = stoi(nThreadsStr);
+    }
+    else if( cpargv[argvID] == "-stream") {
+        streamMode = true;
+        argvID++;
+    }
+    else if( cpargv[argvID] == "-unordered") {
+        isUnorderedStream = true;
+        argvID++;
+    }
+    else if( cpargv[argvID] == "--shard") {
+        argvID++;
+        string shardStr = getFlagValue("--shard");
+        size_t slashPosition = shardStr.find('/');
+        string shardIDStr = shardStr.substr(0, slashPosition);
+        string nShardsStr = ( slashPosition == string::npos ? ""
+                              : shardStr.substr(slashPosition + 1) );
+        if ( shardIDStr.empty() || nShardsStr.empty()
+             || shardIDStr.find_first_not_of("0123456789") != string::npos
+             || nShardsStr.find_first_not_of("0123456789") != string::npos
+             || shardIDStr.size() > 6 || nShardsStr.size() > 6
+             || stoi(shardIDStr) == 0
+             || stoi(shardIDStr) > stoi(nShardsStr) ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Invalid value for flag '--shard': ");
+            exceptionMsgThrown.append(shardStr);
+            exceptionMsgThrown.append("\n");
+            exceptionMsgThrown.append(helpMessage);
+            throw exceptionMsgThrown;
         }
-        else if( cpargv[argvID] == "-internaltimings") {
-            printInternalTimings = true;
-            argvID++;
-            if(!getArchFileName()) { return false; }
+        shardID = stoi(shardIDStr);
+        nShards = stoi(nShardsStr);
+    }
+    else if( cpargv[argvID] == "-checkpoint") {
+        argvID++;
+        checkpointFileName = getFlagValue("-checkpoint");
+    }
+    else if( cpargv[argvID] == "--resume") {
+        isResumed = true;
+        argvID++;
+    }
+    else if( cpargv[argvID] == "-progress") {
+        progressFlag = true;
+        argvID++;
+    }
+    else if( cpargv[argvID] == "-status") {
+        argvID++;
+        statusFileName = getFlagValue("-status");
+    }
+    else if( cpargv[argvID] == "-metrics") {
+        argvID++;
+        string metricsPortStr = getFlagValue("-metrics");
+        if ( metricsPortStr.empty()
+             || metricsPortStr.find_first_not_of("0123456789") != string::npos
+             || metricsPortStr.size() > 5 || stoi(metricsPortStr) == 0
+             || stoi(metricsPortStr) > 65535 ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Invalid value for flag \'-metrics\': ");
+            exceptionMsgThrown.append(metricsPortStr);
+            exceptionMsgThrown.append("\n");
+            exceptionMsgThrown.append(helpMessage);
+            throw exceptionMsgThrown;
+        }
+        metricsPort = stoi(metricsPortStr);
+    }
+    else if( cpargv[argvID] == "-energytrace") {
+        argvID++;
+        energyTraceFileName = getFlagValue("-energytrace");
+    }
+    else if( cpargv[argvID] == "-checktrace") {
+        argvID++;
+        checkTraceFileName = getFlagValue("-checktrace");
+    }
+    else if( cpargv[argvID] == "-checksummary") {
+        checkSummaryFlag = true;
+        argvID++;
+    }
+    else if( cpargv[argvID] == "-workloads") {
+        argvID++;
+        workloadFileName = getFlagValue("-workloads");
+    }
+    else if( cpargv[argvID] == "-thermal") {
+        argvID++;
+        string thermalStr = getFlagValue("-thermal");
+        size_t commaPosition = thermalStr.find(',');
+        string resistanceStr = thermalStr.substr(0, commaPosition);
+        string ambientStr = ( commaPosition == string::npos ? ""
+                              : thermalStr.substr(commaPosition + 1) );
+        char* resistanceEnd = NULL;
+        char* ambientEnd = NULL;
+        thermalResistance = strtod(resistanceStr.c_str(), &resistanceEnd);
+        ambientTemperature = strtod(ambientStr.c_str(), &ambientEnd);
+        if ( resistanceStr.empty() || ambientStr.empty()
+             || *resistanceEnd != '\0' || *ambientEnd != '\0'
+             || !(thermalResistance > 0) || !isfinite(thermalResistance)
+             || !(ambientTemperature > 0 && ambientTemperature < 95) ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Invalid value for flag \'-thermal\': ");
+            exceptionMsgThrown.append(thermalStr);
+            exceptionMsgThrown.append("\n");
+            exceptionMsgThrown.append(helpMessage);
+            throw exceptionMsgThrown;
+        }
+    }
+    else if( cpargv[argvID] == "-speedbins") {
+        argvID++;
+        string frequenciesStr = getFlagValue("-speedbins");
+        istringstream frequenciesStream(frequenciesStr);
+        string frequencyStr;
+        speedBinFrequencies.clear();
+        while ( getline(frequenciesStream, frequencyStr, ',') ) {
+            char* frequencyEnd = NULL;
+            double frequency = strtod(frequencyStr.c_str(), &frequencyEnd);
+            if ( frequencyStr.empty() || *frequencyEnd != '\0'
+                 || !(frequency > 0) || !isfinite(frequency) ) {
+                speedBinFrequencies.clear();
+                break;
+            }
+            speedBinFrequencies.push_back(frequency);
         }
-        else if (cpargv[argvID][0] == '-') {
-            return false;
+        if ( speedBinFrequencies.empty() ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Invalid value for flag \'-speedbins\': ");
+            exceptionMsgThrown.append(frequenciesStr);
+            exceptionMsgThrown.append("\n");
+            exceptionMsgThrown.append(helpMessage);
+            throw exceptionMsgThrown;
         }
-        else {
-            architectureFileName.push_back(cpargv[argvID]);
-            argvID++;
-            if(!getArchFileName()) { return false; }
+    }
+    else if( cpargv[argvID] == "-voltages") {
+        argvID++;
+        string pointsStr = getFlagValue("-voltages");
+        istringstream pointsStream(pointsStr);
+        string pointStr;
+        voltageSweepVdds.clear();
+        voltageSweepVpps.clear();
+        while ( getline(pointsStream, pointStr, ',') ) {
+            size_t colonPosition = pointStr.find(':');
+            string vddStr = pointStr.substr(0, colonPosition);
+            string vppStr = ( colonPosition == string::npos ? ""
+                              : pointStr.substr(colonPosition + 1) );
+            char* vddEnd = NULL;
+            char* vppEnd = NULL;
+            double vdd = strtod(vddStr.c_str(), &vddEnd);
+            double vpp = strtod(vppStr.c_str(), &vppEnd);
+            if ( vddStr.empty() || vppStr.empty()
+                 || *vddEnd != '\0' || *vppEnd != '\0'
+                 || !(vdd > 0) || !isfinite(vdd)
+                 || !(vpp > 0) || !isfinite(vpp) ) {
+                voltageSweepVdds.clear();
+                voltageSweepVpps.clear();
+                break;
+            }
+            voltageSweepVdds.push_back(vdd);
+            voltageSweepVpps.push_back(vpp);
         }
-
+        if ( voltageSweepVdds.empty() ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Invalid value for flag \'-voltages\': ");
+            exceptionMsgThrown.append(pointsStr);
+            exceptionMsgThrown.append("\n");
+            exceptionMsgThrown.append(helpMessage);
+            throw exceptionMsgThrown;
+        }
+    }
+    else if( cpargv[argvID] == "-temperaturesweep") {
         argvID++;
+        string temperaturesStr = getFlagValue("-temperaturesweep");
+        istringstream temperaturesStream(temperaturesStr);
+        string temperatureStr;
+        temperatureSweepPoints.clear();
+        while ( getline(temperaturesStream, temperatureStr, ',') ) {
+            char* temperatureEnd = NULL;
+            double temperature = strtod(temperatureStr.c_str(),
+                                        &temperatureEnd);
+            if ( temperatureStr.empty() || *temperatureEnd != '\0'
+                 || !(temperature > 0 && temperature < 95) ) {
+                temperatureSweepPoints.clear();
+                break;
+            }
+            temperatureSweepPoints.push_back(temperature);
+        }
+        if ( temperatureSweepPoints.empty() ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Invalid value for flag \'-temperaturesweep\': ");
+            exceptionMsgThrown.append(temperaturesStr);
+            exceptionMsgThrown.append("\n");
+            exceptionMsgThrown.append(helpMessage);
+            throw exceptionMsgThrown;
+        }
+    }
+    else if( cpargv[argvID] == "-corners") {
+        cornersFlag = true;
+        argvID++;
+    }
+    else if( cpargv[argvID] == "-temperatures") {
+        argvID++;
+        temperatureLogFileName = getFlagValue("-temperatures");
+    }
+    else if( cpargv[argvID] == "--pairs-from") {
+        argvID++;
+        string pairsFileName = getFlagValue("--pairs-from");
+        if ( pairsFileName == "-" ) {
+            readFilePairs(cin, "standard input");
+        }
+        else {
+            ifstream pairsFile(pairsFileName);
+            if ( pairsFile.is_open() == false ) {
+                string exceptionMsgThrown("[ERROR] ");
+                exceptionMsgThrown.append("Could not open pairs file: ");
+                exceptionMsgThrown.append(pairsFileName);
+                exceptionMsgThrown.append("!\n");
+                throw exceptionMsgThrown;
+            }
+            readFilePairs(pairsFile, pairsFileName);
+        }
+    }
+    else {
+        return false;
     }
 
     return true;
 }
+
+string ArgumentsParser::getFlagValue(const string& flag)
+{
+    // A single "-" is a value (standard input), not a flag
+    if ( argvID >= cpargc
+         || ( cpargv[argvID][0] == '-' && cpargv[argvID] != "-" ) ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Missing value for flag \'");
+        exceptionMsgThrown.append(flag);
+        exceptionMsgThrown.append("\'\n");
+        exceptionMsgThrown.append(helpMessage);
+        throw exceptionMsgThrown;
+    }
+
+    return cpargv[argvID++];
+}
@@ -45,6 +45,7 @@
 #include <vector>
 #include <string>
 #include <sstream>
+#include <fstream>
 
 using namespace std;
 
@@ -57,6 +58,62 @@ public:
     unsigned int nConfigurations;
     bool IOTerminationCurrentFlag;
     bool printInternalTimings;
+    string cacheDirectory;
+    // Results are written to this file instead of one file per configuration
+    string columnarFileName;
+    // JSON result files are indented instead of written on a single line
+    bool prettyJSONFlag;
+    // The result table of every configuration is printed to stdout
+    bool printResultTable;
+    vector<string> parameterOverrides;
+    // Number of configurations evaluated at the same time (0 means one
+    //  per hardware thread)
+    unsigned int nThreads;
+    // Configurations are read from stdin and results written to stdout
+    bool streamMode;
+    bool isUnorderedStream;
+    // Only the configurations of shard shardID (from 1 to nShards) are
+    //  evaluated. nShards is 0 when the run is not sharded.
+    unsigned int shardID;
+    unsigned int nShards;
+    // Progress of the run is saved to this file, from which it goes on
+    //  if isResumed is set
+    string checkpointFileName;
+    bool isResumed;
+    // Progress of the run is reported on stderr, to a status file and as
+    //  Prometheus metrics on a local port (0 means no metrics)
+    bool progressFlag;
+    string statusFileName;
+    unsigned int metricsPort;
+    // Command trace whose energy is reported for every configuration
+    string energyTraceFileName;
+    // Command trace checked against the timings of every configuration,
+    //  whose violations are only counted if checkSummaryFlag is set
+    string checkTraceFileName;
+    bool checkSummaryFlag;
+    // Workload profiles whose power is estimated for every configuration
+    string workloadFileName;
+    // Frequencies in MHz of the speed-bin table written for every
+    //  configuration, empty if none is written
+    vector<double> speedBinFrequencies;
+    // Supply voltages in V of the points of the voltage sweep of every
+    //  configuration (one Vdd and one Vpp per point), empty if none
+    vector<double> voltageSweepVdds;
+    vector<double> voltageSweepVpps;
+    // Temperatures in C at which the latencies of every configuration are
+    //  written, empty if none
+    vector<double> temperatureSweepPoints;
+    // Write the timings and currents of every configuration at each process
+    //  corner of its technology file
+    bool cornersFlag;
+    // Temperature log over which the refresh and background power of
+    //  every configuration are evaluated
+    string temperatureLogFileName;
+    // Thermal resistance (C/W) from the device to the ambient, and ambient
+    //  temperature (C), to solve the temperature of every workload profile.
+    //  The thermal resistance is 0 if no temperature is solved.
+    double thermalResistance;
+    double ambientTemperature;
 
     ostringstream helpStrStream;
     const char* helpMessage =
@@ -70,17 +127,83 @@ public:
               "(Include IO termination currents for read and write operations.)\n"
             "    -internaltimings                      "
               "(Enable print out of internal timings.)\n"
+            "    -cache <path/to/cachedirectory>       "
+              "(Reuse results stored in a persistent cache directory.)\n"
+            "    -columnar <path/to/resultfile>        "
+              "(Write all results to a single binary columnar file.)\n"
+            "    -pretty                               "
+              "(Indent the JSON result files.)\n"
+            "    -notable                              "
+              "(Do not print the result table of every configuration.)\n"
+            "    -set \"<Key>=<value>\"                  "
+              "(Override an input value, e.g. -set \"Temperature[C]=90\".)\n"
+            "    -threads <number>                     "
+              "(Number of configurations evaluated in parallel.)\n"
+            "    -stream                               "
+              "(Read JSON configurations from stdin, write results to stdout.)\n"
+            "    -unordered                            "
+              "(With -stream, write results as soon as they are ready.)\n"
+            "    --shard <i/N>                         "
+              "(Evaluate only the i-th of N shares of the configurations.)\n"
+            "    -checkpoint <path/to/checkpointfile>  "
+              "(Save the progress of the run periodically.)\n"
+            "    --resume                              "
+              "(Go on from the checkpoint, skipping the results written.)\n"
+            "    -progress                             "
+              "(Report the progress of the run on stderr periodically.)\n"
+            "    -status <path/to/statusfile>          "
+              "(Write the progress of the run to a JSON status file.)\n"
+            "    -metrics <port>                       "
+              "(Serve Prometheus metrics on http://127.0.0.1:<port>/metrics.)\n"
+            "    -energytrace <path/to/tracefile>      "
+              "(Report the energy of a DRAM command trace.)\n"
+            "    -checktrace <path/to/tracefile>       "
+              "(Check a DRAM command trace against the timings.)\n"
+            "    -checksummary                         "
+              "(Only count the timing violations, without listing them.)\n"
+            "    -workloads <path/to/profilefile.csv>  "
+              "(Estimate the power of workload profiles.)\n"
+            "    -thermal <C/W>,<ambient C>            "
+              "(Solve the temperature each workload heats the device to.)\n"
+            "    -speedbins <MHz,MHz,...>              "
+              "(Write the clock-cycle timings at every listed frequency.)\n"
+            "    -voltages <Vdd:Vpp,Vdd:Vpp,...>       "
+              "(Write the latencies and energies at every listed Vdd and Vpp.)\n"
+            "    -temperaturesweep <C,C,...>           "
+              "(Write the array latencies at every listed temperature.)\n"
+            "    -corners                              "
+              "(Write the timings and currents at every process corner.)\n"
+            "    -temperatures <path/to/templog.csv>   "
+              "(Evaluate refresh and background power over a temperature log.)\n"
+            "    --pairs-from <path/to/pairsfile|->    "
+              "(Read technology/architecture file pairs, one pair per line.)\n"
+            "    @<path/to/listfile>                   "
+              "(Read further arguments from a file, one per line.)\n"
             "For more information, see README.md.\n";
 
     void runArgParser();
 
+    // Arguments that identify the results of the run: all of them but the
+    //  flags that do not change the results (-threads, --resume and the
+    //  progress reports)
+    vector<string> runArguments() const;
+
+    // Hash of the technology and architecture file pairs of the run, after
+    //  list files, directories, globs and --pairs-from are expanded, which
+    //  the arguments alone do not identify
+    string filePairsHash() const;
+
 private:
     int cpargc;
     vector<string> cpargv;
     int argvID;
 
-    bool getTechFileName();
-    bool getArchFileName();
+    void expandListFiles();
+    void addFileNames(const string& fileName, vector<string>& fileNameList);
+    void readFilePairs(istream& pairsStream, const string& pairsName);
+    bool getOptionalFlag();
+    string getFlagValue(const string& flag);
+    static string trimmed(const string& str);
 
 };
 
@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#include "ColumnarResultReader.h"
+#include "../utils/NumberFormat.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "rapidjson/include/rapidjson/ostreamwrapper.h"
+#include "rapidjson/include/rapidjson/writer.h"
+
+ColumnarResultReader::ColumnarResultReader(const string& fileName) :
+    fileName(fileName),
+    file(fileName)
+{
+    nRows = 0;
+
+    if ( file.isOpen == false ) {
+        string exceptionMsgThrown;
+        exceptionMsgThrown.append("[ERROR] ");
+        exceptionMsgThrown.append("Could not open columnar result file: ");
+        exceptionMsgThrown.append(fileName);
+        exceptionMsgThrown.append("!\n");
+        throw exceptionMsgThrown;
+    }
+
+    const char* text = file.text;
+    size_t length = file.length;
+    if ( length < 16 || memcmp(text, COLUMNAR_MAGIC, 8) != 0 ) {
+        throwFormatError("it is not a DRAMSpec columnar result file");
+    }
+    uint64_t versionAndColumns = readLittleEndian(text + 8);
+    uint32_t formatVersion = versionAndColumns & 0xffffffff;
+    uint32_t nColumns = versionAndColumns >> 32;
+    if ( formatVersion != COLUMNAR_FORMAT_VERSION ) {
+        throwFormatError("its format version is not supported");
+    }
+
+    size_t position = 16;
+    for ( uint32_t columnID = 0; columnID < nColumns; columnID++ ) {
+        if ( length - position < 8 ) {
+            throwFormatError("its header is truncated");
+        }
+        uint64_t typeAndLength = readLittleEndian(text + position);
+        position += 8;
+        Column column;
+        column.type = static_cast<ColumnType>(typeAndLength & 0xffffffff);
+        size_t nameLength = typeAndLength >> 32;
+        size_t paddedLength = (nameLength + 7) / 8 * 8;
+        if ( (column.type != COLUMN_FLOAT64 && column.type != COLUMN_UINT64)
+             || length - position < paddedLength ) {
+            throwFormatError("its header is damaged");
+        }
+        column.name.assign(text + position, nameLength);
+        position += paddedLength;
+        columns.push_back(column);
+    }
+
+    while ( position < length ) {
+        if ( length - position < 8 ) {
+            throwFormatError("its last chunk is truncated");
+        }
+        Chunk chunk;
+        chunk.firstRow = nRows;
+        chunk.nRows = readLittleEndian(text + position);
+        position += 8;
+        if ( nColumns > 0
+             && chunk.nRows > (length - position) / 8 / nColumns ) {
+            throwFormatError("its last chunk is truncated");
+        }
+        chunk.data = text + position;
+        position += chunk.nRows * 8 * nColumns;
+        nRows += chunk.nRows;
+        chunks.push_back(chunk);
+    }
+}
+
+void
+ColumnarResultReader::throwFormatError(const string& reason) const
+{
+    string exceptionMsgThrown;
+    exceptionMsgThrown.append("[ERROR] ");
+    exceptionMsgThrown.append("Could not read ");
+    exceptionMsgThrown.append(fileName);
+    exceptionMsgThrown.append(": ");
+    exceptionMsgThrown.append(reason);
+    exceptionMsgThrown.append("!\n");
+    throw exceptionMsgThrown;
+}
+
+bool
+ColumnarResultReader::isLittleEndianHost()
+{
+    const uint16_t one = 1;
+    return *reinterpret_cast<const unsigned char*>(&one) == 1;
+}
+
+uint64_t
+ColumnarResultReader::readLittleEndian(const char* bytes)
+{
+    uint64_t value = 0;
+    for ( int byteID = 7; byteID >= 0; byteID-- ) {
+        value = (value << 8) | static_cast<unsigned char>(bytes[byteID]);
+    }
+    return value;
+}
+
+int
+ColumnarResultReader::findColumn(const string& columnName) const
+{
+    for ( size_t columnID = 0; columnID < columns.size(); columnID++ ) {
+        if ( columns[columnID].name == columnName ) {
+            return columnID;
+        }
+    }
+    return -1;
+}
+
+const char*
+ColumnarResultReader::valueAddress(uint64_t row, size_t columnID) const
+{
+    if ( row >= nRows || columnID >= columns.size() ) {
+        string exceptionMsgThrown;
+        exceptionMsgThrown.append("[ERROR] ");
+        exceptionMsgThrown.append("Row or column out of range in ");
+        exceptionMsgThrown.append(fileName);
+        exceptionMsgThrown.append("!\n");
+        throw exceptionMsgThrown;
+    }
+
+    // Last chunk starting at or before the row
+    size_t low = 0;
+    size_t high = chunks.size();
+    while ( high - low > 1 ) {
+        size_t middle = (low + high) / 2;
+        if ( chunks[middle].firstRow <= row ) {
+            low = middle;
+        }
+        else {
+            high = middle;
+        }
+    }
+    const Chunk& chunk = chunks[low];
+    return chunk.data + (columnID * chunk.nRows + row - chunk.firstRow) * 8;
+}
+
+uint64_t
+ColumnarResultReader::uintValue(uint64_t row, size_t columnID) const
+{
+    return readLittleEndian(valueAddress(row, columnID));
+}
+
+double
+ColumnarResultReader::value(uint64_t row, size_t columnID) const
+{
+    uint64_t bits = uintValue(row, columnID);
+    if ( columns[columnID].type == COLUMN_UINT64 ) {
+        return bits;
+    }
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+const double*
+ColumnarResultReader::float64Values(size_t chunkID, size_t columnID) const
+{
+    if ( isLittleEndianHost() == false
+         || columns[columnID].type != COLUMN_FLOAT64 ) {
+        return NULL;
+    }
+    const Chunk& chunk = chunks[chunkID];
+    return reinterpret_cast<const double*>(chunk.data
+                                           + columnID * chunk.nRows * 8);
+}
+
+void
+ColumnarResultReader::writeCSV(ostream& output) const
+{
+    for ( size_t columnID = 0; columnID < columns.size(); columnID++ ) {
+        output << (columnID > 0 ? "," : "") << columns[columnID].name;
+    }
+    output << "\n";
+
+    // Whole chunks at a time, with every row built in one buffer. Most
+    //  columns hold the same value for many rows, so the text of the last
+    //  value of every column is kept and reused.
+    string line;
+    char text[NUMBER_BUFFER_SIZE];
+    vector<uint64_t> lastBits(columns.size());
+    vector<string> lastText(columns.size());
+    for ( size_t chunkID = 0; chunkID < chunks.size(); chunkID++ ) {
+        const Chunk& chunk = chunks[chunkID];
+        for ( uint64_t row = 0; row < chunk.nRows; row++ ) {
+            line.clear();
+            for ( size_t columnID = 0; columnID < columns.size(); columnID++ ) {
+                if ( columnID > 0 ) {
+                    line += ',';
+                }
+                uint64_t bits = readLittleEndian(chunk.data
+                                    + (columnID * chunk.nRows + row) * 8);
+                if ( bits != lastBits[columnID]
+                     || lastText[columnID].empty() ) {
+                    size_t length;
+                    if ( columns[columnID].type == COLUMN_UINT64 ) {
+                        length = snprintf(text, sizeof(text), "%llu",
+                                          (unsigned long long) bits);
+                    }
+                    else {
+                        double rowValue;
+                        memcpy(&rowValue, &bits, sizeof(rowValue));
+                        length = formatShortestNumber(rowValue, text);
+                    }
+                    lastBits[columnID] = bits;
+                    lastText[columnID].assign(text, length);
+                }
+                line += lastText[columnID];
+            }
+            line += '\n';
+            output.write(line.data(), line.size());
+        }
+    }
+}
+
+void
+ColumnarResultReader::writeJSON(ostream& output) const
+{
+    rapidjson::OStreamWrapper outputWrapper(output);
+    rapidjson::Writer<rapidjson::OStreamWrapper> jsonWriter(outputWrapper);
+
+    jsonWriter.StartArray();
+    for ( size_t chunkID = 0; chunkID < chunks.size(); chunkID++ ) {
+        const Chunk& chunk = chunks[chunkID];
+        for ( uint64_t row = 0; row < chunk.nRows; row++ ) {
+            jsonWriter.StartObject();
+            for ( size_t columnID = 0; columnID < columns.size(); columnID++ ) {
+                jsonWriter.Key(columns[columnID].name.c_str());
+                uint64_t bits = readLittleEndian(chunk.data
+                                    + (columnID * chunk.nRows + row) * 8);
+                double rowValue;
+                memcpy(&rowValue, &bits, sizeof(rowValue));
+                if ( columns[columnID].type == COLUMN_UINT64 ) {
+                    jsonWriter.Uint64(bits);
+                }
+                // JSON has no representation for non finite numbers
+                else if ( std::isfinite(rowValue) ) {
+                    jsonWriter.Double(rowValue);
+                }
+                else {
+                    jsonWriter.Null();
+                }
+            }
+            jsonWriter.EndObject();
+        }
+    }
+    jsonWriter.EndArray();
+    output << "\n";
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+// Reader of the binary columnar result files written with -columnar.
+//
+// File layout (all integers and values are little-endian):
+//  - header: the 8 characters "DRSPCOL1", the format version (uint32) and
+//    the number of columns (uint32), followed by every column as its type
+//    (uint32), the length of its name (uint32) and its name, padded with
+//    zeros to a multiple of 8 bytes;
+//  - chunks, up to the end of the file: the number of rows of the chunk
+//    (uint64), followed by the values of every column for those rows, one
+//    column after the other, 8 bytes per value.
+// Every value is therefore 8-byte aligned within the file, so the reader
+//  maps the file and hands out pointers to the column data, without copies.
+#ifndef COLUMNARRESULTREADER_H
+#define COLUMNARRESULTREADER_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "../utils/MappedFile.h"
+
+using namespace std;
+
+#define COLUMNAR_MAGIC "DRSPCOL1"
+#define COLUMNAR_FORMAT_VERSION 1
+
+enum ColumnType { COLUMN_FLOAT64 = 1, COLUMN_UINT64 = 2 };
+
+class ColumnarResultReader
+{
+  public:
+    ColumnarResultReader(const string& fileName);
+
+    struct Column {
+        string name;
+        ColumnType type;
+    };
+    vector<Column> columns;
+
+    struct Chunk {
+        // Row of the file the chunk starts with
+        uint64_t firstRow;
+        uint64_t nRows;
+        // Values of the first column, the others follow
+        const char* data;
+    };
+    vector<Chunk> chunks;
+
+    // Total number of rows
+    uint64_t nRows;
+
+    // Index of the column with the given name, or -1
+    int findColumn(const string& columnName) const;
+
+    // Value of any row and column, converted to double
+    double value(uint64_t row, size_t columnID) const;
+    // Value of any row of a COLUMN_UINT64 column
+    uint64_t uintValue(uint64_t row, size_t columnID) const;
+
+    // Values of a COLUMN_FLOAT64 column within a chunk, pointing straight
+    //  into the mapped file. Only available on little-endian hosts.
+    const double* float64Values(size_t chunkID, size_t columnID) const;
+
+    // Conversions to text formats, with a header line or member names
+    void writeCSV(ostream& output) const;
+    void writeJSON(ostream& output) const;
+
+    static bool isLittleEndianHost();
+    static uint64_t readLittleEndian(const char* bytes);
+
+  private:
+    string fileName;
+    MappedFile file;
+
+    const char* valueAddress(uint64_t row, size_t columnID) const;
+    void throwFormatError(const string& reason) const;
+};
+
+#endif // COLUMNARRESULTREADER_H
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#include "ColumnarResultWriter.h"
+
+#include <cstring>
+#include <unistd.h>
+
+ColumnarResultWriter::ColumnarResultWriter(const string& fileName) :
+    fileName(fileName)
+{
+    addResultColumns();
+    writeHeader();
+}
+
+ColumnarResultWriter::ColumnarResultWriter(
+        const string& fileName,
+        const vector<ColumnarResultReader::Column>& columns) :
+    columns(columns),
+    fileName(fileName)
+{
+    writeHeader();
+}
+
+ColumnarResultWriter::ColumnarResultWriter(const string& fileName,
+                                           uint64_t resumedFileSize) :
+    fileName(fileName)
+{
+    addResultColumns();
+    chunkColumns.resize(columns.size());
+
+    if ( truncate(fileName.c_str(), resumedFileSize) == 0 ) {
+        resultFile.open(fileName, ofstream::binary | ofstream::app);
+    }
+    if ( resultFile.is_open() == false ) {
+        string exceptionMsgThrown;
+        exceptionMsgThrown.append("[ERROR] ");
+        exceptionMsgThrown.append("Could not resume columnar result file: ");
+        exceptionMsgThrown.append(fileName);
+        exceptionMsgThrown.append("!\n");
+        throw exceptionMsgThrown;
+    }
+    fileSize = resumedFileSize;
+}
+
+void
+ColumnarResultWriter::addResultColumns()
+{
+    ColumnarResultReader::Column column;
+    column.name = "configuration";
+    column.type = COLUMN_UINT64;
+    columns.push_back(column);
+    column.type = COLUMN_FLOAT64;
+#define ADD_COLUMN(fieldName) \
+    column.name = #fieldName; \
+    columns.push_back(column);
+    DRAMSPEC_RESULT_FIELDS(ADD_COLUMN)
+#undef ADD_COLUMN
+}
+
+void
+ColumnarResultWriter::writeHeader()
+{
+    chunkColumns.resize(columns.size());
+
+    resultFile.open(fileName, ofstream::binary | ofstream::trunc);
+    if ( resultFile.is_open() == false ) {
+        string exceptionMsgThrown;
+        exceptionMsgThrown.append("[ERROR] ");
+        exceptionMsgThrown.append("Could not create columnar result file: ");
+        exceptionMsgThrown.append(fileName);
+        exceptionMsgThrown.append("!\n");
+        throw exceptionMsgThrown;
+    }
+
+    string header(COLUMNAR_MAGIC);
+    appendLittleEndian(header, COLUMNAR_FORMAT_VERSION
+                               | (uint64_t) columns.size() << 32);
+    for ( const ColumnarResultReader::Column& column : columns ) {
+        appendLittleEndian(header, column.type
+                                   | (uint64_t) column.name.size() << 32);
+        header.append(column.name);
+        header.append((8 - column.name.size() % 8) % 8, '\0');
+    }
+    resultFile.write(header.data(), header.size());
+    fileSize = header.size();
+}
+
+ColumnarResultWriter::~ColumnarResultWriter()
+{
+    try {
+        close();
+    } catch(string exceptionMsgThrown) {
+        // Only reported when close() is called explicitly
+    }
+}
+
+void
+ColumnarResultWriter::append(uint64_t configuration, const Current& dram)
+{
+    size_t columnID = 0;
+    chunkColumns[columnID++].push_back(configuration);
+#define APPEND_FIELD(fieldName) \
+    { \
+        double fieldValue = resultFieldValue(dram.fieldName); \
+        uint64_t fieldBits; \
+        memcpy(&fieldBits, &fieldValue, sizeof(fieldBits)); \
+        chunkColumns[columnID++].push_back(fieldBits); \
+    }
+    DRAMSPEC_RESULT_FIELDS(APPEND_FIELD)
+#undef APPEND_FIELD
+
+    if ( chunkColumns[0].size() == chunkSize ) {
+        writeChunk();
+    }
+}
+
+void
+ColumnarResultWriter::appendRow(const uint64_t* rowValues)
+{
+    for ( size_t columnID = 0; columnID < columns.size(); columnID++ ) {
+        chunkColumns[columnID].push_back(rowValues[columnID]);
+    }
+
+    if ( chunkColumns[0].size() == chunkSize ) {
+        writeChunk();
+    }
+}
+
+uint64_t
+ColumnarResultWriter::flush()
+{
+    writeChunk();
+    resultFile.flush();
+    if ( resultFile.fail() ) {
+        throwWriteError();
+    }
+    return fileSize;
+}
+
+void
+ColumnarResultWriter::close()
+{
+    if ( resultFile.is_open() == false ) {
+        return;
+    }
+    writeChunk();
+    resultFile.close();
+    if ( resultFile.fail() ) {
+        throwWriteError();
+    }
+}
+
+void
+ColumnarResultWriter::throwWriteError() const
+{
+    string exceptionMsgThrown;
+    exceptionMsgThrown.append("[ERROR] ");
+    exceptionMsgThrown.append("Could not write columnar result file: ");
+    exceptionMsgThrown.append(fileName);
+    exceptionMsgThrown.append("!\n");
+    throw exceptionMsgThrown;
+}
+
+void
+ColumnarResultWriter::writeChunk()
+{
+    uint64_t nRows = chunkColumns[0].size();
+    if ( nRows == 0 ) {
+        return;
+    }
+
+    string chunk;
+    chunk.reserve(8 + nRows * 8 * chunkColumns.size());
+    appendLittleEndian(chunk, nRows);
+    for ( vector<uint64_t>& column : chunkColumns ) {
+        for ( uint64_t columnValue : column ) {
+            appendLittleEndian(chunk, columnValue);
+        }
+        column.clear();
+    }
+    resultFile.write(chunk.data(), chunk.size());
+    fileSize += chunk.size();
+}
+
+void
+ColumnarResultWriter::appendLittleEndian(string& buffer, uint64_t value)
+{
+    for ( int byteID = 0; byteID < 8; byteID++ ) {
+        buffer.push_back(static_cast<char>(value >> (8 * byteID)));
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+// Writer of the binary columnar result files (see ColumnarResultReader.h
+//  for the layout). It has a column with the number of the configuration
+//  and a column for every result field (ResultFields.h), unless other
+//  columns are given. Rows are kept in memory and written one chunk at a
+//  time.
+#ifndef COLUMNARRESULTWRITER_H
+#define COLUMNARRESULTWRITER_H
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "ColumnarResultReader.h"
+#include "ResultFields.h"
+
+using namespace std;
+
+class ColumnarResultWriter
+{
+  public:
+    ColumnarResultWriter(const string& fileName);
+    ColumnarResultWriter(const string& fileName,
+                         const vector<ColumnarResultReader::Column>& columns);
+    // Goes on with a result file written up to resumedFileSize (a size
+    //  returned by flush()). Anything written after it is dropped.
+    ColumnarResultWriter(const string& fileName, uint64_t resumedFileSize);
+    ~ColumnarResultWriter();
+
+    void append(uint64_t configuration, const Current& dram);
+    // Appends a row given as the raw 8 bytes of every column
+    void appendRow(const uint64_t* rowValues);
+
+    // Writes the rows not written yet, and returns the size of the file
+    uint64_t flush();
+
+    // Writes the rows not written yet and closes the file
+    void close();
+
+    // Number of rows per chunk
+    static const size_t chunkSize = 4096;
+
+    vector<ColumnarResultReader::Column> columns;
+
+  private:
+    string fileName;
+    ofstream resultFile;
+    uint64_t fileSize;
+    // Values of the current chunk, column after column
+    vector< vector<uint64_t> > chunkColumns;
+
+    void addResultColumns();
+    void writeHeader();
+    void throwWriteError() const;
+    void writeChunk();
+    static void appendLittleEndian(string& buffer, uint64_t value);
+};
+
+#endif // COLUMNARRESULTWRITER_H
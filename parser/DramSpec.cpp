@@ -40,158 +40,169 @@
 
 #include "DramSpec.h"
 
+#include <cstring>
+
 using namespace std;
 
+const int DRAMSpec::checkpointInterval;
+
 DRAMSpec::DRAMSpec(int argc, char** argv)
+    : output(cout)
 {
     runDramSpec(argc, argv);
 }
 
+namespace {
+
+// The result files are written with a SAX writer, straight into a buffered
+//  file stream, without building a document first.
+template<class JSONWriter>
+void writeTimingNsResult(JSONWriter& writer, const Current& dram)
+{
+    writer.StartObject();
+    writer.Key("trcd");     writer.Double(dram.trcd.value());
+    writer.Key("tcl");      writer.Double(dram.tcas.value());
+    writer.Key("tras");     writer.Double(dram.tras.value());
+    writer.Key("trp");      writer.Double(dram.trp.value());
+    writer.Key("trc");      writer.Double(dram.trc.value());
+    writer.Key("trl");      writer.Double(dram.trl.value());
+    writer.Key("trtp");     writer.Double(dram.trtp.value());
+    writer.Key("tccd");     writer.Double(dram.tccd.value());
+    writer.Key("twr");      writer.Double(dram.twr.value());
+    writer.Key("trfc");     writer.Double(dram.trfc.value());
+    writer.Key("trefI");    writer.Double(dram.trefI.value());
+    writer.EndObject();
+}
+
+template<class JSONWriter>
+void writeTimingResult(JSONWriter& writer, const Current& dram)
+{
+    writer.StartObject();
+    writer.Key("Frequency");    writer.Double(dram.dramFreq.value());
+    writer.Key("trcd_cc");      writer.Double(dram.trcd_clk.value());
+    writer.Key("tcl_cc");       writer.Double(dram.tcas_clk.value());
+    writer.Key("tras_cc");      writer.Double(dram.tras_clk.value());
+    writer.Key("trp_cc");       writer.Double(dram.trp_clk.value());
+    writer.Key("trc_cc");       writer.Double(dram.trc_clk.value());
+    writer.Key("trl_cc");       writer.Double(dram.trl_clk.value());
+    writer.Key("twl_cc");       writer.Double(dram.twl_clk.value());
+    writer.Key("trtp_cc");      writer.Double(dram.trtp_clk.value());
+    writer.Key("tccd_cc");      writer.Double(dram.tccd_clk.value());
+    writer.Key("twr_cc");       writer.Double(dram.twr_clk.value());
+    writer.Key("trfc_cc");      writer.Double(dram.trfc_clk.value());
+    writer.Key("trefI_cc");     writer.Double(dram.trefI_clk.value());
+    writer.EndObject();
+}
+
+template<class JSONWriter>
+void writeCurrentResult(JSONWriter& writer, const Current& dram)
+{
+    writer.StartObject();
+    writer.Key("IDD0");     writer.Double(dram.IDD0.value());
+    writer.Key("IPP0");     writer.Double(dram.IPP0.value());
+    writer.Key("IDD1");     writer.Double(dram.IDD1.value());
+    writer.Key("IPP1");     writer.Double(dram.IPP0.value());
+    writer.Key("IDD4R");    writer.Double(dram.IDD4R.value());
+    writer.Key("IDD4W");    writer.Double(dram.IDD4W.value());
+    writer.Key("IDD2n");    writer.Double(dram.IDD2n.value());
+    writer.Key("IDD3n");    writer.Double(dram.IDD3n.value());
+    writer.Key("IPP3n");    writer.Double(dram.IPP3n.value());
+    writer.Key("Rho");      writer.Double(dram.rho);
+    writer.Key("IDD5B");    writer.Double(dram.IDD5b.value());
+    writer.Key("IPP5B");    writer.Double(dram.IPP5b.value());
+    writer.EndObject();
+}
+
+// Writes one result file (e.g. currentresult_3.json), using buffer
+template<class JSONWriter>
+void writeJSONResultFile(const string& resultName,
+                         int dramConfigID,
+                         void (*writeResult)(JSONWriter&, const Current&),
+                         const Current& dram,
+                         vector<char>& buffer)
+{
+    string fileName(resultName);
+    fileName.append("_");
+    fileName.append(to_string(dramConfigID));
+    fileName.append(".json");
+
+    FILE* resultFile = fopen(fileName.c_str(), "wb");
+    if ( resultFile == NULL ) {
+        return;
+    }
+    rapidjson::FileWriteStream resultStream(resultFile,
+                                            buffer.data(), buffer.size());
+    JSONWriter writer(resultStream);
+    writeResult(writer, dram);
+    resultStream.Flush();
+    fclose(resultFile);
+}
+
+template<class JSONWriter>
+void writeJSONResultFiles(int dramConfigID,
+                          const Current& dram,
+                          vector<char>& buffer)
+{
+    writeJSONResultFile<JSONWriter>("timingnsresult", dramConfigID,
+                                    writeTimingNsResult<JSONWriter>,
+                                    dram, buffer);
+    writeJSONResultFile<JSONWriter>("timingresult", dramConfigID,
+                                    writeTimingResult<JSONWriter>,
+                                    dram, buffer);
+    writeJSONResultFile<JSONWriter>("currentresult", dramConfigID,
+                                    writeCurrentResult<JSONWriter>,
+                                    dram, buffer);
+}
+
+}
+
 //function for writing results in json
 void
 DRAMSpec::jsonOutputWrite(int dramConfigID)
 {
-    //parsing the timing results in ns
-    rapidjson::Document timingnsdoc;
-    timingnsdoc.SetObject();
-
-    timingnsdoc.AddMember(
-          "trcd",   dram->trcd.value(),   timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "tcl",    dram->tcas.value(),   timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "tras",   dram->tras.value(),   timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "trp",    dram->trp.value(),    timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "trc",    dram->trc.value(),    timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "trl",    dram->trl.value(),    timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "trtp",   dram->trtp.value(),   timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "tccd",   dram->tccd.value(),   timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "twr",    dram->twr.value(),    timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "trfc",   dram->trfc.value(),   timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "trefI",  dram->trefI.value(),  timingnsdoc.GetAllocator());
-
-    // Convert JSON document to string
-    rapidjson::GenericStringBuffer< rapidjson::UTF8<> > timingnsbuffer;
-    rapidjson::Writer< rapidjson::GenericStringBuffer<
-    rapidjson::UTF8<> > > timingnswriter(timingnsbuffer);
-    timingnsdoc.Accept(timingnswriter);
-    const char* timingnsstr = timingnsbuffer.GetString();
-
-    //open a file
-    stringstream timingnsresstr;
-    timingnsresstr << string("timingnsresult_")
-                   << dramConfigID
-                   << string(".json");
-    ofstream timingnsresultfile(timingnsresstr.str().c_str());
-    timingnsresultfile << timingnsstr;
-    timingnsresultfile.close();
-
-    //parsing the timing results in clock cycles
-    rapidjson::Document timingsDoc;
-    timingsDoc.SetObject();
-
-    timingsDoc.AddMember(
-          "Frequency",  dram->dramFreq.value(),   timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "trcd_cc",    dram->trcd_clk.value() ,  timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "tcl_cc",     dram->tcas_clk.value() ,  timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "tras_cc",    dram->tras_clk.value() ,  timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "trp_cc",     dram->trp_clk.value() ,   timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "trc_cc",     dram->trc_clk.value() ,   timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "trl_cc",     dram->trl_clk.value() ,   timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "twl_cc",     dram->twl_clk.value() ,   timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "trtp_cc",    dram->trtp_clk.value() ,  timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "tccd_cc",    dram->tccd_clk.value() ,  timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "twr_cc",     dram->twr_clk.value() ,   timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "trfc_cc",    dram->trfc_clk.value() ,  timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "trefI_cc",   dram->trefI_clk.value() , timingsDoc.GetAllocator());
-
-    // Convert JSON document to string
-    rapidjson::GenericStringBuffer< rapidjson::UTF8<> > timingbuffer;
-    rapidjson::Writer< rapidjson::GenericStringBuffer<
-    rapidjson::UTF8<> > > timingwriter(timingbuffer);
-    timingsDoc.Accept(timingwriter);
-    const char* timingstr = timingbuffer.GetString();
-
-    //Placing timing results (in clock cycles) in different files according to file number
-    stringstream timingresstr;
-    timingresstr << string("timingresult_")
-                 << dramConfigID
-                 << string(".json");
-    ofstream timingresultfile(timingresstr.str().c_str());
-    timingresultfile << timingstr;
-    timingresultfile.close();
-
-    //parsing the currents
-    rapidjson::Document currentdoc;
-    currentdoc.SetObject();
-
-    currentdoc.AddMember(
-          "IDD0",   dram->IDD0.value(),   currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IPP0",   dram->IPP0.value(),   currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IDD1",   dram->IDD1.value(),   currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IPP1",   dram->IPP0.value(),   currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IDD4R",  dram->IDD4R.value(),  currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IDD4W",  dram->IDD4W.value(),  currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IDD2n",  dram->IDD2n.value(),  currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IDD3n",  dram->IDD3n.value(),  currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IPP3n",  dram->IPP3n.value(),  currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "Rho",    dram->rho,            currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IDD5B",  dram->IDD5b.value(),  currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IPP5B",  dram->IPP5b.value(),  currentdoc.GetAllocator());
-
-    //convert JSON document to string
-    rapidjson::GenericStringBuffer< rapidjson::UTF8<> > currentbuffer;
-    rapidjson::Writer< rapidjson::GenericStringBuffer
-    < rapidjson::UTF8<> > > currentwriter(currentbuffer);
-    currentdoc.Accept(currentwriter);
-    const char* currentstr = currentbuffer.GetString();
-
-    //Placing current results in different files according to file number
-    stringstream currentresstr;
-    currentresstr << string("currentresult_")
-                  << dramConfigID
-                  << string(".json");
-    ofstream currentresultfile(currentresstr.str().c_str());
-    currentresultfile << currentstr;
-    currentresultfile.close();
+    // The same buffer is used for every file of the run
+    if ( jsonOutputBuffer.empty() ) {
+        jsonOutputBuffer.resize(64 * 1024);
+    }
+
+    if ( arg->prettyJSONFlag ) {
+        writeJSONResultFiles< rapidjson::PrettyWriter<
+                rapidjson::FileWriteStream > >(dramConfigID, *dram,
+                                               jsonOutputBuffer);
+    }
+    else {
+        writeJSONResultFiles< rapidjson::Writer<
+                rapidjson::FileWriteStream > >(dramConfigID, *dram,
+                                               jsonOutputBuffer);
+    }
+}
+
+namespace {
+
+// Line of a result table, the label padded to lineWidth
+void appendTableLine(string& resultTable,
+                     const char* label,
+                     size_t lineWidth,
+                     const string& separator,
+                     double value)
+{
+    size_t labelLength = strlen(label);
+    resultTable.append(label, labelLength);
+    if ( labelLength < lineWidth ) {
+        resultTable.append(lineWidth - labelLength, ' ');
+    }
+    resultTable.append(separator);
+    appendNumber(resultTable, value);
+    resultTable.push_back('\n');
+}
+
 }
 
 //function for writing results in csv file or cout
-string
-DRAMSpec::arrangeOutput(const string outputType)
+void
+DRAMSpec::arrangeOutput(const string outputType, string& resultTable)
 {
-    int lineWidth;
+    size_t lineWidth;
     string separator;
     // If outputing to csv file, keep the lines as short as possible
     //  and add a comma separator between label and value
@@ -210,65 +221,61 @@ DRAMSpec::arrangeOutput(const string outputType)
         throw exceptionMsgThrown;
     }
 
-    ostringstream resultTable;
-
-    resultTable
-    << BUILD_LINE("DRAM frequency       [MHz]",   dram->dramFreq.value())
-    << BUILD_LINE("Core frequency       [MHz]",   dram->dramCoreFreq.value())
-    << BUILD_LINE("Max core frequency   [MHz]",   dram->maxCoreFreq.value())
-
-    << BUILD_LINE("tRCD                 [ns]",    dram->trcd.value())
-    << BUILD_LINE("tCL (tCAS)           [ns]",    dram->tcas.value())
-    << BUILD_LINE("tRAS                 [ns]",    dram->tras.value())
-    << BUILD_LINE("tRP                  [ns]",    dram->trp.value())
-    << BUILD_LINE("tRC                  [ns]",    dram->trc.value())
-    << BUILD_LINE("tRL                  [ns]",    dram->trl.value())
-    << BUILD_LINE("tRTP                 [ns]",    dram->trtp.value())
-    << BUILD_LINE("tCCD                 [ns]",    dram->tccd.value())
-    << BUILD_LINE("tWR                  [ns]",    dram->twr.value())
-    << BUILD_LINE("tRFC                 [ns]",    dram->trfc.value())
-    << BUILD_LINE("tREFI                [ns]",    dram->trefI.value())
-
-    << BUILD_LINE("tRCD                 [cc]",    dram->trcd_clk.value())
-    << BUILD_LINE("tCL (tCAS)           [cc]",    dram->tcas_clk.value())
-    << BUILD_LINE("Core tCL             [cc]",    dram->tcas_coreClk.value())
-    << BUILD_LINE("tRAS                 [cc]",    dram->tras_clk.value())
-    << BUILD_LINE("tRP                  [cc]",    dram->trp_clk.value())
-    << BUILD_LINE("tRC                  [cc]",    dram->trc_clk.value())
-    << BUILD_LINE("tRL                  [cc]",    dram->trl_clk.value())
-    << BUILD_LINE("Core tRL             [cc]",    dram->trl_coreClk.value())
-    << BUILD_LINE("tRTP                 [cc]",    dram->trtp_clk.value())
-    << BUILD_LINE("tCCD                 [cc]",    dram->tccd_clk.value())
-    << BUILD_LINE("Core tCCD            [cc]",    dram->tccd_coreClk.value())
-    << BUILD_LINE("tWR                  [cc]",    dram->twr_clk.value())
-    << BUILD_LINE("tRFC                 [cc]",    dram->trfc_clk.value())
-    << BUILD_LINE("tREFI                [cc]",    dram->trefI_clk.value())
-
-    << BUILD_LINE("IDD0                 [mA]",    dram->IDD0.value())
-    << BUILD_LINE("IPP0                 [mA]",    dram->IPP0.value())
-    << BUILD_LINE("IDD1                 [mA]",    dram->IDD1.value())
-    << BUILD_LINE("IPP1                 [mA]",    dram->IPP1.value())
-    << BUILD_LINE("IDD2N                [mA]",    dram->IDD2n.value())
-    << BUILD_LINE("IDD3N                [mA]",    dram->IDD3n.value())
-    << BUILD_LINE("IPP3N                [mA]",    dram->IPP3n.value())
-    << BUILD_LINE("Rho                  []  ",    dram->rho)
-    << BUILD_LINE("IDD4R                [mA]",    dram->IDD4R.value())
-    << BUILD_LINE("IDD4W                [mA]",    dram->IDD4W.value())
-    << BUILD_LINE("IDD5B                [mA]",    dram->IDD5b.value())
-    << BUILD_LINE("IPP5B                [mA]",    dram->IPP5b.value())
-
-    << BUILD_LINE("Subarray height      [um]",    dram->subArrayHeight.value())
-    << BUILD_LINE("Subarray width       [um]",    dram->subArrayWidth.value())
-    << BUILD_LINE("Tile height          [um]",    dram->tileHeight.value())
-    << BUILD_LINE("Tile width           [um]",    dram->tileWidth.value())
-    << BUILD_LINE("Bank height          [um]",    dram->bankHeight.value())
-    << BUILD_LINE("Bank width           [um]",    dram->bankWidth.value())
-    << BUILD_LINE("Channel height       [um]",    dram->channelHeight.value())
-    << BUILD_LINE("Channel width        [um]",    dram->channelWidth.value())
-    << BUILD_LINE("Channel area       [(mm)^2]",  dram->channelArea.value())
-    ;
-
-    return resultTable.str();
+    resultTable.clear();
+
+    BUILD_LINE("DRAM frequency       [MHz]",   dram->dramFreq.value());
+    BUILD_LINE("Core frequency       [MHz]",   dram->dramCoreFreq.value());
+    BUILD_LINE("Max core frequency   [MHz]",   dram->maxCoreFreq.value());
+
+    BUILD_LINE("tRCD                 [ns]",    dram->trcd.value());
+    BUILD_LINE("tCL (tCAS)           [ns]",    dram->tcas.value());
+    BUILD_LINE("tRAS                 [ns]",    dram->tras.value());
+    BUILD_LINE("tRP                  [ns]",    dram->trp.value());
+    BUILD_LINE("tRC                  [ns]",    dram->trc.value());
+    BUILD_LINE("tRL                  [ns]",    dram->trl.value());
+    BUILD_LINE("tRTP                 [ns]",    dram->trtp.value());
+    BUILD_LINE("tCCD                 [ns]",    dram->tccd.value());
+    BUILD_LINE("tWR                  [ns]",    dram->twr.value());
+    BUILD_LINE("tRFC                 [ns]",    dram->trfc.value());
+    BUILD_LINE("tREFI                [ns]",    dram->trefI.value());
+
+    BUILD_LINE("tRCD                 [cc]",    dram->trcd_clk.value());
+    BUILD_LINE("tCL (tCAS)           [cc]",    dram->tcas_clk.value());
+    BUILD_LINE("Core tCL             [cc]",    dram->tcas_coreClk.value());
+    BUILD_LINE("tRAS                 [cc]",    dram->tras_clk.value());
+    BUILD_LINE("tRP                  [cc]",    dram->trp_clk.value());
+    BUILD_LINE("tRC                  [cc]",    dram->trc_clk.value());
+    BUILD_LINE("tRL                  [cc]",    dram->trl_clk.value());
+    BUILD_LINE("Core tRL             [cc]",    dram->trl_coreClk.value());
+    BUILD_LINE("tRTP                 [cc]",    dram->trtp_clk.value());
+    BUILD_LINE("tCCD                 [cc]",    dram->tccd_clk.value());
+    BUILD_LINE("Core tCCD            [cc]",    dram->tccd_coreClk.value());
+    BUILD_LINE("tWR                  [cc]",    dram->twr_clk.value());
+    BUILD_LINE("tRFC                 [cc]",    dram->trfc_clk.value());
+    BUILD_LINE("tREFI                [cc]",    dram->trefI_clk.value());
+
+    BUILD_LINE("IDD0                 [mA]",    dram->IDD0.value());
+    BUILD_LINE("IPP0                 [mA]",    dram->IPP0.value());
+    BUILD_LINE("IDD1                 [mA]",    dram->IDD1.value());
+    BUILD_LINE("IPP1                 [mA]",    dram->IPP1.value());
+    BUILD_LINE("IDD2N                [mA]",    dram->IDD2n.value());
+    BUILD_LINE("IDD3N                [mA]",    dram->IDD3n.value());
+    BUILD_LINE("IPP3N                [mA]",    dram->IPP3n.value());
+    BUILD_LINE("Rho                  []  ",    dram->rho);
+    BUILD_LINE("IDD4R                [mA]",    dram->IDD4R.value());
+    BUILD_LINE("IDD4W                [mA]",    dram->IDD4W.value());
+    BUILD_LINE("IDD5B                [mA]",    dram->IDD5b.value());
+    BUILD_LINE("IPP5B                [mA]",    dram->IPP5b.value());
+
+    BUILD_LINE("Subarray height      [um]",    dram->subArrayHeight.value());
+    BUILD_LINE("Subarray width       [um]",    dram->subArrayWidth.value());
+    BUILD_LINE("Tile height          [um]",    dram->tileHeight.value());
+    BUILD_LINE("Tile width           [um]",    dram->tileWidth.value());
+    BUILD_LINE("Bank height          [um]",    dram->bankHeight.value());
+    BUILD_LINE("Bank width           [um]",    dram->bankWidth.value());
+    BUILD_LINE("Channel height       [um]",    dram->channelHeight.value());
+    BUILD_LINE("Channel width        [um]",    dram->channelWidth.value());
+    BUILD_LINE("Channel area       [(mm)^2]",  dram->channelArea.value());
 }
 
 void DRAMSpec::runDramSpec(int argc, char** argv)
@@ -286,70 +293,1040 @@ void DRAMSpec::runDramSpec(int argc, char** argv)
         return;
     }
 
+    resultCache = NULL;
+    if ( !arg->cacheDirectory.empty() ) {
+        try {
+            resultCache = new ResultCache(arg->cacheDirectory);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+
+    // Results of a stream go straight to the standard output, as they come
+    if ( arg->streamMode ) {
+        StreamProcessor streamProcessor(*arg, resultCache);
+        streamProcessor.progress = &progress;
+        try {
+            progress.start(arg->progressFlag, arg->statusFileName,
+                           arg->metricsPort);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+        streamProcessor.run(cin, cout);
+        progress.stop("finished");
+        return;
+    }
+
     output << "_______________________________________________________"
            << "_______________________________________________________"
            << "_______________________________________________________"
            << endl;
 
-    //Loop through all the corresponding inputs (arch and tech files)
-    // and fill the array to print in a clean layout
-    for(unsigned int configID = 0; configID < arg->nConfigurations; configID++)
-    {
+    // A resumed run skips the configurations written before it stopped
+    nResumedConfigurations = 0;
+    nResumedEvaluations = 0;
+    nWrittenEvaluations = 0;
+    uint64_t resumedColumnarFileSize = 0;
+    writtenSweepsHash = hashString("");
+    nextWrittenFilesID = 0;
+    sweepSizesHash = hashString("");
+    if ( !arg->checkpointFileName.empty() ) {
+        checkpoint.arguments = arg->runArguments();
+        checkpoint.filePairsHash = arg->filePairsHash();
+        RunCheckpoint resumedCheckpoint;
+        bool isCheckpointFound = false;
+        if ( arg->isResumed ) {
+            try {
+                isCheckpointFound = resumedCheckpoint.read(
+                                        arg->checkpointFileName);
+            } catch(string exceptionMsgThrown) {
+                throw exceptionMsgThrown;
+            }
+        }
+        // Without a checkpoint, the run starts from the beginning
+        if ( isCheckpointFound ) {
+            if ( resumedCheckpoint.version != checkpoint.version
+                 || resumedCheckpoint.arguments != checkpoint.arguments
+                 || resumedCheckpoint.filePairsHash
+                    != checkpoint.filePairsHash ) {
+                string exceptionMsgThrown("[ERROR] ");
+                exceptionMsgThrown.append("Checkpoint ");
+                exceptionMsgThrown.append(arg->checkpointFileName);
+                exceptionMsgThrown.append(" was saved by another run!\n");
+                throw exceptionMsgThrown;
+            }
+            nResumedConfigurations = resumedCheckpoint.nWrittenConfigurations;
+            nResumedEvaluations = resumedCheckpoint.nEvaluatedConfigurations;
+            resumedColumnarFileSize = resumedCheckpoint.columnarFileSize;
+            resumedWrittenSweepsHash = resumedCheckpoint.writtenSweepsHash;
+            output << "Resuming from checkpoint "
+                   << arg->checkpointFileName << ": "
+                   << nResumedConfigurations
+                   << " configurations already written." << endl;
+        }
+        lastCheckpointTime = chrono::steady_clock::now();
+    }
+
+    columnarWriter = NULL;
+    if ( !arg->columnarFileName.empty() ) {
+        try {
+            if ( resumedColumnarFileSize > 0 ) {
+                columnarWriter = new ColumnarResultWriter(
+                            arg->columnarFileName, resumedColumnarFileSize);
+            }
+            else {
+                columnarWriter = new ColumnarResultWriter(
+                            arg->columnarFileName);
+            }
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+
+    shardManifest = NULL;
+    if ( arg->nShards > 0 ) {
+        shardManifest = new ShardManifest();
+        shardManifest->shardID = arg->shardID;
+        shardManifest->nShards = arg->nShards;
+        shardManifest->columnarFileName = arg->columnarFileName;
+        vector<string> runArguments = arg->runArguments();
+        for ( size_t argID = 0; argID < runArguments.size(); argID++ ) {
+            if ( runArguments[argID] == "--shard" ) {
+                argID++;
+                continue;
+            }
+            shardManifest->arguments.push_back(runArguments[argID]);
+        }
+        shardManifest->filePairsHash = arg->filePairsHash();
+    }
+    nRunConfigurations = 0;
+
+    // The trace does not depend on the configuration, so it is read once
+    traceActivity = NULL;
+    if ( !arg->energyTraceFileName.empty() ) {
+        traceActivity = new TraceActivity();
+        try {
+            traceActivity->read(arg->energyTraceFileName);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+
+    workloadProfiles = NULL;
+    if ( !arg->workloadFileName.empty() ) {
+        workloadProfiles = new WorkloadProfiles();
+        try {
+            workloadProfiles->read(arg->workloadFileName);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+
+    temperatureLog = NULL;
+    if ( !arg->temperatureLogFileName.empty() ) {
+        temperatureLog = new TemperatureLog();
+        try {
+            temperatureLog->read(arg->temperatureLogFileName);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+
+    progress.setFiles(arg->nConfigurations);
+    try {
+        progress.start(arg->progressFlag, arg->statusFileName,
+                       arg->metricsPort);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    nThreads = arg->nThreads;
+    if ( nThreads == 0 ) {
+        nThreads = max(thread::hardware_concurrency(), 1u);
+    }
+
+    nReadConfigurations = 0;
+    BoundedQueue<Configuration*> computeQueue(2*nThreads);
+    BoundedQueue<Configuration*> writeQueue(2*nThreads);
+    isStopped = false;
+
+    // The writer input is closed by the last stage thread to finish
+    atomic<unsigned int> nRunningStages(nThreads + 1);
+    auto stageFinished = [&]() {
+        if ( --nRunningStages == 0 ) {
+            writeQueue.close();
+        }
+    };
+
+    vector<thread> stages;
+    stages.push_back(thread([&]() {
+        readConfigurations(computeQueue, writeQueue);
+        computeQueue.close();
+        stageFinished();
+    }));
+    for ( unsigned int threadID = 0; threadID < nThreads; threadID++ ) {
+        stages.push_back(thread([&]() {
+            computeConfigurations(computeQueue, writeQueue);
+            stageFinished();
+        }));
+    }
+
+    auto stopStages = [&]() {
+        isStopped = true;
+        computeQueue.close();
+        writeQueue.close();
+        for ( thread& stage : stages ) {
+            stage.join();
+        }
+        // The results written so far are kept, but without a manifest
+        //  the shard is incomplete
+        delete columnarWriter;
+        columnarWriter = NULL;
+        delete shardManifest;
+        shardManifest = NULL;
+        progress.stop("failed");
+    };
+
+    // Configurations are computed in any order, but they are written
+    //  (and an error reported) as if they had been evaluated one after
+    //  the other
+    map<unsigned int, Configuration*> finishedConfigurations;
+    unsigned int nextPosition = 0;
+    Configuration * finished;
+    while ( writeQueue.pop(finished) ) {
+        finishedConfigurations[finished->position] = finished;
+
+        map<unsigned int, Configuration*>::iterator next;
+        while ( (next = finishedConfigurations.find(nextPosition))
+                != finishedConfigurations.end() )
+        {
+            // Freed at the end of this iteration, once it is written
+            unique_ptr<Configuration> writtenConfiguration(next->second);
+            Configuration& configuration = *writtenConfiguration;
+            finishedConfigurations.erase(next);
+            nextPosition++;
+
+            if ( !configuration.error.empty() ) {
+                progress.addError();
+                // The configurations before this one are done
+                if ( !arg->checkpointFileName.empty() ) {
+                    try {
+                        saveCheckpoint(nextPosition - 1, false);
+                    } catch(string exceptionMsgThrown) {
+                        // The error of the configuration is reported
+                    }
+                }
+                stopStages();
+                throw configuration.error;
+            }
+
+            if ( configuration.filesID >= nextWrittenFilesID ) {
+                writtenSweepsHash = addSweepSize(writtenSweepsHash,
+                                                 configuration.filesID,
+                                                 configuration.nFilePoints);
+                nextWrittenFilesID = configuration.filesID + 1;
+            }
+
+            // Results written before the run was resumed are only listed
+            if ( configuration.isDone ) {
+                addShardManifestEntry(configuration);
+                progress.addDone(true);
+                if ( nextPosition == nResumedConfigurations
+                     && writtenSweepsHash != resumedWrittenSweepsHash ) {
+                    stopStages();
+                    string exceptionMsgThrown("[ERROR] ");
+                    exceptionMsgThrown.append("Input files of checkpoint ");
+                    exceptionMsgThrown.append(arg->checkpointFileName);
+                    exceptionMsgThrown.append(
+                                " changed since it was saved!\n");
+                    throw exceptionMsgThrown;
+                }
+                continue;
+            }
+
+            // The results of a reused configuration come from an earlier
+            //  one, so they are calculated by now
+            if ( !configuration.isReused ) {
+                nWrittenEvaluations++;
+            }
+
+            try {
+                RunProgress::StageTimer writeTimer(&progress,
+                                                   RunProgress::STAGE_WRITE);
+                writeConfiguration(configuration);
+                if ( !arg->checkpointFileName.empty()
+                     && chrono::steady_clock::now() - lastCheckpointTime
+                        >= chrono::seconds(checkpointInterval) ) {
+                    saveCheckpoint(nextPosition, false);
+                }
+            } catch(string exceptionMsgThrown) {
+                stopStages();
+                throw exceptionMsgThrown;
+            }
+            progress.addDone();
+        }
+    }
+    for ( thread& stage : stages ) {
+        stage.join();
+    }
+
+    // The run has fewer configurations than were written before the resume
+    if ( nextPosition < nResumedConfigurations ) {
+        progress.stop("failed");
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Input files of checkpoint ");
+        exceptionMsgThrown.append(arg->checkpointFileName);
+        exceptionMsgThrown.append(" changed since it was saved!\n");
+        throw exceptionMsgThrown;
+    }
+
+    if ( !arg->checkpointFileName.empty() ) {
+        try {
+            saveCheckpoint(nextPosition, true);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+
+    if ( columnarWriter != NULL ) {
+        try {
+            columnarWriter->close();
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+
+    if ( shardManifest != NULL ) {
+        shardManifest->nRunConfigurations = nRunConfigurations;
+        shardManifest->sweepSizesHash = sweepSizesHash;
+        string manifestFileName = ShardManifest::manifestFileName(
+                                        arg->shardID, arg->nShards);
+        try {
+            shardManifest->write(manifestFileName);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+        output << "Shard " << arg->shardID << " of " << arg->nShards
+               << ": " << nReadConfigurations << " of "
+               << nRunConfigurations << " configurations evaluated, "
+               << "listed in " << manifestFileName << endl;
+        delete shardManifest;
+        shardManifest = NULL;
+    }
+
+    if ( nReadConfigurations > 1 ) {
+        // Configurations written before a resume are not deduplicated
+        //  against the later ones
+        unsigned int nEvaluated = evaluations.size() + nResumedEvaluations;
+        ostringstream dedupRatio;
+        dedupRatio << fixed << setprecision(2)
+                   << (double) nReadConfigurations
+                      / nEvaluated;
+        output << "Unique configurations evaluated: "
+               << nEvaluated
+               << " of "
+               << nReadConfigurations
+               << " (deduplication ratio "
+               << dedupRatio.str()
+               << ")"
+               << endl;
+    }
+
+    delete traceActivity;
+    traceActivity = NULL;
+    delete workloadProfiles;
+    workloadProfiles = NULL;
+    delete temperatureLog;
+    temperatureLog = NULL;
+    progress.stop("finished");
+}
+
+bool
+DRAMSpec::hasAnalyses() const
+{
+    return traceActivity != NULL
+           || !arg->checkTraceFileName.empty()
+           || workloadProfiles != NULL
+           || !arg->speedBinFrequencies.empty()
+           || !arg->voltageSweepVdds.empty()
+           || !arg->temperatureSweepPoints.empty()
+           || arg->cornersFlag
+           || temperatureLog != NULL;
+}
+
+void
+DRAMSpec::computeAnalyses(Configuration& configuration)
+{
+    Evaluation& evaluation = *configuration.evaluation;
+    const Current& evaluatedDram = *evaluation.dram;
+    // Each result table is followed by an empty line
+    string& report = evaluation.analysisReport;
+
+    if ( traceActivity != NULL ) {
+        TraceEnergy traceEnergy(*traceActivity, evaluatedDram,
+                                configuration.technologyValues);
+        traceEnergy.appendReport(report, *traceActivity);
+        report.push_back('\n');
+    }
+
+    if ( !arg->checkTraceFileName.empty() ) {
+        checkTrace(configuration);
+        if ( !configuration.error.empty() ) {
+            return;
+        }
+        report.append(evaluation.traceCheck->report);
+        report.push_back('\n');
+    }
+
+    try {
+        if ( workloadProfiles != NULL ) {
+            evaluation.workloadPower.reset(
+                        new WorkloadPower(*workloadProfiles, evaluatedDram,
+                                          configuration.technologyValues));
+            evaluation.workloadPower->appendReport(report,
+                                                   *workloadProfiles);
+            report.push_back('\n');
+        }
+
+        if ( workloadProfiles != NULL && arg->thermalResistance > 0 ) {
+            evaluation.selfHeating.reset(
+                        new SelfHeating(*workloadProfiles, evaluatedDram,
+                                        arg->thermalResistance,
+                                        arg->ambientTemperature));
+            evaluation.selfHeating->appendReport(report, *workloadProfiles);
+            report.push_back('\n');
+        }
+
+        if ( !arg->speedBinFrequencies.empty() ) {
+            evaluation.speedBinTable.reset(
+                        new SpeedBinTable(evaluatedDram,
+                                          arg->speedBinFrequencies));
+            evaluation.speedBinTable->appendReport(report);
+            report.push_back('\n');
+        }
+
+        if ( !arg->voltageSweepVdds.empty() ) {
+            evaluation.voltageSweep.reset(
+                        new VoltageSweep(evaluatedDram, arg->voltageSweepVdds,
+                                         arg->voltageSweepVpps));
+            evaluation.voltageSweep->appendReport(report);
+            report.push_back('\n');
+        }
+
+        if ( !arg->temperatureSweepPoints.empty() ) {
+            evaluation.temperatureSweep.reset(
+                        new TemperatureSweep(evaluatedDram,
+                                             arg->temperatureSweepPoints));
+            evaluation.temperatureSweep->appendReport(report);
+            report.push_back('\n');
+        }
+
+        if ( arg->cornersFlag ) {
+            evaluation.cornerTable.reset(
+                        new ProcessCornerTable(evaluatedDram));
+            evaluation.cornerTable->appendReport(report);
+            report.push_back('\n');
+        }
+
+        if ( temperatureLog != NULL ) {
+            evaluation.temperatureProfile.reset(
+                        new TemperatureProfile(*temperatureLog,
+                                               evaluatedDram));
+            evaluation.temperatureProfile->appendReport(report,
+                                                        *temperatureLog);
+            report.push_back('\n');
+        }
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+}
+
+void
+DRAMSpec::checkTrace(Configuration& configuration)
+{
+    TimingChecker timingChecker(*configuration.evaluation->dram,
+                                configuration.technologyValues, nThreads);
+
+    // The first worker with these timings checks the trace, the others
+    //  wait for its check
+    unique_lock<mutex> lock(traceChecksMutex);
+    shared_ptr<TraceCheck> traceCheck
+            = traceChecks[timingChecker.timingsKey()];
+    if ( traceCheck == NULL ) {
+        traceCheck.reset(new TraceCheck());
+        traceCheck->configID = configuration.configID;
+        traceCheck->isDone = false;
+        traceChecks[timingChecker.timingsKey()] = traceCheck;
+        lock.unlock();
+
+        try {
+            timingChecker.check(arg->checkTraceFileName,
+                                violationFileName(configuration.configID));
+            timingChecker.appendReport(traceCheck->report);
+        } catch(string exceptionMsgThrown) {
+            traceCheck->error = exceptionMsgThrown;
+        }
+
+        lock.lock();
+        traceCheck->isDone = true;
+        traceCheckDone.notify_all();
+    }
+    else {
+        traceCheckDone.wait(lock, [&traceCheck]{ return traceCheck->isDone; });
+    }
+
+    configuration.evaluation->traceCheck = traceCheck;
+    configuration.error = traceCheck->error;
+}
+
+void
+DRAMSpec::writeConfiguration(const Configuration& configuration)
+{
+    unsigned int configID = configuration.configID;
+    dram = configuration.evaluation->dram.get();
+
+    output << "DRAM Configuration: "
+           << configID+1
+           << '\n';
+    output << "\tTechnology filename: "
+           << arg->technologyFileName[configuration.filesID]
+           << '\n';
+    output << "\tParameter filename:  "
+           << arg->architectureFileName[configuration.filesID]
+           << '\n';
+    for ( const string& parameterOverride : arg->parameterOverrides ) {
+        output << "\tParameter override:  "
+               << parameterOverride
+               << '\n';
+    }
+    if ( !configuration.sweepPoint.empty() ) {
+        output << "\tSweep point:         "
+               << configuration.sweepPoint
+               << '\n';
+    }
+    output << configuration.evaluationInfo;
+    output << dram->warning;
+
+    addShardManifestEntry(configuration);
+
+    // A columnar file replaces the files of every configuration
+    if ( columnarWriter != NULL ) {
+        columnarWriter->append(configID+1, *dram);
+    }
+    else {
+        jsonOutputWrite(configID+1);
+
         ofstream csvResultFile;
         string csvResultFileName("results_for_config_");
         csvResultFileName.append(to_string(configID));
         csvResultFileName.append(".csv");
         csvResultFile.open(csvResultFileName, ofstream::trunc);
 
-        output << "DRAM Configuration: "
-               << configID+1
-               << endl;
-        output << "\tTechnology filename: "
-               << arg->technologyFileName[configID]
-               << endl;
-        output << "\tParameter filename:  "
-               << arg->architectureFileName[configID]
-               << endl;
+        csvResultFile << "Label,"
+                      << "Technology filename: "
+                      << arg->technologyFileName[configuration.filesID]
+                      << "  Parameter filename: "
+                      << arg->architectureFileName[configuration.filesID];
+        if ( !configuration.sweepPoint.empty() ) {
+            csvResultFile << "  Sweep point: " << configuration.sweepPoint;
+        }
+        csvResultFile << endl;
 
-        try{
-            // Current is the last thing calculated for the dram
-            // Maybe the inheritance style should be adjusted for
-            //  intelligibility purposes
-            dram = new Current(arg->technologyFileName[configID],
-                               arg->architectureFileName[configID],
-                               arg->IOTerminationCurrentFlag);
-            output << dram->warning;
+        try {
+            arrangeOutput("csv", resultTable);
         } catch(string exceptionMsgThrown) {
             throw exceptionMsgThrown;
         }
-        jsonOutputWrite(configID+1);
-
-        csvResultFile << "Label,"
-                      << "Technology filename: " << arg->technologyFileName[configID]
-                      << "  Parameter filename: " << arg->architectureFileName[configID]
-                      << endl;
+        csvResultFile << resultTable;
+        csvResultFile.close();
+    }
 
+    if ( arg->printResultTable ) {
         try {
-            csvResultFile << arrangeOutput("csv");
+            arrangeOutput("stdout", resultTable);
         } catch(string exceptionMsgThrown) {
             throw exceptionMsgThrown;
         }
-        csvResultFile.close();
+        output << resultTable << '\n';
+    }
 
+    // The analyses are computed by the compute stage
+    try {
+        writeAnalysisFiles(configuration);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    output << configuration.evaluation->analysisReport;
+
+    if (arg->printInternalTimings) {
+        dram->printTimings();
+    }
+
+    output  << "_______________________________________________________"
+            << "_______________________________________________________"
+            << "_______________________________________________________"
+            << '\n';
+    // Each configuration reaches the standard output once it is written
+    output.flush();
+}
+
+void
+DRAMSpec::writeAnalysisFiles(const Configuration& configuration)
+{
+    Evaluation& evaluation = *configuration.evaluation;
+
+    // The violations of -checktrace are listed in the file of the
+    //  configuration that ran the check
+    const TraceCheck * traceCheck = evaluation.traceCheck.get();
+    if ( traceCheck != NULL && traceCheck->configID != configuration.configID
+         && !violationFileName(configuration.configID).empty() ) {
         try {
-            output << arrangeOutput("stdout") << endl;
+            copyResultFile(violationFileName(traceCheck->configID),
+                           violationFileName(configuration.configID));
         } catch(string exceptionMsgThrown) {
             throw exceptionMsgThrown;
         }
+    }
+
+    // The files of the configuration that computed the analyses are
+    //  written before the ones of the configurations that reuse them
+    if ( evaluation.configID != configuration.configID ) {
+        vector<string> sourceFiles = analysisFileNames(evaluation.configID);
+        vector<string> targetFiles
+                = analysisFileNames(configuration.configID);
+        for ( size_t fileID = 0; fileID < sourceFiles.size(); fileID++ ) {
+            try {
+                copyResultFile(sourceFiles[fileID], targetFiles[fileID]);
+            } catch(string exceptionMsgThrown) {
+                throw exceptionMsgThrown;
+            }
+        }
+        return;
+    }
+
+    unsigned int configID = configuration.configID;
+    try {
+        if ( evaluation.workloadPower != NULL ) {
+            evaluation.workloadPower->write(workloadPowerFileName(configID),
+                                            *workloadProfiles);
+        }
+        if ( evaluation.selfHeating != NULL ) {
+            evaluation.selfHeating->write(selfHeatingFileName(configID),
+                                          *workloadProfiles);
+        }
+        if ( evaluation.speedBinTable != NULL ) {
+            evaluation.speedBinTable->write(speedBinFileName(configID));
+        }
+        if ( evaluation.voltageSweep != NULL ) {
+            evaluation.voltageSweep->write(voltageSweepFileName(configID));
+        }
+        if ( evaluation.temperatureSweep != NULL ) {
+            evaluation.temperatureSweep->write(
+                        temperatureSweepFileName(configID));
+        }
+        if ( evaluation.cornerTable != NULL ) {
+            evaluation.cornerTable->write(processCornerFileName(configID));
+        }
+        if ( evaluation.temperatureProfile != NULL ) {
+            evaluation.temperatureProfile->write(
+                        temperatureProfileFileName(configID),
+                        *temperatureLog);
+        }
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    // The evaluation is kept for the configurations with the same input
+    //  values, which only need the files
+    evaluation.workloadPower.reset();
+    evaluation.selfHeating.reset();
+    evaluation.speedBinTable.reset();
+    evaluation.voltageSweep.reset();
+    evaluation.temperatureSweep.reset();
+    evaluation.cornerTable.reset();
+    evaluation.temperatureProfile.reset();
+}
+
+void
+DRAMSpec::addShardManifestEntry(const Configuration& configuration)
+{
+    if ( shardManifest == NULL ) {
+        return;
+    }
+
+    ShardManifest::Configuration entry;
+    entry.configuration = configuration.configID+1;
+    entry.technologyFileName
+            = arg->technologyFileName[configuration.filesID];
+    entry.architectureFileName
+            = arg->architectureFileName[configuration.filesID];
+    entry.sweepPoint = configuration.sweepPoint;
+    // A columnar file replaces the files of every configuration
+    if ( columnarWriter == NULL ) {
+        string configNumber = to_string(configuration.configID+1);
+        entry.outputFileNames.push_back(
+                    "timingnsresult_" + configNumber + ".json");
+        entry.outputFileNames.push_back(
+                    "timingresult_" + configNumber + ".json");
+        entry.outputFileNames.push_back(
+                    "currentresult_" + configNumber + ".json");
+        entry.outputFileNames.push_back(
+                    "results_for_config_"
+                    + to_string(configuration.configID) + ".csv");
+    }
+    if ( !violationFileName(configuration.configID).empty() ) {
+        entry.outputFileNames.push_back(
+                    violationFileName(configuration.configID));
+    }
+    vector<string> analysisFiles = analysisFileNames(configuration.configID);
+    entry.outputFileNames.insert(entry.outputFileNames.end(),
+                                 analysisFiles.begin(), analysisFiles.end());
+    shardManifest->configurations.push_back(entry);
+}
+
+string
+DRAMSpec::violationFileName(unsigned int configID) const
+{
+    if ( arg->checkTraceFileName.empty() || arg->checkSummaryFlag ) {
+        return "";
+    }
+    return "violations_for_config_" + to_string(configID) + ".csv";
+}
+
+string
+DRAMSpec::workloadPowerFileName(unsigned int configID) const
+{
+    if ( arg->workloadFileName.empty() ) {
+        return "";
+    }
+    return "workload_power_for_config_" + to_string(configID) + ".csv";
+}
+
+string
+DRAMSpec::selfHeatingFileName(unsigned int configID) const
+{
+    if ( arg->workloadFileName.empty() || arg->thermalResistance == 0 ) {
+        return "";
+    }
+    return "self_heating_for_config_" + to_string(configID) + ".csv";
+}
+
+string
+DRAMSpec::speedBinFileName(unsigned int configID) const
+{
+    if ( arg->speedBinFrequencies.empty() ) {
+        return "";
+    }
+    return "speedbins_for_config_" + to_string(configID) + ".csv";
+}
+
+string
+DRAMSpec::voltageSweepFileName(unsigned int configID) const
+{
+    if ( arg->voltageSweepVdds.empty() ) {
+        return "";
+    }
+    return "voltage_sweep_for_config_" + to_string(configID) + ".csv";
+}
+
+string
+DRAMSpec::temperatureSweepFileName(unsigned int configID) const
+{
+    if ( arg->temperatureSweepPoints.empty() ) {
+        return "";
+    }
+    return "temperature_sweep_for_config_" + to_string(configID) + ".csv";
+}
+
+string
+DRAMSpec::processCornerFileName(unsigned int configID) const
+{
+    if ( !arg->cornersFlag ) {
+        return "";
+    }
+    return "corners_for_config_" + to_string(configID) + ".csv";
+}
+
+string
+DRAMSpec::temperatureProfileFileName(unsigned int configID) const
+{
+    if ( arg->temperatureLogFileName.empty() ) {
+        return "";
+    }
+    return "temperature_profile_for_config_"
+           + to_string(configID) + ".csv";
+}
+
+vector<string>
+DRAMSpec::analysisFileNames(unsigned int configID) const
+{
+    const string fileNames[] = {
+        workloadPowerFileName(configID),
+        selfHeatingFileName(configID),
+        speedBinFileName(configID),
+        voltageSweepFileName(configID),
+        temperatureSweepFileName(configID),
+        processCornerFileName(configID),
+        temperatureProfileFileName(configID)
+    };
+    vector<string> analysisFiles;
+    for ( const string& fileName : fileNames ) {
+        if ( !fileName.empty() ) {
+            analysisFiles.push_back(fileName);
+        }
+    }
+    return analysisFiles;
+}
+
+void
+DRAMSpec::copyResultFile(const string& sourceName, const string& targetName)
+{
+    ifstream sourceFile(sourceName, ifstream::binary);
+    ofstream targetFile(targetName, ofstream::binary | ofstream::trunc);
+    if ( sourceFile.is_open() ) {
+        targetFile << sourceFile.rdbuf();
+        targetFile.close();
+    }
+    if ( !sourceFile.is_open() || targetFile.fail() ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not copy result file ");
+        exceptionMsgThrown.append(sourceName);
+        exceptionMsgThrown.append(" to ");
+        exceptionMsgThrown.append(targetName);
+        exceptionMsgThrown.append("!\n");
+        throw exceptionMsgThrown;
+    }
+}
+
+void
+DRAMSpec::saveCheckpoint(unsigned int nWrittenConfigurations,
+                         bool isComplete)
+{
+    checkpoint.nWrittenConfigurations = nWrittenConfigurations;
+    checkpoint.nEvaluatedConfigurations = nResumedEvaluations
+                                          + nWrittenEvaluations;
+    // The results are on disk before the checkpoint refers to them
+    checkpoint.columnarFileSize = ( columnarWriter != NULL
+                                    ? columnarWriter->flush() : 0 );
+    checkpoint.writtenSweepsHash = writtenSweepsHash;
+    checkpoint.isComplete = isComplete;
+    checkpoint.write(arg->checkpointFileName);
+    lastCheckpointTime = chrono::steady_clock::now();
+}
+
+string
+DRAMSpec::addSweepSize(const string& sweepsHash,
+                       unsigned int filesID, unsigned int nPoints)
+{
+    return hashString(sweepsHash + "\n" + to_string(filesID)
+                      + ":" + to_string(nPoints));
+}
+
+void
+DRAMSpec::readConfigurations(BoundedQueue<Configuration*>& computeQueue,
+                             BoundedQueue<Configuration*>& writeQueue)
+{
+    // Waiting for the other stages to take configurations is not counted
+    RunProgress::StageTimer readTimer(&progress, RunProgress::STAGE_READ);
+    auto pushConfiguration = [&](BoundedQueue<Configuration*>& queue,
+                                 Configuration * configuration) {
+        readTimer.pause();
+        queue.push(configuration);
+        readTimer.resume();
+    };
+    for ( unsigned int filesID = 0; filesID < arg->nConfigurations; filesID++ )
+    {
+        // Values that are not extracted yet (only file names are set)
+        TechnologyValues fileValues;
+        rapidjson::Document techDocument;
+        rapidjson::Document archDocument;
+        try {
+            fileValues.loadJSONDocuments(arg->technologyFileName[filesID],
+                                         arg->architectureFileName[filesID],
+                                         arg->parameterOverrides,
+                                         techDocument,
+                                         archDocument);
+
+            ParameterSweep sweep(techDocument, archDocument);
+            unsigned long nShardPoints = sweep.nPoints;
+            if ( arg->nShards > 0 ) {
+                // Configurations before firstID, then up to lastID, that
+                //  belong to this shard
+                unsigned long firstID = nRunConfigurations;
+                unsigned long lastID = firstID + sweep.nPoints;
+                unsigned long shardOffset = arg->shardID - 1;
+                auto nShardConfigurations = [&](unsigned long nRun) {
+                    return ( nRun > shardOffset
+                             ? (nRun - shardOffset - 1) / arg->nShards + 1
+                             : 0 );
+                };
+                nShardPoints = nShardConfigurations(lastID)
+                               - nShardConfigurations(firstID);
+            }
+            progress.addFile(nShardPoints);
+            sweepSizesHash = addSweepSize(sweepSizesHash, filesID,
+                                          sweep.nPoints);
+
+            for ( unsigned int pointID = 0; pointID < sweep.nPoints; pointID++ )
+            {
+                if ( isStopped ) {
+                    return;
+                }
+                // Configurations are dealt to the shards in turn
+                unsigned int configID = nRunConfigurations++;
+                if ( arg->nShards > 0
+                     && configID % arg->nShards != arg->shardID - 1 ) {
+                    continue;
+                }
+
+                // Written before the run was resumed, nothing to evaluate
+                if ( nReadConfigurations < nResumedConfigurations ) {
+                    Configuration * doneConfiguration = new Configuration();
+                    doneConfiguration->configID = configID;
+                    doneConfiguration->position = nReadConfigurations++;
+                    doneConfiguration->filesID = filesID;
+                    doneConfiguration->nFilePoints = sweep.nPoints;
+                    doneConfiguration->sweepPoint
+                            = sweep.pointDescription(pointID);
+                    doneConfiguration->isDone = true;
+                    doneConfiguration->isReused = false;
+                    pushConfiguration(writeQueue, doneConfiguration);
+                    continue;
+                }
+                sweep.setPoint(pointID);
+
+                // Owned by the pipeline once it is pushed to a queue
+                unique_ptr<Configuration> newConfiguration(new Configuration());
+                Configuration& configuration = *newConfiguration;
+                configuration.configID = configID;
+                configuration.isDone = false;
+                configuration.isReused = false;
+                configuration.filesID = filesID;
+                configuration.nFilePoints = sweep.nPoints;
+                configuration.sweepPoint = sweep.pointDescription(pointID);
+                configuration.technologyValues = fileValues;
+                configuration.technologyValues.extractValues(techDocument,
+                                                             archDocument);
+                configuration.position = nReadConfigurations++;
+
+                // Configurations with the same input values are evaluated
+                //  only once
+                string valuesHash = hashString(
+                            configuration.technologyValues.canonicalValues());
+                unordered_map< string, shared_ptr<Evaluation> >::iterator
+                        evaluated = evaluations.find(valuesHash);
+                if ( evaluated != evaluations.end() ) {
+                    configuration.evaluationInfo
+                            = "\tSame input values as DRAM Configuration ";
+                    configuration.evaluationInfo.append(
+                                to_string(evaluated->second->configID + 1));
+                    configuration.evaluationInfo.append(", results reused.\n");
+                    configuration.isReused = true;
+                    configuration.evaluation = evaluated->second;
+                    pushConfiguration(writeQueue,
+                                      newConfiguration.release());
+                    continue;
+                }
+                configuration.evaluation.reset(new Evaluation());
+                configuration.evaluation->configID = configID;
+                evaluations[valuesHash] = configuration.evaluation;
+
+                // Internal timings are not cached, so they force a
+                //  computation, as the speed bins, voltage and temperature
+                //  sweeps, temperature profiles and self-heating do, which
+                //  are computed from them. Cached results still go through
+                //  the compute stage to be analysed.
+                if ( resultCache != NULL ) {
+                    configuration.cacheKey = resultCache->computeKey(
+                                                configuration.technologyValues,
+                                                arg->IOTerminationCurrentFlag);
+                    if ( !arg->printInternalTimings
+                         && arg->speedBinFrequencies.empty()
+                         && arg->voltageSweepVdds.empty()
+                         && arg->temperatureSweepPoints.empty()
+                         && !arg->cornersFlag
+                         && arg->temperatureLogFileName.empty()
+                         && arg->thermalResistance == 0 ) {
+                        shared_ptr<Current> cachedDram(new Current());
+                        if ( resultCache->load(configuration.cacheKey,
+                                               *cachedDram) ) {
+                            configuration.evaluationInfo
+                                    = "\tResults loaded from cache entry: ";
+                            configuration.evaluationInfo.append(
+                                        configuration.cacheKey);
+                            configuration.evaluationInfo.append("\n");
+                            configuration.evaluation->dram = cachedDram;
+                            if ( !hasAnalyses() ) {
+                                pushConfiguration(writeQueue,
+                                                  newConfiguration.release());
+                                continue;
+                            }
+                        }
+                    }
+                }
+
+                pushConfiguration(computeQueue, newConfiguration.release());
+            }
+        } catch(string exceptionMsgThrown) {
+            // Reported by the writer once the configurations before this
+            //  one are written
+            Configuration * failedConfiguration = new Configuration();
+            failedConfiguration->configID = nRunConfigurations;
+            failedConfiguration->position = nReadConfigurations++;
+            failedConfiguration->isDone = false;
+            failedConfiguration->isReused = false;
+            failedConfiguration->filesID = filesID;
+            failedConfiguration->nFilePoints = 0;
+            failedConfiguration->error = exceptionMsgThrown;
+            pushConfiguration(writeQueue, failedConfiguration);
+            return;
+        }
+    }
+}
+
+void
+DRAMSpec::computeConfigurations(BoundedQueue<Configuration*>& computeQueue,
+                                BoundedQueue<Configuration*>& writeQueue)
+{
+    // Configurations are independent, so no other synchronization is needed
+    //  than for the trace checks they share (see checkTrace)
+    Configuration * configuration;
+    while ( computeQueue.pop(configuration) ) {
+        if ( isStopped ) {
+            return;
+        }
+        // Current is the last thing calculated for the dram
+        // Maybe the inheritance style should be adjusted for
+        //  intelligibility purposes
+        RunProgress::StageTimer computeTimer(&progress,
+                                             RunProgress::STAGE_COMPUTE);
+        // Results loaded from the cache are only analysed
+        bool isCached = ( configuration->evaluation->dram != NULL );
+        if ( !isCached ) {
+            try {
+                configuration->evaluation->dram.reset(
+                            new Current(configuration->technologyValues,
+                                        arg->IOTerminationCurrentFlag));
+            } catch(string exceptionMsgThrown) {
+                configuration->error = exceptionMsgThrown;
+            }
+        }
 
-        if (arg->printInternalTimings) {
-            dram->printTimings();
+        if ( resultCache != NULL && !isCached
+             && configuration->error.empty() ) {
+            resultCache->store(configuration->cacheKey,
+                               *configuration->evaluation->dram);
         }
 
-        output  << "_______________________________________________________"
-                << "_______________________________________________________"
-                << "_______________________________________________________"
-                << endl;
+        if ( hasAnalyses() && configuration->error.empty() ) {
+            try {
+                computeAnalyses(*configuration);
+            } catch(string exceptionMsgThrown) {
+                configuration->error = exceptionMsgThrown;
+            }
+        }
+        computeTimer.pause();
 
+        writeQueue.push(configuration);
     }
 }
@@ -42,7 +42,25 @@
 #define DRAMSPEC_H
 
 #include "ArgumentsParser.h"
+#include "ResultCache.h"
+#include "ParameterSweep.h"
+#include "StreamProcessor.h"
+#include "ColumnarResultWriter.h"
+#include "ShardManifest.h"
+#include "RunCheckpoint.h"
+#include "RunProgress.h"
+#include "../trace/TraceEnergy.h"
+#include "../trace/TimingChecker.h"
+#include "../workload/WorkloadPower.h"
+#include "../thermal/TemperatureProfile.h"
+#include "../thermal/SelfHeating.h"
 #include "../core/Current.h"
+#include "../core/SpeedBinTable.h"
+#include "../core/VoltageSweep.h"
+#include "../core/TemperatureSweep.h"
+#include "../core/ProcessCornerTable.h"
+#include "../utils/BoundedQueue.h"
+#include "../utils/NumberFormat.h"
 
 #include <ctime>
 #include <cmath>
@@ -51,22 +69,30 @@
 #include <sstream>
 #include <iomanip>
 #include <vector>
+#include <deque>
+#include <map>
 #include <stdio.h>
 #include <string>
+#include <unordered_map>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
 
 #include "rapidjson/include/rapidjson/document.h"
+#include "rapidjson/include/rapidjson/filewritestream.h"
 #include "rapidjson/include/rapidjson/prettywriter.h"
-#include "rapidjson/include/rapidjson/stringbuffer.h"
 
 using namespace std;
 
-// Very specific macro to be used inside arrangeOutput() function
+// Very specific macro to be used inside arrangeOutput() function.
+// The label is padded to lineWidth, and the value is written like an
+//  output stream would, without the cost (and the locale) of a stream.
 #define BUILD_LINE(label, value) \
-    setw(lineWidth) \
-    << left << label \
-    << separator \
-    << right << value \
-    << endl \
+    appendTableLine(resultTable, label, lineWidth, separator, value) \
 
 class DRAMSpec
 {
@@ -74,13 +100,213 @@ public:
     DRAMSpec(int argc, char** argv);
 
     void jsonOutputWrite(int dramConfigID);
-    string arrangeOutput(const string isCsv);
+    // Fills resultTable with the results, as "csv" or "stdout" table
+    void arrangeOutput(const string outputType, string& resultTable);
 
     void runDramSpec(int argc, char** argv);
 
+    // Check of the trace of -checktrace, shared by the configurations
+    //  whose timings are the same
+    struct TraceCheck {
+        // Configuration whose violation file lists the violations
+        unsigned int configID;
+        string report;
+        // Why the trace could not be checked, if it could not
+        string error;
+        bool isDone;
+    };
+
+    // Results of an evaluated configuration, shared with the later
+    //  configurations that have the same input values
+    struct Evaluation {
+        unsigned int configID;
+        // Set once the results are calculated or loaded from the cache
+        shared_ptr<Current> dram;
+        // Set by the compute stage with -checktrace
+        shared_ptr<TraceCheck> traceCheck;
+        // Result tables of the analyses of the run (-energytrace,
+        //  -checktrace, -workloads, ...), rendered by the compute stage in
+        //  the order they are printed
+        string analysisReport;
+        // Analyses with output files, computed by the compute stage and
+        //  freed once the files of the configuration are written
+        unique_ptr<WorkloadPower> workloadPower;
+        unique_ptr<SelfHeating> selfHeating;
+        unique_ptr<SpeedBinTable> speedBinTable;
+        unique_ptr<VoltageSweep> voltageSweep;
+        unique_ptr<TemperatureSweep> temperatureSweep;
+        unique_ptr<ProcessCornerTable> cornerTable;
+        unique_ptr<TemperatureProfile> temperatureProfile;
+    };
+
+    // A DRAM configuration of the run, freed once it is written
+    struct Configuration {
+        // Position of the configuration in the run
+        unsigned int configID;
+        // Position among the configurations evaluated by this process,
+        //  which differs from configID when only a shard is evaluated
+        unsigned int position;
+        // Index of the technology and architecture files, and number of
+        //  points of their sweep
+        unsigned int filesID;
+        unsigned int nFilePoints;
+        // Swept values, empty if nothing is swept
+        string sweepPoint;
+        TechnologyValues technologyValues;
+        // How the results were obtained (reused, cached)
+        string evaluationInfo;
+        string cacheKey;
+        // Set if the results were written before the run was resumed
+        bool isDone;
+        // Set if the results of an earlier configuration are reused
+        bool isReused;
+        shared_ptr<Evaluation> evaluation;
+        // Why the configuration could not be evaluated, if it could not
+        string error;
+    };
+
+    // The configurations go through a pipeline of three stages connected
+    //  by bounded queues, so that reading the input files of the next
+    //  configurations overlaps with calculating and writing the current ones:
+    //  reader -> computeQueue -> compute workers -> writeQueue -> writer.
+    //  Configurations that need no calculation go from the reader straight
+    //  to the writer.
+
+    // Reader stage: fills configurations with every pair of input files at
+    //  every point of its sweeps, and finds the ones whose results are
+    //  reused from an identical configuration or loaded from the cache
+    void readConfigurations(BoundedQueue<Configuration*>& computeQueue,
+                            BoundedQueue<Configuration*>& writeQueue);
+
+    // Compute stage: calculates the results of the configurations taken
+    //  from computeQueue, and their analyses
+    void computeConfigurations(BoundedQueue<Configuration*>& computeQueue,
+                               BoundedQueue<Configuration*>& writeQueue);
+
+    // Set if the configurations are analysed beyond their results
+    //  (-energytrace, -checktrace, -workloads, ...)
+    bool hasAnalyses() const;
+    // Computes the analyses of a computed configuration and renders their
+    //  result tables
+    void computeAnalyses(Configuration& configuration);
+    // Checks the trace of -checktrace with the timings of a computed
+    //  configuration, or waits for the check of the same timings by
+    //  another compute worker
+    void checkTrace(Configuration& configuration);
+
+    // Writer stage: prints the results of a configuration and writes its
+    //  output files
+    void writeConfiguration(const Configuration& configuration);
+    void addShardManifestEntry(const Configuration& configuration);
+    // Writes the files of the analyses of a configuration, or copies them
+    //  from the configuration whose results (or trace check) it reuses
+    void writeAnalysisFiles(const Configuration& configuration);
+    // File listing the timing violations of the trace of -checktrace for
+    //  the configuration, empty if they are not listed
+    string violationFileName(unsigned int configID) const;
+    // File with the power of the profiles of -workloads for the
+    //  configuration, empty if there are none
+    string workloadPowerFileName(unsigned int configID) const;
+    // File with the temperatures of the profiles of -workloads solved with
+    //  -thermal for the configuration, empty if there are none
+    string selfHeatingFileName(unsigned int configID) const;
+    // File with the speed-bin table of -speedbins for the configuration,
+    //  empty if there is none
+    string speedBinFileName(unsigned int configID) const;
+    // File with the voltage sweep of -voltages for the configuration,
+    //  empty if there is none
+    string voltageSweepFileName(unsigned int configID) const;
+    // File with the temperature sweep of -temperaturesweep for the
+    //  configuration, empty if there is none
+    string temperatureSweepFileName(unsigned int configID) const;
+    // File with the process corners of -corners for the configuration,
+    //  empty if there are none
+    string processCornerFileName(unsigned int configID) const;
+    // File with the temperature profile of -temperatures for the
+    //  configuration, empty if there is none
+    string temperatureProfileFileName(unsigned int configID) const;
+    // Files of the analyses of the configuration, except the violation
+    //  file, in the order of the file names above
+    vector<string> analysisFileNames(unsigned int configID) const;
+    // Gives a configuration the output file of the configuration whose
+    //  results it shares
+    static void copyResultFile(const string& sourceName,
+                               const string& targetName);
+
+    // Saves the progress of the run: the first nWrittenConfigurations
+    //  configurations are written
+    void saveCheckpoint(unsigned int nWrittenConfigurations, bool isComplete);
+    // Adds the number of sweep points of a pair of input files to a hash
+    //  of the sweep sizes of the run
+    static string addSweepSize(const string& sweepsHash,
+                               unsigned int filesID, unsigned int nPoints);
+
     ArgumentsParser * arg;
+    // Configurations evaluated at a time, and banks of a trace checked at
+    //  a time by -checktrace
+    unsigned int nThreads;
+    ResultCache * resultCache;
+    // Writes the results of all configurations to one file, if requested
+    ColumnarResultWriter * columnarWriter;
+    // Outputs of the shard, if only a shard of the run is evaluated
+    ShardManifest * shardManifest;
+    // Number of configurations of the whole run read so far, including
+    //  the ones of other shards
+    unsigned int nRunConfigurations;
+
+    // Progress saved with -checkpoint, every checkpointInterval seconds
+    RunCheckpoint checkpoint;
+    static const int checkpointInterval = 10;
+    chrono::steady_clock::time_point lastCheckpointTime;
+    // Configurations written (and evaluated among them) before the run
+    //  was resumed, and since then
+    unsigned int nResumedConfigurations;
+    unsigned int nResumedEvaluations;
+    // Sweep sizes of the input files of the configurations written before
+    //  the run was resumed, checked against the ones read again, so that
+    //  the skipped configurations are the written ones
+    string resumedWrittenSweepsHash;
+    // Sweep sizes of the files of the configurations written so far, the
+    //  next file whose size is added, and the sizes of all files read
+    string writtenSweepsHash;
+    unsigned int nextWrittenFilesID;
+    string sweepSizesHash;
+    unsigned int nWrittenEvaluations;
+    // Counters of the stages, reported with -progress, -status, -metrics
+    RunProgress progress;
+    // Activity of the command trace of -energytrace, read once for the run
+    TraceActivity * traceActivity;
+    // Profiles of -workloads, read once for the run
+    WorkloadProfiles * workloadProfiles;
+    // Temperature log of -temperatures, read once for the run
+    TemperatureLog * temperatureLog;
+    // Configuration being written
     Current * dram;
-    ostringstream output;
+    // Standard output, written configuration by configuration
+    ostream& output;
+    // Output buffer of the JSON result files, reused for every file
+    vector<char> jsonOutputBuffer;
+    // Result table of the current configuration, reused for every one
+    string resultTable;
+
+    // Number of configurations evaluated by this process read so far.
+    //  They are allocated by the reader and freed by the writer, so only
+    //  the configurations in the pipeline are kept.
+    unsigned int nReadConfigurations;
+
+    // Results of the evaluated configurations indexed by the hash of their
+    //  canonical input values (the identity used by the result cache too),
+    //  which is much smaller than the values themselves
+    unordered_map< string, shared_ptr<Evaluation> > evaluations;
+
+    // Trace checks of -checktrace indexed by the timings they depend on
+    //  (see TimingChecker::timingsKey), shared by the compute workers
+    map< string, shared_ptr<TraceCheck> > traceChecks;
+    mutex traceChecksMutex;
+    condition_variable traceCheckDone;
+
+    // Set when the run is stopped by an error, so that the stages quit early
+    atomic<bool> isStopped;
 };
 
 #endif // DRAMSPEC_H
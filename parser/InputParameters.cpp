@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#include "InputParameters.h"
+
+#include <cstring>
+#include <vector>
+#include <stdint.h>
+
+#define INPUT_PARAMETER_DESCRIPTOR(document, jsonKey, member, unit, \
+                                   attribute, defaultValue) \
+    { document, jsonKey, #member, attribute },
+const InputParameter inputParameters[nInputParameters] = {
+    DRAMSPEC_INPUT_PARAMETERS(INPUT_PARAMETER_DESCRIPTOR)
+};
+#undef INPUT_PARAMETER_DESCRIPTOR
+
+namespace {
+
+// 64-bit FNV-1a hash of a key, starting from a seed
+uint64_t hashKey(const char* key, size_t keyLength, uint64_t seed)
+{
+    uint64_t hash = 14695981039346656037ULL ^ seed;
+    for ( size_t charID = 0; charID < keyLength; charID++ ) {
+        hash ^= static_cast<unsigned char>(key[charID]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Hash table of the JSON keys without any collision. The seed of the hash
+//  is searched once, so that every key falls in a slot of its own. A lookup
+//  is then a hash and a single key comparison.
+struct InputParameterIndex {
+    InputParameterIndex()
+    {
+        nSlots = 1;
+        while ( nSlots < 8 * nInputParameters ) {
+            nSlots *= 2;
+        }
+
+        for ( seed = 0; ; seed++ ) {
+            slots.assign(nSlots, -1);
+            bool hasCollision = false;
+            for ( int parameterID = 0;
+                  parameterID < nInputParameters && !hasCollision;
+                  parameterID++ ) {
+                const char* jsonKey = inputParameters[parameterID].jsonKey;
+                int& slot = slots[ slotOf(jsonKey, strlen(jsonKey)) ];
+                hasCollision = ( slot != -1 );
+                slot = parameterID;
+            }
+            if ( !hasCollision ) {
+                break;
+            }
+        }
+    }
+
+    size_t slotOf(const char* jsonKey, size_t jsonKeyLength) const
+    {
+        return hashKey(jsonKey, jsonKeyLength, seed) & (nSlots - 1);
+    }
+
+    uint64_t seed;
+    size_t nSlots;
+    std::vector<int> slots;
+};
+
+}
+
+int findInputParameter(const char* jsonKey, size_t jsonKeyLength)
+{
+    // Built on first use (thread-safe in C++11)
+    static const InputParameterIndex index;
+
+    int parameterID = index.slots[ index.slotOf(jsonKey, jsonKeyLength) ];
+    if ( parameterID == -1 ) {
+        return -1;
+    }
+    const char* parameterKey = inputParameters[parameterID].jsonKey;
+    if ( strncmp(parameterKey, jsonKey, jsonKeyLength) != 0
+         || parameterKey[jsonKeyLength] != '\0' ) {
+        return -1;
+    }
+    return parameterID;
+}
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+// Schema of the input values of a DRAM (TechnologyValues object): for every
+//  value, the document it is read from, its JSON key (with its unit), the
+//  TechnologyValues member it is stored in, whether it is mandatory and its
+//  default value. It drives reading the input files, the canonical form of
+//  the input values, the parameter overrides and the sweeps.
+#ifndef INPUTPARAMETERS_H
+#define INPUTPARAMETERS_H
+
+#include <cstddef>
+
+enum InputDocument { TECHNOLOGY_INPUT, ARCHITECTURE_INPUT };
+
+enum InputAttribute { MANDATORY_INPUT, OPTIONAL_INPUT };
+
+// Applies the given macro to every input value, as
+//  PARAMETER(document, jsonKey, member, unit, attribute, defaultValue).
+// The unit multiplies the number read from the file (1.0 for plain numbers).
+//  For ON/OFF switches (bool members) it is the value that means true, and
+//  it is unused for strings. Missing optional switches are false, missing
+//  optional strings are empty.
+// The order is the order of the canonical values (hence of cache keys).
+#define DRAMSPEC_INPUT_PARAMETERS(PARAMETER) \
+    PARAMETER(TECHNOLOGY_INPUT, "TechnologyNode[nm]", technologyNode, \
+              drs::nanometer, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "Vpp[V]", vpp, \
+              si::volt, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "Vdd[V]", vdd, \
+              si::volt, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "WireResistance[Ohm/mm]", wireResistance, \
+              drs::ohm_per_millimeter, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "WireCapacitance[fF/mm]", wireCapacitance, \
+              drs::femtofarad_per_millimeter, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "CellCapacitance[fF]", capacitancePerCell, \
+              drs::femtofarads, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "CellResistance[KOhm]", resistancePerCell, \
+              drs::kiloohm, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "CellWidth[um]", cellWidth, \
+              drs::micrometers, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "CellHeight[um]", cellHeight, \
+              drs::micrometers, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "BitlineCapacitancePerCell[aF]", capacitancePerBLCell, \
+              drs::attofarads, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "BitlineResistancePerCell[Ohm]", resistancePerBLCell, \
+              drs::ohm, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "WordlineCapacitancePerCell[aF]", capacitancePerWLCell, \
+              drs::attofarads, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "WordlineResistancePerCell[Ohm]", resistancePerWLCell, \
+              drs::ohm, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "PrimarySenseAmpHeight[um]", BLSenseAmpHeight, \
+              drs::micrometer, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "LocalWordlineDriverWitdh[um]", LWLDriverWidth, \
+              drs::micrometer, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "LocalWordlineDriverResistance[Ohm]", LWLDriverResistance, \
+              drs::ohm, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "RowDecoderWidth[um]", rowDecoderWidth, \
+              drs::micrometer, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "GlobalWordlineDriverResistance[Ohm]", GWLDriverResistance, \
+              si::ohm, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "SecondarySenseAmpCurrent[uA]", Issa, \
+              drs::microampere_per_bit, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "WriteDriverResistance[Ohm]", WRDriverResistance, \
+              drs::ohm, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "ColumnDecoderHeight[um]", colDecoderHeight, \
+              drs::micrometer, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "CSLDriverResistance[Ohm]", CSLDriverResistance, \
+              si::ohm, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "CSLLoadCapacitance[fF]", CSLLoadCapacitance, \
+              drs::femtofarads, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "GlobalDataLineDriverResistance[Ohm]", GDLDriverResistance, \
+              si::ohm, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "DQDriverHeight[um]", DQDriverHeight, \
+              drs::micrometer, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "DQtoTSVWireLength[um]", DQtoTSVWireLength, \
+              drs::micrometers, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "DQDriverResistance[Ohm]", DQDriverResistance, \
+              si::ohm, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "IDD2NFreqSlope[mA/MHz]", idd2nFreqSlope, \
+              drs::milliamperes_per_megahertz_clock, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "IDD2NTempAlpha[mA]", idd2nTempAlpha, \
+              drs::milliamperes, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "IDD2NTempBeta[C^-1]", idd2nTempBeta, \
+              drs::eergeds, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "IDD2NRefTemp[C]", idd2nRefTemp, \
+              bu::celsius::degrees, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "IDD2NOffset[mA]", idd2nOffset, \
+              drs::milliamperes, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "OCDCurrentSlope[uA/MHz]", IddOcdRcvSlope, \
+              drs::microamperes_per_megahertz_clock, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "FullySharedResourcesCurrent[mA]", fullySharedResourcesCurrent, \
+              drs::milliamperes, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "SemiSharedResourcesCurrent[mA]", semiSharedResourcesCurrent, \
+              drs::milliamperes, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "nBanksPerSemiSharedResource[]", nBanksPerSemiSharedResource, \
+              1.0, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "TSVHeight[um]", TSVHeight, \
+              drs::micrometer, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "AdditionalTRLLatency[cc]", additionalLatencyTrl, \
+              drs::clock, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "DriverEnableDelay[ns]", driverEnableDelay, \
+              drs::nanoseconds, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "InOutSSADelay[ns]", inOutSSADelay, \
+              drs::nanoseconds, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "CommandDecoderDelay[ns]", cmdDecoderDelay, \
+              drs::nanoseconds, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "IODelay[ns]", IODelay, \
+              drs::nanoseconds, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "SSAPrechargeDelay[ns]", SSAPrechargeDelay, \
+              drs::nanoseconds, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "tWRMargin[ns]", tWRMargin, \
+              drs::nanoseconds, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "EqualizerDelay[ns]", equalizerDelay, \
+              drs::nanoseconds, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(TECHNOLOGY_INPUT, "VppPumpEfficiency[-]", vppPumpsEfficiency, \
+              1.0, OPTIONAL_INPUT, 0.3) \
+    PARAMETER(TECHNOLOGY_INPUT, "DriverThresholdVoltage[V]", driverThresholdVoltage, \
+              si::volt, OPTIONAL_INPUT, 0.4) \
+    PARAMETER(TECHNOLOGY_INPUT, "WordlineThresholdVoltage[V]", wordlineThresholdVoltage, \
+              si::volt, OPTIONAL_INPUT, 0.9) \
+    PARAMETER(TECHNOLOGY_INPUT, "AlphaPowerExponent[-]", alphaPowerExponent, \
+              1.0, OPTIONAL_INPUT, 1.3) \
+    PARAMETER(TECHNOLOGY_INPUT, "ReferenceVdd[V]", referenceVdd, \
+              si::volt, OPTIONAL_INPUT, 0) \
+    PARAMETER(TECHNOLOGY_INPUT, "ReferenceVpp[V]", referenceVpp, \
+              si::volt, OPTIONAL_INPUT, 0) \
+    PARAMETER(TECHNOLOGY_INPUT, "WireResistanceTempCoefficient[C^-1]", wireResistanceTempCoefficient, \
+              drs::eergeds, OPTIONAL_INPUT, 0) \
+    PARAMETER(TECHNOLOGY_INPUT, "CellResistanceTempCoefficient[C^-1]", cellResistanceTempCoefficient, \
+              drs::eergeds, OPTIONAL_INPUT, 0) \
+    PARAMETER(TECHNOLOGY_INPUT, "DriverResistanceTempCoefficient[C^-1]", driverResistanceTempCoefficient, \
+              drs::eergeds, OPTIONAL_INPUT, 0) \
+    PARAMETER(TECHNOLOGY_INPUT, "ResistanceRefTemp[C]", resistanceRefTemp, \
+              bu::celsius::degrees, OPTIONAL_INPUT, 25) \
+    PARAMETER(ARCHITECTURE_INPUT, "DRAMType[-]", dramType, \
+              "", MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "3D[-]", is3D, \
+              "ON", MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "DLL[-]", isDLL, \
+              "ON", MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "ExternalVPP[-]", hasExternalVpp, \
+              "YES", OPTIONAL_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "ChannelSize[Gb]", channelSize, \
+              drs::gibibits, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "NumberOfBanksPerChannel[]", nBanks, \
+              1.0, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "NumberOfHorizontalBanksPerChannel[]", nHorizontalBanks, \
+              1.0, OPTIONAL_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "NumberOfVerticalBanksPerChannel[]", nVerticalBanks, \
+              1.0, OPTIONAL_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "CellsPerSubarrayRow[]", cellsPerLWL, \
+              1.0, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "RedundantCellsPerSubarrayRow[]", cellsPerLWLRedundancy, \
+              1.0, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "CellsPerSubarrayColumn[]", cellsPerLBL, \
+              1.0, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "RedundantCellsPerSubarrayColumn[]", cellsPerLBLRedundancy, \
+              1.0, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "Interface[bit]", interface, \
+              drs::bits, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "Prefetch[]", prefetch, \
+              1.0, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "Frequency[MHz]", dramFreq, \
+              drs::megahertz_clock, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "CoreFrequency[MHz]", dramCoreFreq, \
+              drs::megahertz_clock, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "TilesPerBank[]", nTilesPerBank, \
+              1.0, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "PageSize[KB]", pageStorage, \
+              drs::kibibyte, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "PageSpanningFactor[]", pageSpanningFactor, \
+              1.0, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "BitlineArchitecture[-]", BLArchitecture, \
+              "", MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "SubarrayToPageFactor[]", subArrayToPageFactor, \
+              1.0, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "RetentionTime[ms]", retentionTime, \
+              drs::millisecond, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "tREFI(base)[us]", trefIBase, \
+              drs::microsecond, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "RefreshMode[]", refreshMode, \
+              1.0, MANDATORY_INPUT, INVALID_VALUE) \
+    PARAMETER(ARCHITECTURE_INPUT, "Temperature[C]", temperature, \
+              bu::celsius::degrees, MANDATORY_INPUT, INVALID_VALUE)
+
+// Identifier (index in inputParameters) of every input value,
+//  e.g. INPUT_dramFreq
+#define INPUT_PARAMETER_ID(document, jsonKey, member, unit, attribute, \
+                           defaultValue) \
+    INPUT_ ## member,
+enum InputParameterID {
+    DRAMSPEC_INPUT_PARAMETERS(INPUT_PARAMETER_ID)
+    nInputParameters
+};
+#undef INPUT_PARAMETER_ID
+
+struct InputParameter {
+    InputDocument document;
+    const char* jsonKey;
+    const char* memberName;
+    InputAttribute attribute;
+};
+
+extern const InputParameter inputParameters[nInputParameters];
+
+// Identifier of the input value with the given JSON key, or -1 if no input
+//  value has this key. It takes constant time (perfect hashing).
+int findInputParameter(const char* jsonKey, size_t jsonKeyLength);
+
+#endif // INPUTPARAMETERS_H
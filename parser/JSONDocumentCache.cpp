@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#include "JSONDocumentCache.h"
+#include "../utils/MappedFile.h"
+
+#include <climits>
+#include <cstdlib>
+#include <sys/stat.h>
+
+atomic<unsigned int> JSONDocumentCache::nParsedFiles(0);
+map<string, JSONDocumentCache::BaseDocument>
+    JSONDocumentCache::baseDocuments;
+mutex JSONDocumentCache::baseDocumentsMutex;
+
+void
+JSONDocumentCache::load(const string& fileName,
+                        const string& fileType,
+                        rapidjson::Document& jsonDocument)
+{
+    // A file that is also the base of other files is already resolved
+    vector<FileStamp> sources;
+    shared_ptr<const rapidjson::Document> baseDocument
+            = findBase(canonicalPath(fileName), sources);
+    if ( baseDocument ) {
+        // The caller gets its own copy, which it is free to modify
+        jsonDocument.CopyFrom(*baseDocument, jsonDocument.GetAllocator());
+        return;
+    }
+
+    vector<string> extendsChain;
+    readDocument(fileName, fileType, extendsChain, jsonDocument, sources);
+}
+
+void
+JSONDocumentCache::mergePatch(rapidjson::Value& target,
+                              const rapidjson::Value& patch,
+                              rapidjson::Document::AllocatorType& allocator)
+{
+    if ( patch.IsObject() == false ) {
+        target.CopyFrom(patch, allocator);
+        return;
+    }
+
+    if ( target.IsObject() == false ) {
+        target.SetObject();
+    }
+    for ( rapidjson::Value::ConstMemberIterator patchMember = patch.MemberBegin();
+          patchMember != patch.MemberEnd();
+          ++patchMember ) {
+        const char* memberName = patchMember->name.GetString();
+        if ( patchMember->value.IsNull() ) {
+            // null removes the member
+            target.RemoveMember(memberName);
+        }
+        else if ( target.HasMember(memberName) ) {
+            mergePatch(target[memberName], patchMember->value, allocator);
+        }
+        else {
+            rapidjson::Value name(patchMember->name, allocator);
+            rapidjson::Value value;
+            mergePatch(value, patchMember->value, allocator);
+            target.AddMember(name, value, allocator);
+        }
+    }
+}
+
+void
+JSONDocumentCache::clear()
+{
+    lock_guard<mutex> lock(baseDocumentsMutex);
+    baseDocuments.clear();
+}
+
+void
+JSONDocumentCache::readDocument(const string& fileName,
+                                const string& fileType,
+                                vector<string>& extendsChain,
+                                rapidjson::Document& jsonDocument,
+                                vector<FileStamp>& sources)
+{
+    string filePath = canonicalPath(fileName);
+
+    for ( const string& extendingPath : extendsChain ) {
+        if ( extendingPath == filePath ) {
+            string exceptionMsgThrown;
+            exceptionMsgThrown.append("[ERROR] ");
+            exceptionMsgThrown.append("Circular \"extends\" chain: ");
+            for ( const string& chainPath : extendsChain ) {
+                exceptionMsgThrown.append(chainPath);
+                exceptionMsgThrown.append(" -> ");
+            }
+            exceptionMsgThrown.append(filePath);
+            exceptionMsgThrown.append("!\n");
+            throw exceptionMsgThrown;
+        }
+    }
+
+    // Stamped before reading, so that a file changed while it is read is
+    //  read again next time
+    sources.push_back(fileStamp(filePath));
+    parseFile(fileName, fileType, jsonDocument);
+
+    if ( jsonDocument.IsObject() && jsonDocument.HasMember("extends") ) {
+        if ( jsonDocument["extends"].IsString() == false ) {
+            string exceptionMsgThrown;
+            exceptionMsgThrown.append("[ERROR] ");
+            exceptionMsgThrown.append("Member \"extends\" in JSON document ");
+            exceptionMsgThrown.append(fileName);
+            exceptionMsgThrown.append(" is expected to be a string!\n");
+            throw exceptionMsgThrown;
+        }
+
+        // Base files are relative to the directory of the extending file
+        string baseFileName = jsonDocument["extends"].GetString();
+        size_t directoryEnd = fileName.find_last_of('/');
+        if ( baseFileName.empty() == false && baseFileName[0] != '/'
+             && directoryEnd != string::npos ) {
+            baseFileName = fileName.substr(0, directoryEnd + 1) + baseFileName;
+        }
+
+        extendsChain.push_back(filePath);
+        shared_ptr<const rapidjson::Document> baseDocument
+                = resolveBase(baseFileName, fileType, extendsChain, sources);
+        extendsChain.pop_back();
+
+        jsonDocument.RemoveMember("extends");
+        rapidjson::Document mergedDocument;
+        mergedDocument.CopyFrom(*baseDocument, mergedDocument.GetAllocator());
+        mergePatch(mergedDocument, jsonDocument,
+                   mergedDocument.GetAllocator());
+        jsonDocument.Swap(mergedDocument);
+    }
+}
+
+shared_ptr<const rapidjson::Document>
+JSONDocumentCache::resolveBase(const string& fileName,
+                               const string& fileType,
+                               vector<string>& extendsChain,
+                               vector<FileStamp>& sources)
+{
+    string filePath = canonicalPath(fileName);
+    shared_ptr<const rapidjson::Document> cachedDocument
+            = findBase(filePath, sources);
+    if ( cachedDocument ) {
+        return cachedDocument;
+    }
+
+    // Read and parsed without the lock, so that loads of other files do
+    //  not wait for the disk. Two threads may then read the same base,
+    //  the last one to finish keeps its document.
+    BaseDocument baseDocument;
+    unique_ptr<rapidjson::Document> jsonDocument(new rapidjson::Document);
+    readDocument(fileName, fileType, extendsChain, *jsonDocument,
+                 baseDocument.sources);
+    baseDocument.document = move(jsonDocument);
+
+    sources.insert(sources.end(), baseDocument.sources.begin(),
+                   baseDocument.sources.end());
+    lock_guard<mutex> lock(baseDocumentsMutex);
+    baseDocuments[filePath] = baseDocument;
+    return baseDocument.document;
+}
+
+shared_ptr<const rapidjson::Document>
+JSONDocumentCache::findBase(const string& filePath,
+                            vector<FileStamp>& sources)
+{
+    BaseDocument baseDocument;
+    {
+        lock_guard<mutex> lock(baseDocumentsMutex);
+        auto cachedDocument = baseDocuments.find(filePath);
+        if ( cachedDocument == baseDocuments.end() ) {
+            return shared_ptr<const rapidjson::Document>();
+        }
+        baseDocument = cachedDocument->second;
+    }
+
+    for ( const FileStamp& source : baseDocument.sources ) {
+        FileStamp currentStamp = fileStamp(source.filePath);
+        if ( currentStamp.modificationTime != source.modificationTime
+             || currentStamp.size != source.size ) {
+            return shared_ptr<const rapidjson::Document>();
+        }
+    }
+    sources.insert(sources.end(), baseDocument.sources.begin(),
+                   baseDocument.sources.end());
+    return baseDocument.document;
+}
+
+void
+JSONDocumentCache::parseFile(const string& fileName,
+                             const string& fileType,
+                             rapidjson::Document& jsonDocument)
+{
+    // Try to open file given by the user
+    MappedFile jsonFile(fileName);
+    // Test if file was opened
+    if ( jsonFile.isOpen == false ) {
+        string exceptionMsgThrown;
+        exceptionMsgThrown.append("[ERROR] ");
+        exceptionMsgThrown.append("Could not open " + fileType + " file: ");
+        exceptionMsgThrown.append(fileName);
+        exceptionMsgThrown.append("!\n");
+        throw exceptionMsgThrown;
+    }
+
+    // Parse the file as a JSON Document, straight from the file contents.
+    // Strings are copied into the document, which outlives the mapping.
+    jsonDocument.Parse(jsonFile.text, jsonFile.length);
+    if ( jsonDocument.HasParseError() ) {
+        string exceptionMsgThrown;
+        exceptionMsgThrown.append("[ERROR] ");
+        exceptionMsgThrown.append("Could not parse ");
+        exceptionMsgThrown.append(fileName);
+        exceptionMsgThrown.append(" as a JSON document.\n");
+        throw exceptionMsgThrown;
+    }
+
+    nParsedFiles++;
+}
+
+string
+JSONDocumentCache::canonicalPath(const string& fileName)
+{
+    // Different paths to the same file share one cache entry.
+    // Files that do not exist keep their name (opening them will fail).
+    char resolvedPath[PATH_MAX];
+    if ( realpath(fileName.c_str(), resolvedPath) == NULL ) {
+        return fileName;
+    }
+    return resolvedPath;
+}
+
+JSONDocumentCache::FileStamp
+JSONDocumentCache::fileStamp(const string& filePath)
+{
+    // Files that do not exist have no time and size (opening them fails)
+    FileStamp stamp = {filePath, 0, -1};
+    struct stat fileStatus;
+    if ( stat(filePath.c_str(), &fileStatus) == 0 ) {
+        stamp.modificationTime = fileStatus.st_mtime;
+        stamp.size = fileStatus.st_size;
+    }
+    return stamp;
+}
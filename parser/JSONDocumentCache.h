@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+// This class reads the JSON input files. Files may extend a base file with
+//  an "extends" member, which is resolved with JSON merge-patch semantics
+//  (RFC 7386). Resolved base files are kept while the files they were read
+//  from are unchanged on disk, so a base is read and parsed only once, no
+//  matter how many files extend it. Files that are no base are read at
+//  every load and not kept.
+#ifndef JSONDOCUMENTCACHE_H
+#define JSONDOCUMENTCACHE_H
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <ctime>
+
+#include "rapidjson/include/rapidjson/document.h"
+
+using namespace std;
+
+class JSONDocumentCache
+{
+  public:
+    // Reads the resolved document of fileName into jsonDocument.
+    // It may be called from several threads at the same time.
+    static void load(const string& fileName,
+                     const string& fileType,
+                     rapidjson::Document& jsonDocument);
+
+    // Applies patch on top of target (RFC 7386)
+    static void mergePatch(rapidjson::Value& target,
+                           const rapidjson::Value& patch,
+                           rapidjson::Document::AllocatorType& allocator);
+
+    // Drops all resolved base documents (next loads read the files again)
+    static void clear();
+
+    // Number of files read and parsed so far
+    static atomic<unsigned int> nParsedFiles;
+
+  private:
+    // File a resolved document was read from, as it was when it was read
+    struct FileStamp {
+        string filePath;
+        time_t modificationTime;
+        long long size;
+    };
+
+    struct BaseDocument {
+        // The base file and all the files it extends
+        vector<FileStamp> sources;
+        shared_ptr<const rapidjson::Document> document;
+    };
+
+    // Reads fileName and resolves its base, if it extends one. The files
+    //  it was read from are appended to sources.
+    static void readDocument(const string& fileName,
+                             const string& fileType,
+                             vector<string>& extendsChain,
+                             rapidjson::Document& jsonDocument,
+                             vector<FileStamp>& sources);
+
+    static shared_ptr<const rapidjson::Document> resolveBase(
+            const string& fileName,
+            const string& fileType,
+            vector<string>& extendsChain,
+            vector<FileStamp>& sources);
+
+    // Resolved base document of filePath, NULL if there is none or if one
+    //  of its files changed since it was read
+    static shared_ptr<const rapidjson::Document> findBase(
+            const string& filePath,
+            vector<FileStamp>& sources);
+
+    static void parseFile(const string& fileName,
+                          const string& fileType,
+                          rapidjson::Document& jsonDocument);
+
+    static string canonicalPath(const string& fileName);
+
+    static FileStamp fileStamp(const string& filePath);
+
+    // Resolved base documents by canonical file path
+    static map<string, BaseDocument> baseDocuments;
+    static mutex baseDocumentsMutex;
+};
+
+#endif // JSONDOCUMENTCACHE_H
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#include "ParameterSweep.h"
+#include "InputParameters.h"
+
+#include <cmath>
+
+ParameterSweep::ParameterSweep(rapidjson::Document& techDocument,
+                               rapidjson::Document& archDocument)
+{
+    sweptValues.SetArray();
+    nPoints = 1;
+
+    collectSweeps(techDocument);
+    collectSweeps(archDocument);
+}
+
+void
+ParameterSweep::collectSweeps(rapidjson::Document& jsonDocument)
+{
+    if ( jsonDocument.IsObject() == false ) {
+        return;
+    }
+
+    for ( rapidjson::Value::MemberIterator member = jsonDocument.MemberBegin();
+          member != jsonDocument.MemberEnd();
+          ++member ) {
+        const rapidjson::Value& sweepSpec = member->value;
+        if ( sweepSpec.IsObject() == false
+             || ( sweepSpec.HasMember("range") == false
+                  && sweepSpec.HasMember("list") == false ) ) {
+            continue;
+        }
+
+        string memberName = member->name.GetString();
+        if ( findInputParameter(memberName.c_str(), memberName.size()) == -1 ) {
+            string exceptionMsgThrown;
+            exceptionMsgThrown.append("[ERROR] ");
+            exceptionMsgThrown.append("Sweep of member \"");
+            exceptionMsgThrown.append(memberName);
+            exceptionMsgThrown.append("\" does not match any input value!\n");
+            throw exceptionMsgThrown;
+        }
+
+        // Members in both documents (e.g., added by an override) are
+        //  swept together, not combined with each other
+        bool isAlreadySwept = false;
+        for ( SweptMember& sweptMember : sweptMembers ) {
+            if ( sweptMember.memberName == memberName ) {
+                sweptMember.jsonDocuments.push_back(&jsonDocument);
+                isAlreadySwept = true;
+            }
+        }
+        if ( isAlreadySwept ) {
+            continue;
+        }
+
+        rapidjson::Value values(rapidjson::kArrayType);
+        expandSweep(memberName, sweepSpec, values);
+
+        // Every value of this member is combined with every point so far.
+        // Counted in double, so that a too large product cannot wrap.
+        if ( static_cast<double>(nPoints) * values.Size() > maxPoints ) {
+            string exceptionMsgThrown;
+            exceptionMsgThrown.append("[ERROR] ");
+            exceptionMsgThrown.append("Sweep of member \"");
+            exceptionMsgThrown.append(memberName);
+            exceptionMsgThrown.append("\" makes the sweep exceed ");
+            exceptionMsgThrown.append(to_string(maxPoints));
+            exceptionMsgThrown.append(" points!\n");
+            throw exceptionMsgThrown;
+        }
+        nPoints *= values.Size();
+
+        SweptMember sweptMember;
+        sweptMember.jsonDocuments.push_back(&jsonDocument);
+        sweptMember.memberName = memberName;
+        sweptMembers.push_back(sweptMember);
+        sweptValues.PushBack(values, sweptValues.GetAllocator());
+    }
+}
+
+void
+ParameterSweep::expandSweep(const string& memberName,
+                            const rapidjson::Value& sweepSpec,
+                            rapidjson::Value& values)
+{
+    rapidjson::Document::AllocatorType& allocator = sweptValues.GetAllocator();
+
+    string exceptionMsgThrown;
+    exceptionMsgThrown.append("[ERROR] ");
+    exceptionMsgThrown.append("Sweep of member \"");
+    exceptionMsgThrown.append(memberName);
+    exceptionMsgThrown.append("\" ");
+
+    if ( sweepSpec.MemberCount() != 1 ) {
+        exceptionMsgThrown.append("must have either a \"range\" ");
+        exceptionMsgThrown.append("or a \"list\" member!\n");
+        throw exceptionMsgThrown;
+    }
+
+    if ( sweepSpec.HasMember("list") ) {
+        const rapidjson::Value& list = sweepSpec["list"];
+        if ( list.IsArray() == false || list.Size() == 0 ) {
+            exceptionMsgThrown.append("is expected to have ");
+            exceptionMsgThrown.append("a non-empty list of values!\n");
+            throw exceptionMsgThrown;
+        }
+        for ( rapidjson::SizeType valueID = 0;
+              valueID < list.Size();
+              valueID++ ) {
+            rapidjson::Value value(list[valueID], allocator);
+            values.PushBack(value, allocator);
+        }
+        return;
+    }
+
+    const rapidjson::Value& range = sweepSpec["range"];
+    if ( range.IsArray() == false || range.Size() != 3
+         || range[0].IsNumber() == false
+         || range[1].IsNumber() == false
+         || range[2].IsNumber() == false ) {
+        exceptionMsgThrown.append("is expected to have ");
+        exceptionMsgThrown.append("a range of numbers [first, last, step]!\n");
+        throw exceptionMsgThrown;
+    }
+    double first = range[0].GetDouble();
+    double last = range[1].GetDouble();
+    double step = range[2].GetDouble();
+    if ( step <= 0 || last < first ) {
+        exceptionMsgThrown.append("is expected to have ");
+        exceptionMsgThrown.append("a positive step and first <= last!\n");
+        throw exceptionMsgThrown;
+    }
+
+    // The last value is included when it falls on a step.
+    // The small tolerance keeps it despite floating point rounding.
+    double nRangeValues = floor( (last - first) / step + 1e-9 ) + 1;
+    if ( !(nRangeValues <= maxPoints) ) {
+        exceptionMsgThrown.append("has more than ");
+        exceptionMsgThrown.append(to_string(maxPoints));
+        exceptionMsgThrown.append(" values!\n");
+        throw exceptionMsgThrown;
+    }
+    unsigned int nValues = nRangeValues;
+    for ( unsigned int valueID = 0; valueID < nValues; valueID++ ) {
+        double value = first + valueID * step;
+        // Whole numbers are kept as integers (e.g., 800 and not 800.0)
+        if ( value == floor(value) && fabs(value) < 1e15 ) {
+            values.PushBack(static_cast<int64_t>(value), allocator);
+        }
+        else {
+            values.PushBack(value, allocator);
+        }
+    }
+}
+
+vector<unsigned int>
+ParameterSweep::valueIndexes(unsigned int pointID) const
+{
+    vector<unsigned int> indexes(sweptMembers.size());
+    for ( rapidjson::SizeType memberID = sweptMembers.size();
+          memberID-- > 0; ) {
+        unsigned int nValues = sweptValues[memberID].Size();
+        indexes[memberID] = pointID % nValues;
+        pointID /= nValues;
+    }
+    return indexes;
+}
+
+void
+ParameterSweep::setPoint(unsigned int pointID)
+{
+    vector<unsigned int> indexes = valueIndexes(pointID);
+    for ( rapidjson::SizeType memberID = 0;
+          memberID < sweptMembers.size();
+          memberID++ ) {
+        const char* memberName = sweptMembers[memberID].memberName.c_str();
+        for ( rapidjson::Document* jsonDocument
+              : sweptMembers[memberID].jsonDocuments ) {
+            (*jsonDocument)[memberName].CopyFrom(
+                        sweptValues[memberID][indexes[memberID]],
+                        jsonDocument->GetAllocator());
+        }
+    }
+}
+
+string
+ParameterSweep::pointDescription(unsigned int pointID) const
+{
+    vector<unsigned int> indexes = valueIndexes(pointID);
+    string description;
+    for ( rapidjson::SizeType memberID = 0;
+          memberID < sweptMembers.size();
+          memberID++ ) {
+        rapidjson::StringBuffer valueBuffer;
+        rapidjson::Writer<rapidjson::StringBuffer> valueWriter(valueBuffer);
+        sweptValues[memberID][indexes[memberID]].Accept(valueWriter);
+
+        if ( memberID > 0 ) {
+            description.append(", ");
+        }
+        description.append(sweptMembers[memberID].memberName);
+        description.append("=");
+        description.append(valueBuffer.GetString());
+    }
+    return description;
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+// This class expands the sweep specifications found in the input documents.
+// A member holding {"range": [first, last, step]} or {"list": [v1, v2, ...]}
+//  instead of a single value is swept, and the points of the sweep are all
+//  the combinations of the values of the swept members (product space).
+#ifndef PARAMETERSWEEP_H
+#define PARAMETERSWEEP_H
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "rapidjson/include/rapidjson/document.h"
+#include "rapidjson/include/rapidjson/writer.h"
+#include "rapidjson/include/rapidjson/stringbuffer.h"
+
+using namespace std;
+
+class ParameterSweep
+{
+  public:
+    // Collects the sweep specifications of both documents.
+    // The documents must outlive the ParameterSweep object.
+    ParameterSweep(rapidjson::Document& techDocument,
+                   rapidjson::Document& archDocument);
+
+    // Member being swept and the documents it belongs to
+    struct SweptMember {
+        vector<rapidjson::Document*> jsonDocuments;
+        string memberName;
+    };
+    vector<SweptMember> sweptMembers;
+
+    // Values of each swept member, one array per member
+    rapidjson::Document sweptValues;
+
+    // Number of points of the product space (1 if nothing is swept)
+    unsigned int nPoints;
+
+    // Largest number of points of a sweep (and of values of a range)
+    static const unsigned int maxPoints = 100000000;
+
+    // Sets every swept member of the documents to its value at pointID.
+    // The last swept member changes the fastest.
+    void setPoint(unsigned int pointID);
+
+    // "Member=value" list of the swept values at pointID
+    string pointDescription(unsigned int pointID) const;
+
+  private:
+    void collectSweeps(rapidjson::Document& jsonDocument);
+
+    void expandSweep(const string& memberName,
+                     const rapidjson::Value& sweepSpec,
+                     rapidjson::Value& values);
+
+    // Index of the value of each swept member at pointID
+    vector<unsigned int> valueIndexes(unsigned int pointID) const;
+};
+
+#endif // PARAMETERSWEEP_H
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "ResultCache.h"
+
+#include <cstdio>
+#include <sys/stat.h>
+#include <unistd.h>
+
+ResultCache::ResultCache(const string& cacheDirectory)
+{
+    directory = cacheDirectory;
+    nHits = 0;
+    nMisses = 0;
+
+    // Create the cache directory if it does not exist yet
+    struct stat directoryStatus;
+    if ( stat(directory.c_str(), &directoryStatus) != 0 ) {
+        mkdir(directory.c_str(), 0755);
+    }
+    if ( stat(directory.c_str(), &directoryStatus) != 0
+         || S_ISDIR(directoryStatus.st_mode) == false ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not use result cache directory: ");
+        exceptionMsgThrown.append(directory);
+        exceptionMsgThrown.append("!\n");
+        throw exceptionMsgThrown;
+    }
+}
+
+string
+ResultCache::computeKey(const TechnologyValues& technologyValues,
+                        const bool IOTerminationCurrentFlag) const
+{
+    // The version is part of the key, so entries written by any other
+    //  version of the model are never found (automatic invalidation).
+    string keyText("DRAMSpecVersion=");
+    keyText.append(DRAMSPEC_VERSION);
+    keyText.append("\nIOTerminationCurrent=");
+    keyText.append(IOTerminationCurrentFlag ? "1" : "0");
+    keyText.append("\n");
+    keyText.append(technologyValues.canonicalValues());
+
+    return hashString(keyText);
+}
+
+string
+ResultCache::entryFileName(const string& key) const
+{
+    string fileName(directory);
+    fileName.append("/");
+    fileName.append(key);
+    fileName.append(".json");
+    return fileName;
+}
+
+bool
+ResultCache::load(const string& key, Current& dram)
+{
+    ifstream entryFile(entryFileName(key));
+    if ( entryFile.is_open() == false ) {
+        nMisses++;
+        return false;
+    }
+    stringstream entryText;
+    entryText << entryFile.rdbuf();
+    entryFile.close();
+
+    rapidjson::Document entryDocument;
+    entryDocument.Parse(entryText.str().c_str());
+
+    // Damaged entries or entries from another version are just misses
+    if ( entryDocument.HasParseError()
+         || entryDocument.IsObject() == false
+         || entryDocument.HasMember("DRAMSpecVersion") == false
+         || entryDocument["DRAMSpecVersion"].IsString() == false
+         || string(entryDocument["DRAMSpecVersion"].GetString())
+            != DRAMSPEC_VERSION
+         || entryDocument.HasMember("Warning") == false
+         || entryDocument["Warning"].IsString() == false
+         || entryDocument.HasMember("Results") == false
+         || entryDocument["Results"].IsObject() == false ) {
+        nMisses++;
+        return false;
+    }
+
+    const rapidjson::Value& results = entryDocument["Results"];
+#define CHECK_RESULT_FIELD(fieldName) \
+    if ( results.HasMember(#fieldName) == false \
+         || results[#fieldName].IsNumber() == false ) { \
+        nMisses++; \
+        return false; \
+    }
+    DRAMSPEC_RESULT_FIELDS(CHECK_RESULT_FIELD)
+#undef CHECK_RESULT_FIELD
+
+#define LOAD_RESULT_FIELD(fieldName) \
+    setResultFieldValue(dram.fieldName, results[#fieldName].GetDouble());
+    DRAMSPEC_RESULT_FIELDS(LOAD_RESULT_FIELD)
+#undef LOAD_RESULT_FIELD
+
+    dram.warning = entryDocument["Warning"].GetString();
+
+    nHits++;
+    return true;
+}
+
+void
+ResultCache::store(const string& key, const Current& dram) const
+{
+    rapidjson::StringBuffer entryBuffer;
+    rapidjson::Writer<rapidjson::StringBuffer> entryWriter(entryBuffer);
+
+    bool isWritten = entryWriter.StartObject();
+    entryWriter.Key("DRAMSpecVersion");
+    entryWriter.String(DRAMSPEC_VERSION);
+    entryWriter.Key("Warning");
+    entryWriter.String(dram.warning.c_str());
+    entryWriter.Key("Results");
+    entryWriter.StartObject();
+    // The writer refuses non finite numbers, such entries are not stored
+#define STORE_RESULT_FIELD(fieldName) \
+    entryWriter.Key(#fieldName); \
+    isWritten = entryWriter.Double(resultFieldValue(dram.fieldName)) \
+                && isWritten;
+    DRAMSPEC_RESULT_FIELDS(STORE_RESULT_FIELD)
+#undef STORE_RESULT_FIELD
+    entryWriter.EndObject();
+    entryWriter.EndObject();
+
+    if ( isWritten == false ) {
+        return;
+    }
+
+    // Write to a temporary file first and rename it afterwards, so that
+    //  concurrent runs never read a partially written entry.
+    string entryName = entryFileName(key);
+    string temporaryName(entryName);
+    temporaryName.append(".tmp");
+    temporaryName.append(to_string(getpid()));
+
+    ofstream entryFile(temporaryName, ofstream::trunc);
+    if ( entryFile.is_open() == false ) {
+        return;
+    }
+    entryFile << entryBuffer.GetString();
+    entryFile.close();
+
+    if ( entryFile.fail()
+         || rename(temporaryName.c_str(), entryName.c_str()) != 0 ) {
+        remove(temporaryName.c_str());
+    }
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+// This class implements a persistent, content-addressed cache of results.
+// Each entry is a small JSON file named after a hash of the input values,
+//  of the flags that change the results and of the DRAMSpec version.
+#ifndef RESULTCACHE_H
+#define RESULTCACHE_H
+
+#include "ResultFields.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "rapidjson/include/rapidjson/document.h"
+#include "rapidjson/include/rapidjson/writer.h"
+#include "rapidjson/include/rapidjson/stringbuffer.h"
+
+using namespace std;
+
+class ResultCache
+{
+  public:
+    ResultCache(const string& cacheDirectory);
+
+    // Directory where the cache entries are stored
+    string directory;
+
+    // Number of lookups that found (or not) a valid entry
+    unsigned int nHits;
+    unsigned int nMisses;
+
+    string computeKey(const TechnologyValues& technologyValues,
+                      const bool IOTerminationCurrentFlag) const;
+
+    // Restores the results of the given key into dram.
+    // Returns false if there is no valid entry for that key.
+    bool load(const string& key, Current& dram);
+
+    // Stores the results of dram under the given key.
+    // Failing to write an entry is not an error, it just won't be reused.
+    void store(const string& key, const Current& dram) const;
+
+  private:
+    string entryFileName(const string& key) const;
+};
+
+#endif // RESULTCACHE_H
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+// List of the results of a computed DRAM (Current object) that are written
+//  to the output files. It is used wherever the results must be handled
+//  as a whole, as when storing or restoring them from the result cache.
+#ifndef RESULTFIELDS_H
+#define RESULTFIELDS_H
+
+#include "../core/Current.h"
+
+// Applies the given macro to every result field of a Current object
+#define DRAMSPEC_RESULT_FIELDS(FIELD) \
+    FIELD(dramFreq) \
+    FIELD(dramCoreFreq) \
+    FIELD(maxCoreFreq) \
+    FIELD(trcd) \
+    FIELD(tcas) \
+    FIELD(tras) \
+    FIELD(trp) \
+    FIELD(trc) \
+    FIELD(trl) \
+    FIELD(trtp) \
+    FIELD(tccd) \
+    FIELD(twr) \
+    FIELD(trfc) \
+    FIELD(trefI) \
+    FIELD(trcd_clk) \
+    FIELD(tcas_clk) \
+    FIELD(tcas_coreClk) \
+    FIELD(tras_clk) \
+    FIELD(trp_clk) \
+    FIELD(trc_clk) \
+    FIELD(trl_clk) \
+    FIELD(trl_coreClk) \
+    FIELD(twl_clk) \
+    FIELD(trtp_clk) \
+    FIELD(tccd_clk) \
+    FIELD(tccd_coreClk) \
+    FIELD(twr_clk) \
+    FIELD(trfc_clk) \
+    FIELD(trefI_clk) \
+    FIELD(IDD0) \
+    FIELD(IPP0) \
+    FIELD(IDD1) \
+    FIELD(IPP1) \
+    FIELD(IDD2n) \
+    FIELD(IDD3n) \
+    FIELD(IPP3n) \
+    FIELD(rho) \
+    FIELD(IDD4R) \
+    FIELD(IDD4W) \
+    FIELD(IDD5b) \
+    FIELD(IPP5b) \
+    FIELD(subArrayHeight) \
+    FIELD(subArrayWidth) \
+    FIELD(tileHeight) \
+    FIELD(tileWidth) \
+    FIELD(bankHeight) \
+    FIELD(bankWidth) \
+    FIELD(channelHeight) \
+    FIELD(channelWidth) \
+    FIELD(channelArea)
+
+// Raw value of a result field (in the unit it is stored with)
+template<class Unit>
+double resultFieldValue(const bu::quantity<Unit>& field)
+{
+    return field.value();
+}
+
+inline double resultFieldValue(const double& field)
+{
+    return field;
+}
+
+// Sets a result field from its raw value
+template<class Unit>
+void setResultFieldValue(bu::quantity<Unit>& field, double value)
+{
+    field = bu::quantity<Unit>::from_value(value);
+}
+
+inline void setResultFieldValue(double& field, double value)
+{
+    field = value;
+}
+
+#endif // RESULTFIELDS_H
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+#include "RunCheckpoint.h"
+#include "../utils/MappedFile.h"
+#include "../utils/utils.h"
+
+#include <cstdio>
+#include <unistd.h>
+
+#include "rapidjson/include/rapidjson/document.h"
+#include "rapidjson/include/rapidjson/filewritestream.h"
+#include "rapidjson/include/rapidjson/writer.h"
+
+RunCheckpoint::RunCheckpoint()
+{
+    version = DRAMSPEC_VERSION;
+    nWrittenConfigurations = 0;
+    nEvaluatedConfigurations = 0;
+    columnarFileSize = 0;
+    isComplete = false;
+}
+
+void
+RunCheckpoint::write(const string& fileName) const
+{
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Could not write checkpoint: ");
+    exceptionMsgThrown.append(fileName);
+    exceptionMsgThrown.append("!\n");
+
+    // Written to a temporary file, synced and renamed, so that a run killed
+    //  at any time leaves either the previous or the new checkpoint
+    string temporaryName(fileName);
+    temporaryName.append(".tmp");
+    FILE* checkpointFile = fopen(temporaryName.c_str(), "wb");
+    if ( checkpointFile == NULL ) {
+        throw exceptionMsgThrown;
+    }
+
+    char buffer[4096];
+    rapidjson::FileWriteStream checkpointStream(checkpointFile,
+                                                buffer, sizeof(buffer));
+    rapidjson::Writer<rapidjson::FileWriteStream>
+            checkpointWriter(checkpointStream);
+    checkpointWriter.StartObject();
+    checkpointWriter.Key("DRAMSpecVersion");
+    checkpointWriter.String(version.c_str());
+    checkpointWriter.Key("arguments");
+    checkpointWriter.StartArray();
+    for ( const string& argument : arguments ) {
+        checkpointWriter.String(argument.c_str());
+    }
+    checkpointWriter.EndArray();
+    checkpointWriter.Key("filePairsHash");
+    checkpointWriter.String(filePairsHash.c_str());
+    checkpointWriter.Key("writtenSweepsHash");
+    checkpointWriter.String(writtenSweepsHash.c_str());
+    checkpointWriter.Key("nWrittenConfigurations");
+    checkpointWriter.Uint(nWrittenConfigurations);
+    checkpointWriter.Key("nEvaluatedConfigurations");
+    checkpointWriter.Uint(nEvaluatedConfigurations);
+    checkpointWriter.Key("columnarFileSize");
+    checkpointWriter.Uint64(columnarFileSize);
+    checkpointWriter.Key("isComplete");
+    checkpointWriter.Bool(isComplete);
+    checkpointWriter.EndObject();
+    checkpointStream.Flush();
+
+    bool isWritten = ( fflush(checkpointFile) == 0 )
+                     && ( fsync(fileno(checkpointFile)) == 0 );
+    isWritten = ( fclose(checkpointFile) == 0 ) && isWritten;
+    if ( isWritten == false
+         || rename(temporaryName.c_str(), fileName.c_str()) != 0 ) {
+        remove(temporaryName.c_str());
+        throw exceptionMsgThrown;
+    }
+}
+
+bool
+RunCheckpoint::read(const string& fileName)
+{
+    MappedFile checkpointFile(fileName);
+    if ( checkpointFile.isOpen == false ) {
+        return false;
+    }
+
+    rapidjson::Document checkpoint;
+    checkpoint.Parse(checkpointFile.text, checkpointFile.length);
+    if ( checkpoint.HasParseError()
+         || checkpoint.IsObject() == false
+         || checkpoint.HasMember("DRAMSpecVersion") == false
+         || checkpoint["DRAMSpecVersion"].IsString() == false
+         || checkpoint.HasMember("arguments") == false
+         || checkpoint["arguments"].IsArray() == false
+         || checkpoint.HasMember("filePairsHash") == false
+         || checkpoint["filePairsHash"].IsString() == false
+         || checkpoint.HasMember("writtenSweepsHash") == false
+         || checkpoint["writtenSweepsHash"].IsString() == false
+         || checkpoint.HasMember("nWrittenConfigurations") == false
+         || checkpoint["nWrittenConfigurations"].IsUint() == false
+         || checkpoint.HasMember("nEvaluatedConfigurations") == false
+         || checkpoint["nEvaluatedConfigurations"].IsUint() == false
+         || checkpoint.HasMember("columnarFileSize") == false
+         || checkpoint["columnarFileSize"].IsUint64() == false
+         || checkpoint.HasMember("isComplete") == false
+         || checkpoint["isComplete"].IsBool() == false ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Checkpoint is damaged: ");
+        exceptionMsgThrown.append(fileName);
+        exceptionMsgThrown.append("!\n");
+        throw exceptionMsgThrown;
+    }
+
+    version = checkpoint["DRAMSpecVersion"].GetString();
+    arguments.clear();
+    const rapidjson::Value& argumentList = checkpoint["arguments"];
+    for ( rapidjson::SizeType argumentID = 0;
+          argumentID < argumentList.Size();
+          argumentID++ ) {
+        if ( argumentList[argumentID].IsString() ) {
+            arguments.push_back(argumentList[argumentID].GetString());
+        }
+    }
+    filePairsHash = checkpoint["filePairsHash"].GetString();
+    writtenSweepsHash = checkpoint["writtenSweepsHash"].GetString();
+    nWrittenConfigurations = checkpoint["nWrittenConfigurations"].GetUint();
+    nEvaluatedConfigurations
+            = checkpoint["nEvaluatedConfigurations"].GetUint();
+    columnarFileSize = checkpoint["columnarFileSize"].GetUint64();
+    isComplete = checkpoint["isComplete"].GetBool();
+    return true;
+}
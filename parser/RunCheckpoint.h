@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+// Progress of a run, saved periodically with -checkpoint so that a run
+//  that is killed can go on where it stopped with --resume. The results
+//  are written in the order of the configurations, so the progress is the
+//  number of configurations written so far, plus the state of the outputs
+//  that are appended to (the columnar result file) and of the summary.
+#ifndef RUNCHECKPOINT_H
+#define RUNCHECKPOINT_H
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+using namespace std;
+
+class RunCheckpoint
+{
+  public:
+    RunCheckpoint();
+
+    string version;
+    // Arguments of the run (ArgumentsParser::runArguments)
+    vector<string> arguments;
+    // Input file pairs of the run (ArgumentsParser::filePairsHash)
+    string filePairsHash;
+    // Hash of the number of sweep points of the file pairs of the written
+    //  configurations, so that a resumed run whose files were changed is
+    //  rejected (configurations are skipped by their position)
+    string writtenSweepsHash;
+    // Configurations whose results are written (the first ones of the run)
+    unsigned int nWrittenConfigurations;
+    // Configurations among them that were evaluated (not reused)
+    unsigned int nEvaluatedConfigurations;
+    // Size of the columnar result file with those results, if any
+    uint64_t columnarFileSize;
+    // Set once every configuration of the run is written
+    bool isComplete;
+
+    // Replaces the checkpoint file at once (never partially written)
+    void write(const string& fileName) const;
+    // Returns false if the checkpoint file does not exist
+    bool read(const string& fileName);
+};
+
+#endif // RUNCHECKPOINT_H
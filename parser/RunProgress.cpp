@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+#include "RunProgress.h"
+#include "../utils/NumberFormat.h"
+#include "../utils/utils.h"
+
+#include <cstdio>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "rapidjson/include/rapidjson/stringbuffer.h"
+#include "rapidjson/include/rapidjson/writer.h"
+
+const int RunProgress::reportInterval;
+
+namespace {
+
+const char* stageNames[RunProgress::N_STAGES] = { "read", "compute", "write" };
+
+// Resident set size of the process, or its peak where it is not available
+double residentMemoryBytes()
+{
+    ifstream statm("/proc/self/statm");
+    unsigned long nTotalPages;
+    unsigned long nResidentPages;
+    if ( statm >> nTotalPages >> nResidentPages ) {
+        return (double) nResidentPages * sysconf(_SC_PAGESIZE);
+    }
+    rusage usage;
+    if ( getrusage(RUSAGE_SELF, &usage) == 0 ) {
+        return (double) usage.ru_maxrss * 1024;
+    }
+    return 0;
+}
+
+// e.g. "45s", "3m12s", "2h05m"
+string formatDuration(double seconds)
+{
+    unsigned long wholeSeconds = (unsigned long) (seconds + 0.5);
+    char text[32];
+    if ( wholeSeconds < 60 ) {
+        snprintf(text, sizeof(text), "%lus", wholeSeconds);
+    }
+    else if ( wholeSeconds < 3600 ) {
+        snprintf(text, sizeof(text), "%lum%02lus",
+                 wholeSeconds / 60, wholeSeconds % 60);
+    }
+    else {
+        snprintf(text, sizeof(text), "%luh%02lum",
+                 wholeSeconds / 3600, wholeSeconds / 60 % 60);
+    }
+    return text;
+}
+
+void appendMetric(string& metrics,
+                  const char* name,
+                  const char* type,
+                  const char* help,
+                  double value)
+{
+    metrics.append("# HELP ");
+    metrics.append(name);
+    metrics.push_back(' ');
+    metrics.append(help);
+    metrics.append("\n# TYPE ");
+    metrics.append(name);
+    metrics.push_back(' ');
+    metrics.append(type);
+    metrics.push_back('\n');
+    metrics.append(name);
+    metrics.push_back(' ');
+    char number[NUMBER_BUFFER_SIZE];
+    metrics.append(number, formatShortestNumber(value, number));
+    metrics.push_back('\n');
+}
+
+}
+
+RunProgress::StageTimer::StageTimer(RunProgress * progress, Stage stage)
+    : progress(progress), stage(stage)
+{
+    isRunning = false;
+    resume();
+}
+
+RunProgress::StageTimer::~StageTimer()
+{
+    pause();
+}
+
+void
+RunProgress::StageTimer::pause()
+{
+    if ( isRunning ) {
+        progress->addStageTime(stage,
+                               chrono::steady_clock::now() - startTime);
+        isRunning = false;
+    }
+}
+
+void
+RunProgress::StageTimer::resume()
+{
+    if ( progress != NULL && !isRunning ) {
+        startTime = chrono::steady_clock::now();
+        isRunning = true;
+    }
+}
+
+RunProgress::RunProgress()
+{
+    startTime = chrono::steady_clock::now();
+    nFiles = 0;
+    nFilesRead = 0;
+    nFileConfigurations = 0;
+    nDone = 0;
+    nResumed = 0;
+    nErrors = 0;
+    for ( int stage = 0; stage < N_STAGES; stage++ ) {
+        stageNanoseconds[stage] = 0;
+    }
+    isPrinted = false;
+    metricsServer = NULL;
+    state = "running";
+    isStopping = false;
+}
+
+RunProgress::~RunProgress()
+{
+    // Without a report: the run stopped without stop(), on an error
+    {
+        lock_guard<mutex> lock(reportMutex);
+        isStopping = true;
+    }
+    stopCondition.notify_all();
+    if ( reporter.joinable() ) {
+        reporter.join();
+    }
+    delete metricsServer;
+}
+
+void
+RunProgress::setFiles(unsigned long nInputFiles)
+{
+    nFiles = nInputFiles;
+}
+
+void
+RunProgress::addFile(unsigned long nConfigurations)
+{
+    nFileConfigurations += nConfigurations;
+    nFilesRead++;
+}
+
+void
+RunProgress::addDone(bool isResumed)
+{
+    nDone++;
+    if ( isResumed ) {
+        nResumed++;
+    }
+}
+
+void
+RunProgress::addError()
+{
+    nErrors++;
+}
+
+void
+RunProgress::addStageTime(Stage stage, chrono::steady_clock::duration time)
+{
+    stageNanoseconds[stage]
+            += chrono::duration_cast<chrono::nanoseconds>(time).count();
+}
+
+void
+RunProgress::start(bool isReportPrinted,
+                   const string& reportFileName,
+                   unsigned int metricsPort)
+{
+    isPrinted = isReportPrinted;
+    statusFileName = reportFileName;
+    if ( !isPrinted && statusFileName.empty() && metricsPort == 0 ) {
+        return;
+    }
+
+    // Errors are reported at once, not after the first interval
+    if ( !statusFileName.empty() ) {
+        writeStatusFile();
+    }
+    if ( metricsPort != 0 ) {
+        metricsServer = new MetricsServer(metricsPort,
+                                          [this]() { return metricsText(); });
+    }
+
+    reporter = thread([this]() {
+        unique_lock<mutex> lock(reportMutex);
+        while ( !stopCondition.wait_for(lock, chrono::seconds(reportInterval),
+                                        [this]() { return isStopping; }) ) {
+            lock.unlock();
+            report();
+            lock.lock();
+        }
+    });
+}
+
+void
+RunProgress::stop(const string& finalState)
+{
+    {
+        lock_guard<mutex> lock(reportMutex);
+        if ( isStopping ) {
+            return;
+        }
+        isStopping = true;
+        state = finalState;
+    }
+    stopCondition.notify_all();
+    if ( !reporter.joinable() ) {
+        return;
+    }
+    reporter.join();
+    report();
+}
+
+void
+RunProgress::report()
+{
+    if ( isPrinted ) {
+        cerr << progressLine() << endl;
+    }
+    if ( !statusFileName.empty() ) {
+        // A status that cannot be written is reported at the next interval
+        try {
+            writeStatusFile();
+        } catch(string exceptionMsgThrown) {
+        }
+    }
+}
+
+RunProgress::Snapshot
+RunProgress::snapshot() const
+{
+    Snapshot current;
+    current.elapsedSeconds = chrono::duration<double>(
+                chrono::steady_clock::now() - startTime).count();
+    current.nDone = nDone;
+    current.nErrors = nErrors;
+
+    unsigned long nFilesTotal = nFiles;
+    unsigned long nFilesDone = nFilesRead;
+    current.nPlanned = 0;
+    current.isPlannedEstimated = false;
+    if ( nFilesTotal > 0 && nFilesDone > 0 ) {
+        current.nPlanned = nFileConfigurations;
+        if ( nFilesDone < nFilesTotal ) {
+            current.nPlanned *= (double) nFilesTotal / nFilesDone;
+            current.isPlannedEstimated = true;
+        }
+    }
+
+    current.configurationsPerSecond = 0;
+    if ( current.elapsedSeconds > 0 ) {
+        current.configurationsPerSecond = (current.nDone - nResumed)
+                                          / current.elapsedSeconds;
+    }
+    current.etaSeconds = -1;
+    if ( current.nPlanned > 0 && current.configurationsPerSecond > 0 ) {
+        current.etaSeconds = max(current.nPlanned - current.nDone, 0.0)
+                             / current.configurationsPerSecond;
+    }
+
+    current.residentMemoryBytes = residentMemoryBytes();
+    for ( int stage = 0; stage < N_STAGES; stage++ ) {
+        current.stageSeconds[stage] = stageNanoseconds[stage] / 1e9;
+    }
+    return current;
+}
+
+string
+RunProgress::progressLine() const
+{
+    Snapshot current = snapshot();
+    ostringstream line;
+    line << fixed << setprecision(1);
+    line << "[PROGRESS] " << current.nDone;
+    if ( current.nPlanned > 0 ) {
+        line << " of " << ( current.isPlannedEstimated ? "~" : "" )
+             << (unsigned long) (current.nPlanned + 0.5)
+             << " configurations ("
+             << min(100 * current.nDone / current.nPlanned, 100.0) << "%)";
+    }
+    else {
+        line << " configurations";
+    }
+    line << ", " << current.configurationsPerSecond << " configurations/s";
+    if ( current.etaSeconds >= 0 ) {
+        line << ", ETA " << formatDuration(current.etaSeconds);
+    }
+    line << ", " << current.nErrors << " errors"
+         << ", RSS " << current.residentMemoryBytes / (1024 * 1024) << " MB";
+
+    double busySeconds = 0;
+    for ( int stage = 0; stage < N_STAGES; stage++ ) {
+        busySeconds += current.stageSeconds[stage];
+    }
+    if ( busySeconds > 0 ) {
+        line << ", time in";
+        for ( int stage = 0; stage < N_STAGES; stage++ ) {
+            line << " " << stageNames[stage] << " " << setprecision(0)
+                 << 100 * current.stageSeconds[stage] / busySeconds << "%";
+        }
+    }
+    return line.str();
+}
+
+string
+RunProgress::statusJSON() const
+{
+    Snapshot current = snapshot();
+    string currentState;
+    {
+        lock_guard<mutex> lock(reportMutex);
+        currentState = state;
+    }
+
+    rapidjson::StringBuffer statusBuffer;
+    rapidjson::Writer<rapidjson::StringBuffer> statusWriter(statusBuffer);
+    statusWriter.StartObject();
+    statusWriter.Key("DRAMSpecVersion");
+    statusWriter.String(DRAMSPEC_VERSION);
+    statusWriter.Key("state");
+    statusWriter.String(currentState.c_str());
+    statusWriter.Key("elapsedSeconds");
+    statusWriter.Double(current.elapsedSeconds);
+    statusWriter.Key("configurationsDone");
+    statusWriter.Uint64(current.nDone);
+    // Unknown values are null
+    statusWriter.Key("configurationsPlanned");
+    if ( current.nPlanned > 0 ) {
+        statusWriter.Uint64((uint64_t) (current.nPlanned + 0.5));
+    }
+    else {
+        statusWriter.Null();
+    }
+    statusWriter.Key("isPlannedEstimated");
+    statusWriter.Bool(current.isPlannedEstimated);
+    statusWriter.Key("configurationsPerSecond");
+    statusWriter.Double(current.configurationsPerSecond);
+    statusWriter.Key("etaSeconds");
+    if ( current.etaSeconds >= 0 ) {
+        statusWriter.Double(current.etaSeconds);
+    }
+    else {
+        statusWriter.Null();
+    }
+    statusWriter.Key("errors");
+    statusWriter.Uint64(current.nErrors);
+    statusWriter.Key("residentMemoryBytes");
+    statusWriter.Uint64((uint64_t) current.residentMemoryBytes);
+    statusWriter.Key("stageSeconds");
+    statusWriter.StartObject();
+    for ( int stage = 0; stage < N_STAGES; stage++ ) {
+        statusWriter.Key(stageNames[stage]);
+        statusWriter.Double(current.stageSeconds[stage]);
+    }
+    statusWriter.EndObject();
+    statusWriter.EndObject();
+    return statusBuffer.GetString();
+}
+
+string
+RunProgress::metricsText() const
+{
+    Snapshot current = snapshot();
+    string metrics;
+    appendMetric(metrics, "dramspec_configurations_done", "counter",
+                 "Configurations whose results are written.",
+                 current.nDone);
+    // Metrics without a value are left out, as Prometheus expects
+    if ( current.nPlanned > 0 ) {
+        appendMetric(metrics, "dramspec_configurations_planned", "gauge",
+                     "Configurations of the run (estimated until all input "
+                     "files are read).", (uint64_t) (current.nPlanned + 0.5));
+    }
+    appendMetric(metrics, "dramspec_configurations_per_second", "gauge",
+                 "Configurations written per second since the start.",
+                 current.configurationsPerSecond);
+    if ( current.etaSeconds >= 0 ) {
+        appendMetric(metrics, "dramspec_eta_seconds", "gauge",
+                     "Estimated time until the run is finished.",
+                     current.etaSeconds);
+    }
+    appendMetric(metrics, "dramspec_errors", "counter",
+                 "Configurations that could not be evaluated.",
+                 current.nErrors);
+    appendMetric(metrics, "dramspec_resident_memory_bytes", "gauge",
+                 "Resident memory of the process.",
+                 current.residentMemoryBytes);
+    appendMetric(metrics, "dramspec_elapsed_seconds", "gauge",
+                 "Time since the start of the run.",
+                 current.elapsedSeconds);
+
+    metrics.append("# HELP dramspec_stage_seconds Time spent working in "
+                   "each stage of the pipeline.\n"
+                   "# TYPE dramspec_stage_seconds counter\n");
+    char number[NUMBER_BUFFER_SIZE];
+    for ( int stage = 0; stage < N_STAGES; stage++ ) {
+        metrics.append("dramspec_stage_seconds{stage=\"");
+        metrics.append(stageNames[stage]);
+        metrics.append("\"} ");
+        metrics.append(number, formatShortestNumber(
+                           current.stageSeconds[stage], number));
+        metrics.push_back('\n');
+    }
+    return metrics;
+}
+
+void
+RunProgress::writeStatusFile() const
+{
+    // Replaced at once, so that a reader never sees a partial status
+    string temporaryName(statusFileName);
+    temporaryName.append(".tmp");
+    ofstream statusFile(temporaryName, ofstream::trunc);
+    statusFile << statusJSON() << endl;
+    statusFile.close();
+    if ( statusFile.fail()
+         || rename(temporaryName.c_str(), statusFileName.c_str()) != 0 ) {
+        remove(temporaryName.c_str());
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not write status file: ");
+        exceptionMsgThrown.append(statusFileName);
+        exceptionMsgThrown.append("!\n");
+        throw exceptionMsgThrown;
+    }
+}
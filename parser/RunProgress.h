@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+// Progress of a run, for the telemetry of long batches: configurations
+//  done out of the planned ones, throughput, errors, estimated time left,
+//  memory used, and the time spent in each stage of the pipeline (reading
+//  the inputs, calculating, writing the results), which tells whether a
+//  run is limited by I/O or by computation.
+// The counters are updated by the stages as they go. Once started, the
+//  progress is reported periodically by a thread of its own: as a line on
+//  stderr, as a JSON status file and as Prometheus metrics on a local port.
+#ifndef RUNPROGRESS_H
+#define RUNPROGRESS_H
+
+#include "../utils/MetricsServer.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+class RunProgress
+{
+  public:
+    enum Stage { STAGE_READ, STAGE_COMPUTE, STAGE_WRITE, N_STAGES };
+
+    // Adds the time from its creation to its end to a stage, except for
+    //  the time it is paused (e.g. while waiting for another stage).
+    //  Does nothing without a progress.
+    class StageTimer
+    {
+      public:
+        StageTimer(RunProgress * progress, Stage stage);
+        ~StageTimer();
+        void pause();
+        void resume();
+
+      private:
+        RunProgress * progress;
+        Stage stage;
+        bool isRunning;
+        chrono::steady_clock::time_point startTime;
+    };
+
+    RunProgress();
+    ~RunProgress();
+
+    // The configurations of the run come from nFiles input file pairs,
+    //  and their number is known as each pair is read. Until the last one
+    //  is read, the total is estimated from the pairs read so far.
+    //  Without files (a stream), the total is unknown.
+    void setFiles(unsigned long nFiles);
+    void addFile(unsigned long nConfigurations);
+
+    // Configurations skipped because they were done before a resume are
+    //  done, but do not count in the throughput
+    void addDone(bool isResumed = false);
+    void addError();
+    void addStageTime(Stage stage, chrono::steady_clock::duration time);
+
+    // Reports every reportInterval seconds until stopped: on stderr if
+    //  isPrinted, to statusFileName and on metricsPort unless empty or 0.
+    //  Throws if the status file cannot be written or the port listened on.
+    void start(bool isPrinted,
+               const string& statusFileName,
+               unsigned int metricsPort);
+    // Reports a last time, with the state of the run ("finished", "failed")
+    void stop(const string& finalState);
+
+    // The reports
+    string progressLine() const;
+    string statusJSON() const;
+    string metricsText() const;
+
+    static const int reportInterval = 5;
+
+  private:
+    RunProgress(const RunProgress&);
+    RunProgress& operator=(const RunProgress&);
+
+    struct Snapshot {
+        double elapsedSeconds;
+        unsigned long nDone;
+        unsigned long nErrors;
+        // 0 if unknown
+        double nPlanned;
+        bool isPlannedEstimated;
+        double configurationsPerSecond;
+        // Negative if unknown
+        double etaSeconds;
+        double residentMemoryBytes;
+        double stageSeconds[N_STAGES];
+    };
+    Snapshot snapshot() const;
+    void report();
+    void writeStatusFile() const;
+
+    chrono::steady_clock::time_point startTime;
+    atomic<unsigned long> nFiles;
+    atomic<unsigned long> nFilesRead;
+    atomic<unsigned long> nFileConfigurations;
+    atomic<unsigned long> nDone;
+    atomic<unsigned long> nResumed;
+    atomic<unsigned long> nErrors;
+    atomic<long long> stageNanoseconds[N_STAGES];
+
+    bool isPrinted;
+    string statusFileName;
+    MetricsServer * metricsServer;
+    string state;
+
+    // The reporter thread waits on isStopping until the next report
+    bool isStopping;
+    mutable mutex reportMutex;
+    condition_variable stopCondition;
+    thread reporter;
+};
+
+#endif // RUNPROGRESS_H
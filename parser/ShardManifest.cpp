@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+#include "ShardManifest.h"
+#include "../utils/MappedFile.h"
+#include "../utils/utils.h"
+
+#include <cstdio>
+
+#include "rapidjson/include/rapidjson/document.h"
+#include "rapidjson/include/rapidjson/filewritestream.h"
+#include "rapidjson/include/rapidjson/prettywriter.h"
+
+ShardManifest::ShardManifest()
+{
+    version = DRAMSPEC_VERSION;
+    shardID = 0;
+    nShards = 0;
+    nRunConfigurations = 0;
+}
+
+string
+ShardManifest::manifestFileName(unsigned int shardID, unsigned int nShards)
+{
+    string fileName("shard_");
+    fileName.append(to_string(shardID));
+    fileName.append("_of_");
+    fileName.append(to_string(nShards));
+    fileName.append(".json");
+    return fileName;
+}
+
+void
+ShardManifest::write(const string& fileName) const
+{
+    // Written to a temporary file and renamed, so that a manifest is only
+    //  found once it is complete
+    string temporaryName(fileName);
+    temporaryName.append(".tmp");
+    FILE* manifestFile = fopen(temporaryName.c_str(), "wb");
+    if ( manifestFile == NULL ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not write shard manifest: ");
+        exceptionMsgThrown.append(fileName);
+        exceptionMsgThrown.append("!\n");
+        throw exceptionMsgThrown;
+    }
+
+    char buffer[64 * 1024];
+    rapidjson::FileWriteStream manifestStream(manifestFile,
+                                              buffer, sizeof(buffer));
+    rapidjson::PrettyWriter<rapidjson::FileWriteStream>
+            manifestWriter(manifestStream);
+
+    manifestWriter.StartObject();
+    manifestWriter.Key("DRAMSpecVersion");
+    manifestWriter.String(version.c_str());
+    manifestWriter.Key("shard");
+    manifestWriter.Uint(shardID);
+    manifestWriter.Key("nShards");
+    manifestWriter.Uint(nShards);
+    manifestWriter.Key("arguments");
+    manifestWriter.StartArray();
+    for ( const string& argument : arguments ) {
+        manifestWriter.String(argument.c_str());
+    }
+    manifestWriter.EndArray();
+    manifestWriter.Key("filePairsHash");
+    manifestWriter.String(filePairsHash.c_str());
+    manifestWriter.Key("sweepSizesHash");
+    manifestWriter.String(sweepSizesHash.c_str());
+    manifestWriter.Key("nRunConfigurations");
+    manifestWriter.Uint64(nRunConfigurations);
+    if ( !columnarFileName.empty() ) {
+        manifestWriter.Key("columnarFile");
+        manifestWriter.String(columnarFileName.c_str());
+    }
+    manifestWriter.Key("configurations");
+    manifestWriter.StartArray();
+    for ( const Configuration& configuration : configurations ) {
+        manifestWriter.StartObject();
+        manifestWriter.Key("configuration");
+        manifestWriter.Uint64(configuration.configuration);
+        manifestWriter.Key("technology");
+        manifestWriter.String(configuration.technologyFileName.c_str());
+        manifestWriter.Key("architecture");
+        manifestWriter.String(configuration.architectureFileName.c_str());
+        if ( !configuration.sweepPoint.empty() ) {
+            manifestWriter.Key("sweepPoint");
+            manifestWriter.String(configuration.sweepPoint.c_str());
+        }
+        if ( !configuration.outputFileNames.empty() ) {
+            manifestWriter.Key("files");
+            manifestWriter.StartArray();
+            for ( const string& outputFileName
+                  : configuration.outputFileNames ) {
+                manifestWriter.String(outputFileName.c_str());
+            }
+            manifestWriter.EndArray();
+        }
+        manifestWriter.EndObject();
+    }
+    manifestWriter.EndArray();
+    manifestWriter.EndObject();
+    manifestStream.Flush();
+
+    bool isWritten = ( ferror(manifestFile) == 0 );
+    isWritten = ( fclose(manifestFile) == 0 ) && isWritten;
+    if ( isWritten == false
+         || rename(temporaryName.c_str(), fileName.c_str()) != 0 ) {
+        remove(temporaryName.c_str());
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not write shard manifest: ");
+        exceptionMsgThrown.append(fileName);
+        exceptionMsgThrown.append("!\n");
+        throw exceptionMsgThrown;
+    }
+}
+
+void
+ShardManifest::throwReadError(const string& fileName,
+                              const string& reason) const
+{
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Could not read shard manifest ");
+    exceptionMsgThrown.append(fileName);
+    exceptionMsgThrown.append(": ");
+    exceptionMsgThrown.append(reason);
+    exceptionMsgThrown.append("!\n");
+    throw exceptionMsgThrown;
+}
+
+void
+ShardManifest::read(const string& fileName)
+{
+    MappedFile manifestFile(fileName);
+    if ( manifestFile.isOpen == false ) {
+        throwReadError(fileName, "the file could not be opened");
+    }
+    rapidjson::Document manifest;
+    manifest.Parse(manifestFile.text, manifestFile.length);
+    if ( manifest.HasParseError() || manifest.IsObject() == false ) {
+        throwReadError(fileName, "it is not a JSON object");
+    }
+
+    if ( manifest.HasMember("DRAMSpecVersion") == false
+         || manifest["DRAMSpecVersion"].IsString() == false
+         || manifest.HasMember("shard") == false
+         || manifest["shard"].IsUint() == false
+         || manifest.HasMember("nShards") == false
+         || manifest["nShards"].IsUint() == false
+         || manifest.HasMember("arguments") == false
+         || manifest["arguments"].IsArray() == false
+         || manifest.HasMember("filePairsHash") == false
+         || manifest["filePairsHash"].IsString() == false
+         || manifest.HasMember("sweepSizesHash") == false
+         || manifest["sweepSizesHash"].IsString() == false
+         || manifest.HasMember("nRunConfigurations") == false
+         || manifest["nRunConfigurations"].IsUint64() == false
+         || manifest.HasMember("configurations") == false
+         || manifest["configurations"].IsArray() == false
+         || ( manifest.HasMember("columnarFile")
+              && manifest["columnarFile"].IsString() == false ) ) {
+        throwReadError(fileName, "a member is missing or invalid");
+    }
+
+    version = manifest["DRAMSpecVersion"].GetString();
+    shardID = manifest["shard"].GetUint();
+    nShards = manifest["nShards"].GetUint();
+    filePairsHash = manifest["filePairsHash"].GetString();
+    sweepSizesHash = manifest["sweepSizesHash"].GetString();
+    nRunConfigurations = manifest["nRunConfigurations"].GetUint64();
+    columnarFileName = ( manifest.HasMember("columnarFile")
+                         ? manifest["columnarFile"].GetString() : "" );
+
+    arguments.clear();
+    const rapidjson::Value& argumentList = manifest["arguments"];
+    for ( rapidjson::SizeType argumentID = 0;
+          argumentID < argumentList.Size();
+          argumentID++ ) {
+        if ( argumentList[argumentID].IsString() == false ) {
+            throwReadError(fileName, "an argument is not a string");
+        }
+        arguments.push_back(argumentList[argumentID].GetString());
+    }
+
+    configurations.clear();
+    const rapidjson::Value& configurationList = manifest["configurations"];
+    for ( rapidjson::SizeType configurationID = 0;
+          configurationID < configurationList.Size();
+          configurationID++ ) {
+        const rapidjson::Value& entry = configurationList[configurationID];
+        if ( entry.IsObject() == false
+             || entry.HasMember("configuration") == false
+             || entry["configuration"].IsUint64() == false
+             || entry.HasMember("technology") == false
+             || entry["technology"].IsString() == false
+             || entry.HasMember("architecture") == false
+             || entry["architecture"].IsString() == false
+             || ( entry.HasMember("sweepPoint")
+                  && entry["sweepPoint"].IsString() == false )
+             || ( entry.HasMember("files")
+                  && entry["files"].IsArray() == false ) ) {
+            throwReadError(fileName, "a configuration is invalid");
+        }
+        Configuration configuration;
+        configuration.configuration = entry["configuration"].GetUint64();
+        configuration.technologyFileName = entry["technology"].GetString();
+        configuration.architectureFileName = entry["architecture"].GetString();
+        if ( entry.HasMember("sweepPoint") ) {
+            configuration.sweepPoint = entry["sweepPoint"].GetString();
+        }
+        if ( entry.HasMember("files") ) {
+            const rapidjson::Value& files = entry["files"];
+            for ( rapidjson::SizeType fileID = 0;
+                  fileID < files.Size();
+                  fileID++ ) {
+                if ( files[fileID].IsString() == false ) {
+                    throwReadError(fileName, "a configuration is invalid");
+                }
+                configuration.outputFileNames.push_back(
+                            files[fileID].GetString());
+            }
+        }
+        configurations.push_back(configuration);
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+// Description of the outputs of a sharded run (--shard i/N). Each shard
+//  writes one manifest next to its outputs, listing the arguments of the
+//  run, the configurations the shard evaluated and the files it wrote.
+//  dramspec-merge reads the manifests of all shards, checks that together
+//  they cover the whole run, and combines their outputs.
+#ifndef SHARDMANIFEST_H
+#define SHARDMANIFEST_H
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+using namespace std;
+
+class ShardManifest
+{
+  public:
+    ShardManifest();
+
+    string version;
+    // Shard of the run, from 1 to nShards (0 for a merged manifest)
+    unsigned int shardID;
+    unsigned int nShards;
+    // Arguments of the run, without the --shard flag
+    vector<string> arguments;
+    // Input file pairs of the run (ArgumentsParser::filePairsHash), and
+    //  hash of the number of sweep points of every pair
+    string filePairsHash;
+    string sweepSizesHash;
+    // Number of configurations of the whole run, over all shards
+    uint64_t nRunConfigurations;
+    // Columnar result file of the shard, empty if results are in
+    //  one file per configuration
+    string columnarFileName;
+
+    struct Configuration {
+        // Number of the configuration in the run, from 1
+        uint64_t configuration;
+        string technologyFileName;
+        string architectureFileName;
+        // Swept values, empty if nothing is swept
+        string sweepPoint;
+        // Result files of the configuration
+        vector<string> outputFileNames;
+    };
+    vector<Configuration> configurations;
+
+    // File name of the manifest of a shard, e.g. "shard_2_of_4.json"
+    static string manifestFileName(unsigned int shardID,
+                                   unsigned int nShards);
+
+    void write(const string& fileName) const;
+    void read(const string& fileName);
+
+  private:
+    void throwReadError(const string& fileName, const string& reason) const;
+};
+
+#endif // SHARDMANIFEST_H
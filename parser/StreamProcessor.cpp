@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#include "StreamProcessor.h"
+
+StreamProcessor::StreamProcessor(const ArgumentsParser& arguments,
+                                 ResultCache * configurationResultCache)
+    : arg(arguments)
+{
+    resultCache = configurationResultCache;
+    nThreads = arg.nThreads;
+    if ( nThreads == 0 ) {
+        nThreads = max(thread::hardware_concurrency(), 1u);
+    }
+    isUnordered = arg.isUnorderedStream;
+    maxLinesInFlight = 4 * nThreads;
+    progress = NULL;
+}
+
+void
+StreamProcessor::run(istream& input, ostream& output)
+{
+    BoundedQueue<StreamLine> inputLines(2 * nThreads);
+    BoundedQueue<StreamLine> resultLines(2 * nThreads);
+    // One token per line in flight: the reader takes one before reading
+    //  a line and the writer gives it back after writing its result
+    BoundedQueue<bool> linesInFlight(maxLinesInFlight);
+
+    vector<thread> workers;
+    for ( unsigned int threadID = 0; threadID < nThreads; threadID++ ) {
+        workers.push_back(thread([&]() {
+            StreamLine line;
+            while ( inputLines.pop(line) ) {
+                line.text = evaluateLine(line.text, line.lineNumber);
+                resultLines.push(move(line));
+            }
+        }));
+    }
+
+    thread writer([&]() {
+        // Results arriving before their turn wait here (ordered mode only).
+        // They are at most maxLinesInFlight, thanks to the tokens.
+        map<unsigned long, string> earlyResults;
+        unsigned long nextSequenceNumber = 0;
+        StreamLine result;
+        bool token;
+        while ( resultLines.pop(result) ) {
+            RunProgress::StageTimer writeTimer(progress,
+                                               RunProgress::STAGE_WRITE);
+            if ( isUnordered ) {
+                output << result.text << '\n';
+                linesInFlight.pop(token);
+                if ( progress != NULL ) {
+                    progress->addDone();
+                }
+            }
+            else {
+                earlyResults[result.sequenceNumber] = move(result.text);
+                map<unsigned long, string>::iterator nextResult;
+                while ( (nextResult = earlyResults.find(nextSequenceNumber))
+                        != earlyResults.end() ) {
+                    output << nextResult->second << '\n';
+                    earlyResults.erase(nextResult);
+                    nextSequenceNumber++;
+                    linesInFlight.pop(token);
+                    if ( progress != NULL ) {
+                        progress->addDone();
+                    }
+                }
+            }
+            // Flush only when nothing else is ready, so that results reach
+            //  the next program of the pipeline without delay
+            if ( resultLines.empty() ) {
+                output.flush();
+            }
+        }
+        output.flush();
+    });
+
+    string text;
+    unsigned long lineNumber = 0;
+    unsigned long sequenceNumber = 0;
+    while ( getline(input, text) ) {
+        lineNumber++;
+        if ( text.find_first_not_of(" \t\r") == string::npos ) {
+            continue;
+        }
+        linesInFlight.push(true);
+
+        StreamLine line;
+        line.sequenceNumber = sequenceNumber++;
+        line.lineNumber = lineNumber;
+        line.text = move(text);
+        inputLines.push(move(line));
+    }
+
+    inputLines.close();
+    for ( thread& worker : workers ) {
+        worker.join();
+    }
+    resultLines.close();
+    writer.join();
+}
+
+void
+StreamProcessor::loadDocument(const rapidjson::Value& configuration,
+                              const char* memberName,
+                              const string& documentType,
+                              rapidjson::Document& jsonDocument,
+                              string& fileName)
+{
+    if ( configuration.HasMember(memberName) == false ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not find member \"");
+        exceptionMsgThrown.append(memberName);
+        exceptionMsgThrown.append("\" in the configuration!\n");
+        throw exceptionMsgThrown;
+    }
+
+    const rapidjson::Value& document = configuration[memberName];
+    if ( document.IsString() ) {
+        fileName = document.GetString();
+        JSONDocumentCache::load(fileName, documentType, jsonDocument);
+    }
+    else if ( document.IsObject() ) {
+        fileName = "(inline " + documentType + ")";
+        jsonDocument.CopyFrom(document, jsonDocument.GetAllocator());
+    }
+    else {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Member \"");
+        exceptionMsgThrown.append(memberName);
+        exceptionMsgThrown.append("\" is expected to be a file name ");
+        exceptionMsgThrown.append("or a JSON object!\n");
+        throw exceptionMsgThrown;
+    }
+}
+
+string
+StreamProcessor::evaluateLine(const string& line, unsigned long lineNumber)
+{
+    // Parsing and loading the inputs count as reading, the model as computing
+    RunProgress::StageTimer readTimer(progress, RunProgress::STAGE_READ);
+    rapidjson::Document configuration;
+    configuration.Parse(line.c_str());
+
+    rapidjson::StringBuffer resultBuffer;
+    rapidjson::Writer<rapidjson::StringBuffer> resultWriter(resultBuffer);
+    resultWriter.StartObject();
+
+    // Configurations are identified by their "id", or by their line
+    resultWriter.Key("id");
+    if ( configuration.HasParseError() == false
+         && configuration.IsObject()
+         && configuration.HasMember("id") ) {
+        configuration["id"].Accept(resultWriter);
+    }
+    else {
+        resultWriter.Uint64(lineNumber);
+    }
+
+    Current * dram = NULL;
+    try {
+        if ( configuration.HasParseError() || !configuration.IsObject() ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Could not parse line ");
+            exceptionMsgThrown.append(to_string(lineNumber));
+            exceptionMsgThrown.append(" as a JSON object.\n");
+            throw exceptionMsgThrown;
+        }
+
+        TechnologyValues technologyValues;
+        rapidjson::Document techDocument;
+        rapidjson::Document archDocument;
+        loadDocument(configuration, "technology", "technology",
+                     techDocument, technologyValues.techFileName);
+        loadDocument(configuration, "architecture", "architecture",
+                     archDocument, technologyValues.archFileName);
+
+        // Overrides of the line are applied after the command-line ones
+        vector<string> parameterOverrides(arg.parameterOverrides);
+        if ( configuration.HasMember("overrides")
+             && configuration["overrides"].IsObject() ) {
+            const rapidjson::Value& overrides = configuration["overrides"];
+            for ( rapidjson::Value::ConstMemberIterator overrideMember
+                  = overrides.MemberBegin();
+                  overrideMember != overrides.MemberEnd();
+                  ++overrideMember ) {
+                rapidjson::StringBuffer valueBuffer;
+                rapidjson::Writer<rapidjson::StringBuffer>
+                        valueWriter(valueBuffer);
+                overrideMember->value.Accept(valueWriter);
+                parameterOverrides.push_back(
+                            string(overrideMember->name.GetString())
+                            + "=" + valueBuffer.GetString());
+            }
+        }
+        technologyValues.applyOverrides(techDocument, archDocument,
+                                        parameterOverrides);
+        technologyValues.extractValues(techDocument, archDocument);
+
+        string cacheKey;
+        if ( resultCache != NULL ) {
+            cacheKey = resultCache->computeKey(technologyValues,
+                                               arg.IOTerminationCurrentFlag);
+            dram = new Current();
+            lock_guard<mutex> lock(resultCacheMutex);
+            if ( resultCache->load(cacheKey, *dram) == false ) {
+                delete dram;
+                dram = NULL;
+            }
+        }
+        if ( dram == NULL ) {
+            readTimer.pause();
+            RunProgress::StageTimer computeTimer(progress,
+                                                 RunProgress::STAGE_COMPUTE);
+            dram = new Current(technologyValues, arg.IOTerminationCurrentFlag);
+            if ( resultCache != NULL ) {
+                lock_guard<mutex> lock(resultCacheMutex);
+                resultCache->store(cacheKey, *dram);
+            }
+        }
+    } catch(string exceptionMsgThrown) {
+        delete dram;
+        if ( progress != NULL ) {
+            progress->addError();
+        }
+        resultWriter.Key("Error");
+        resultWriter.String(exceptionMsgThrown.c_str());
+        resultWriter.EndObject();
+        return resultBuffer.GetString();
+    }
+
+    resultWriter.Key("Warning");
+    resultWriter.String(dram->warning.c_str());
+    resultWriter.Key("Results");
+    resultWriter.StartObject();
+    // JSON has no representation for non finite numbers
+#define WRITE_RESULT_FIELD(fieldName) \
+    resultWriter.Key(#fieldName); \
+    if ( std::isfinite(resultFieldValue(dram->fieldName)) ) { \
+        resultWriter.Double(resultFieldValue(dram->fieldName)); \
+    } \
+    else { \
+        resultWriter.Null(); \
+    }
+    DRAMSPEC_RESULT_FIELDS(WRITE_RESULT_FIELD)
+#undef WRITE_RESULT_FIELD
+    resultWriter.EndObject();
+    resultWriter.EndObject();
+
+    delete dram;
+    return resultBuffer.GetString();
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+// This class evaluates a stream of configurations, as a filter in a pipeline.
+// Each input line is a JSON object describing one configuration:
+//  {"id": ..., "technology": ..., "architecture": ..., "overrides": {...}}
+//  where technology and architecture are either file names or the documents
+//  themselves. Each output line is a JSON object with the results (NDJSON).
+// Lines are evaluated by a pool of workers. The number of lines in flight is
+//  bounded, so memory use does not grow with the length of the stream.
+#ifndef STREAMPROCESSOR_H
+#define STREAMPROCESSOR_H
+
+#include "ArgumentsParser.h"
+#include "ResultCache.h"
+#include "RunProgress.h"
+#include "../utils/BoundedQueue.h"
+
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rapidjson/include/rapidjson/document.h"
+#include "rapidjson/include/rapidjson/writer.h"
+#include "rapidjson/include/rapidjson/stringbuffer.h"
+
+using namespace std;
+
+class StreamProcessor
+{
+  public:
+    StreamProcessor(const ArgumentsParser& arguments,
+                    ResultCache * configurationResultCache);
+
+    // Reads configurations from input until its end and writes the results
+    //  to output, in the input order unless isUnordered is set
+    void run(istream& input, ostream& output);
+
+    // Result line (without the line break) of a single input line.
+    // Errors are reported in the result line, they do not stop the stream.
+    string evaluateLine(const string& line, unsigned long lineNumber);
+
+    const ArgumentsParser& arg;
+    ResultCache * resultCache;
+    unsigned int nThreads;
+    bool isUnordered;
+
+    // Maximum number of lines read but not written yet
+    unsigned int maxLinesInFlight;
+
+    // Counters of the lines evaluated, if the progress is reported
+    RunProgress * progress;
+
+  private:
+    // An input or a result line with its position in the stream
+    struct StreamLine {
+        unsigned long sequenceNumber;
+        unsigned long lineNumber;
+        string text;
+    };
+
+    void loadDocument(const rapidjson::Value& configuration,
+                      const char* memberName,
+                      const string& documentType,
+                      rapidjson::Document& jsonDocument,
+                      string& fileName);
+
+    mutex resultCacheMutex;
+};
+
+#endif // STREAMPROCESSOR_H
@@ -46,90 +46,58 @@ TechnologyValues::technologyValuesInitialize()
     techFileName = "";
     archFileName = "";
 
-    technologyNode = INVALID_VALUE*drs::nanometer;
-    vpp = INVALID_VALUE*si::volt;
-    vdd = INVALID_VALUE*si::volt;
-    wireResistance = INVALID_VALUE*drs::ohm_per_millimeter;
-    wireCapacitance = INVALID_VALUE*drs::femtofarad_per_millimeter;
-    capacitancePerCell = INVALID_VALUE*drs::femtofarads;
-    resistancePerCell = INVALID_VALUE*drs::kiloohm;
-    cellWidth = INVALID_VALUE*drs::micrometer;
-    cellHeight = INVALID_VALUE*drs::micrometer;
-    capacitancePerBLCell = INVALID_VALUE*drs::attofarads;
-    resistancePerBLCell = INVALID_VALUE*drs::ohm;
-    capacitancePerWLCell = INVALID_VALUE*drs::attofarads;
-    resistancePerWLCell = INVALID_VALUE*drs::ohm;
-    BLSenseAmpHeight = INVALID_VALUE*drs::micrometer;
-    LWLDriverWidth = INVALID_VALUE*drs::micrometer;
-    LWLDriverResistance = INVALID_VALUE*drs::ohm;
-    rowDecoderWidth = INVALID_VALUE*drs::micrometers;
-    GWLDriverResistance = INVALID_VALUE*si::ohm;
-    Issa = INVALID_VALUE*drs::microampere_per_bit;
-    WRDriverResistance = INVALID_VALUE*drs::ohm;
-    colDecoderHeight = INVALID_VALUE*drs::micrometers;
-    CSLDriverResistance = INVALID_VALUE*si::ohms;
-    CSLLoadCapacitance = INVALID_VALUE*drs::femtofarads;
-    GDLDriverResistance = INVALID_VALUE*si::ohms;
-    DQDriverHeight = INVALID_VALUE*drs::micrometers;
-    DQtoTSVWireLength = INVALID_VALUE*drs::micrometers;
-    DQDriverResistance = INVALID_VALUE*si::ohms;
-    idd2nFreqSlope = INVALID_VALUE*drs::milliamperes_per_megahertz_clock;
-    idd2nTempAlpha = INVALID_VALUE*drs::milliamperes;
-    idd2nTempBeta = INVALID_VALUE*drs::eergeds;
-    idd2nRefTemp = INVALID_VALUE*bu::celsius::degrees;
-    idd2nOffset = INVALID_VALUE*drs::milliamperes;
-    IddOcdRcvSlope = INVALID_VALUE*drs::microamperes_per_megahertz_clock;
-    fullySharedResourcesCurrent = INVALID_VALUE*drs::milliamperes;
-    semiSharedResourcesCurrent = INVALID_VALUE*drs::milliamperes;
-    nBanksPerSemiSharedResource = INVALID_VALUE;
-    TSVHeight = INVALID_VALUE*drs::micrometers;
-    additionalLatencyTrl = INVALID_VALUE*drs::clocks;
-    driverEnableDelay = INVALID_VALUE*drs::nanoseconds;
-    inOutSSADelay = INVALID_VALUE*drs::nanoseconds;
-    cmdDecoderDelay = INVALID_VALUE*drs::nanoseconds;
-    IODelay = INVALID_VALUE*drs::nanoseconds;
-    SSAPrechargeDelay = INVALID_VALUE*drs::nanoseconds;
-    tWRMargin = INVALID_VALUE*drs::nanoseconds;
-    equalizerDelay = INVALID_VALUE*drs::nanoseconds;
-    vppPumpsEfficiency = INVALID_VALUE;
-
-    dramType = "";
-    is3D = false;
-    isDLL = false;
-    hasExternalVpp = false;
-    channelSize = INVALID_VALUE*drs::gibibit;
-    nBanks = INVALID_VALUE;
-    nHorizontalBanks = INVALID_VALUE;
-    nVerticalBanks = INVALID_VALUE;
-    cellsPerLWL = INVALID_VALUE;
-    cellsPerLWLRedundancy = INVALID_VALUE;
-    cellsPerLBL = INVALID_VALUE;
-    cellsPerLBLRedundancy = INVALID_VALUE;
-    interface = INVALID_VALUE*drs::bit;
-    prefetch = INVALID_VALUE;
-    dramFreq = INVALID_VALUE*drs::megahertz_clock;
-    dramCoreFreq = INVALID_VALUE*drs::megahertz_clock;
-    nTilesPerBank = INVALID_VALUE;
-    pageStorage = INVALID_VALUE*drs::kibibyte;
-    pageSpanningFactor = INVALID_VALUE;
-    BLArchitecture = "";
-    subArrayToPageFactor = INVALID_VALUE;
-    retentionTime = INVALID_VALUE*drs::millisecond;
-    trefIBase = INVALID_VALUE*drs::microsecond;
-    refreshMode = INVALID_VALUE;
-    temperature = INVALID_VALUE*bu::celsius::degrees;
+#define INVALIDATE_PARAMETER(document, jsonKey, member, unit, attribute, \
+                             defaultValue) \
+    invalidateInputValue(member, unit);
+    DRAMSPEC_INPUT_PARAMETERS(INVALIDATE_PARAMETER)
+#undef INVALIDATE_PARAMETER
+
+    processCorners.clear();
 
     warning = "";
 }
 
+string
+TechnologyValues::canonicalValues() const
+{
+    // One "name=value" line per input value, in a fixed order and with
+    //  enough digits to represent every double exactly. File names and
+    //  warnings are left out, since they do not change the results.
+    // So are the values the model ignores: the technology node (not used
+    //  in any calculation), the SSA in-out delay (estimated from tCCD) and
+    //  the core frequency (always calculated from the frequency).
+    ostringstream canonicalStream;
+    canonicalStream << setprecision(17);
+#define CANONICAL_PARAMETER(document, jsonKey, member, unit, attribute, \
+                            defaultValue) \
+    if ( INPUT_ ## member != INPUT_technologyNode \
+         && INPUT_ ## member != INPUT_inOutSSADelay \
+         && INPUT_ ## member != INPUT_dramCoreFreq ) { \
+        canonicalStream << #member << "=" << inputValue(member) << "\n"; \
+    }
+    DRAMSPEC_INPUT_PARAMETERS(CANONICAL_PARAMETER)
+#undef CANONICAL_PARAMETER
+
+    // Only technologies with process corners have these lines
+    for ( const ProcessCorner& corner : processCorners ) {
+        canonicalStream << "processCorner=" << corner.name << ","
+                        << corner.resistanceFactor << ","
+                        << corner.capacitanceFactor << ","
+                        << corner.currentFactor << "\n";
+    }
+
+    return canonicalStream.str();
+}
+
 double
-TechnologyValues::getJSONNumber(const rapidjson::Document& jsonDoc,
+TechnologyValues::getJSONNumber(const rapidjson::Value* jsonValue,
                                 const char* memberName,
-                                const string& attributeType)
+                                InputAttribute attribute,
+                                double defaultValue)
 {
-  if ( jsonDoc.HasMember( memberName ) == false )
+  if ( jsonValue == NULL )
   {
-    if ( attributeType == "mandatory" ) {
+    if ( attribute == MANDATORY_INPUT ) {
       string exceptionMsgThrown;
       exceptionMsgThrown.append("[ERROR] ");
       exceptionMsgThrown.append("Could not find member \"");
@@ -141,23 +109,9 @@ TechnologyValues::getJSONNumber(const rapidjson::Document& jsonDoc,
       exceptionMsgThrown.append("!\n");
       throw exceptionMsgThrown;
     }
-    else if ( attributeType == "optional" ) {
-      return INVALID_VALUE;
-    }
-    else {
-      std::string exceptionMsgThrown("[ERROR] ");
-      exceptionMsgThrown.append("Unexpected behaviour - ");
-      exceptionMsgThrown.append("could not decide on attribute type. ");
-      exceptionMsgThrown.append("Attribute was \"");
-      exceptionMsgThrown.append(memberName);
-      exceptionMsgThrown.append("\". ");
-      exceptionMsgThrown.append("Attribute type was \"");
-      exceptionMsgThrown.append(attributeType);
-      exceptionMsgThrown.append("\".");
-      throw exceptionMsgThrown;
-    }
+    return defaultValue;
   }
-  if ( jsonDoc[ memberName ].IsNumber() == false )
+  if ( jsonValue->IsNumber() == false )
   {
     string exceptionMsgThrown;
     exceptionMsgThrown.append("[ERROR] ");
@@ -171,35 +125,17 @@ TechnologyValues::getJSONNumber(const rapidjson::Document& jsonDoc,
     throw exceptionMsgThrown;
   }
 
-  return jsonDoc[ memberName ].GetDouble();
-}
-
-double
-TechnologyValues::getJSONNumber(const rapidjson::Document& jsonDoc,
-                                const char* memberName,
-                                const string& attributeType,
-                                double defaultValue)
-{
-  double valueFromFile, returnValue;
-  valueFromFile = getJSONNumber(jsonDoc, memberName, attributeType);
-
-  if ( valueFromFile == INVALID_VALUE ) {
-    returnValue = defaultValue;
-  }
-  else {
-    returnValue = valueFromFile;
-  }
-  return returnValue;
+  return jsonValue->GetDouble();
 }
 
 string
-TechnologyValues::getJSONString(const rapidjson::Document& jsonDoc,
+TechnologyValues::getJSONString(const rapidjson::Value* jsonValue,
                                 const char* memberName,
-                                const string& attributeType)
+                                InputAttribute attribute)
 {
-  if ( jsonDoc.HasMember( memberName ) == false )
+  if ( jsonValue == NULL )
   {
-    if ( attributeType == "mandatory" ) {
+    if ( attribute == MANDATORY_INPUT ) {
       string exceptionMsgThrown;
       exceptionMsgThrown.append("[ERROR] ");
       exceptionMsgThrown.append("Could not find member \"");
@@ -211,23 +147,9 @@ TechnologyValues::getJSONString(const rapidjson::Document& jsonDoc,
       exceptionMsgThrown.append("!\n");
       throw exceptionMsgThrown;
     }
-    else if ( attributeType == "optional" ) {
-      return "";
-    }
-    else {
-      std::string exceptionMsgThrown("[ERROR] ");
-      exceptionMsgThrown.append("Unexpected behaviour - ");
-      exceptionMsgThrown.append("could not decide on attribute type. ");
-      exceptionMsgThrown.append("Attribute was \"");
-      exceptionMsgThrown.append(memberName);
-      exceptionMsgThrown.append("\". ");
-      exceptionMsgThrown.append("Attribute type was \"");
-      exceptionMsgThrown.append(attributeType);
-      exceptionMsgThrown.append("\".");
-      throw exceptionMsgThrown;
-    }
+    return "";
   }
-  if ( jsonDoc[ memberName ].IsString() == false )
+  if ( jsonValue->IsString() == false )
   {
     string exceptionMsgThrown;
     exceptionMsgThrown.append("[ERROR] ");
@@ -241,393 +163,209 @@ TechnologyValues::getJSONString(const rapidjson::Document& jsonDoc,
     throw exceptionMsgThrown;
   }
 
-  return jsonDoc[ memberName ].GetString();
+  return jsonValue->GetString();
 }
 
-void 
-TechnologyValues::readjson(const string& t,const string& p)
+void
+TechnologyValues::findJSONValues(const rapidjson::Document& jsonDocument,
+                                 InputDocument document,
+                                 const rapidjson::Value* jsonValues[])
 {
-    techFileName = t;
-    archFileName = p;
-
-    // Try to open technology file given by the user
-    ifstream techFile(techFileName);
-    // Test if file was (and still is) opened
-    if ( techFile.is_open() == false ) {
-        string exceptionMsgThrown;
-        exceptionMsgThrown.append("[ERROR] ");
-        exceptionMsgThrown.append("Could not open technology file: ");
-        exceptionMsgThrown.append(techFileName);
-        exceptionMsgThrown.append("!\n");
-        throw exceptionMsgThrown;
+    if ( jsonDocument.IsObject() == false ) {
+        return;
     }
 
-    // Find length of the file
-    int techFileLength;
-    techFile.seekg(0, ios::end);
-    techFileLength = techFile.tellg();
-    techFile.seekg(0, ios::beg);
+    for ( rapidjson::Value::ConstMemberIterator member
+          = jsonDocument.MemberBegin();
+          member != jsonDocument.MemberEnd();
+          ++member ) {
+        int parameterID = findInputParameter(member->name.GetString(),
+                                             member->name.GetStringLength());
+        // Other members are ignored, as are input values given in the
+        //  wrong document. A repeated member counts the first time.
+        if ( parameterID != -1
+             && inputParameters[parameterID].document == document
+             && jsonValues[parameterID] == NULL ) {
+            jsonValues[parameterID] = &member->value;
+        }
+    }
+}
 
-    // Create an internal copy as a C-style string
-    char* techFileText = new char[techFileLength + 1];
-    techFile.read(techFileText, techFileLength);
-    techFileText[ techFileLength ] = '\0';
+void
+TechnologyValues::extractValue(double& member,
+                               const rapidjson::Value* jsonValue,
+                               const char* memberName,
+                               InputAttribute attribute,
+                               double defaultValue,
+                               double unit)
+{
+    member = getJSONNumber(jsonValue, memberName, attribute, defaultValue)
+             * unit;
+}
 
-    // Close the file
-    techFile.close();
+void
+TechnologyValues::extractValue(string& member,
+                               const rapidjson::Value* jsonValue,
+                               const char* memberName,
+                               InputAttribute attribute,
+                               double,
+                               const char*)
+{
+    member = getJSONString(jsonValue, memberName, attribute);
+}
 
-    // Parse the file as a JSON Document
-    rapidjson::Document techDocument;
-    techDocument.Parse(techFileText);
-    if ( techDocument.HasParseError() ) {
-        string exceptionMsgThrown;
-        exceptionMsgThrown.append("[ERROR] ");
-        exceptionMsgThrown.append("Could not parse ");
-        exceptionMsgThrown.append(techFileName);
-        exceptionMsgThrown.append(" as a JSON document.\n");
-        throw exceptionMsgThrown;
-    }
+void
+TechnologyValues::extractValue(bool& member,
+                               const rapidjson::Value* jsonValue,
+                               const char* memberName,
+                               InputAttribute attribute,
+                               double,
+                               const char* trueValue)
+{
+    member = ( getJSONString(jsonValue, memberName, attribute) == trueValue );
+}
 
-    try {
-        //Technology node in nm
-        technologyNode = getJSONNumber(techDocument,
-                                       "TechnologyNode[nm]",
-                                       "mandatory")
-                         * drs::nanometer;
-
-        //voltage vpp
-        vpp = getJSONNumber(techDocument,
-                            "Vpp[V]",
-                            "mandatory")
-              * si::volt;
-        //voltage vdd
-        vdd = getJSONNumber(techDocument,
-                            "Vdd[V]",
-                            "mandatory")
-              * si::volt;
-
-        //wire resistance in ohm/mm
-        wireResistance = getJSONNumber(techDocument,
-                                       "WireResistance[Ohm/mm]",
-                                       "mandatory")
-                         * drs::ohm_per_millimeter;
-
-        //wire capa in ff/mm
-        wireCapacitance = getJSONNumber(techDocument,
-                                        "WireCapacitance[fF/mm]",
-                                        "mandatory")
-                          * drs::femtofarad_per_millimeter;
-
-        //cell capa
-        capacitancePerCell = getJSONNumber(techDocument,
-                                           "CellCapacitance[fF]",
-                                           "mandatory")
-                             * drs::femtofarads;
-
-        //cell resistance
-        resistancePerCell = getJSONNumber(techDocument,
-                                          "CellResistance[KOhm]",
-                                          "mandatory")
-                            * drs::kiloohm;
-
-        //cell width
-        cellWidth = getJSONNumber(techDocument,
-                                  "CellWidth[um]",
-                                  "mandatory")
-                    * drs::micrometers;
-
-        //cell height
-        cellHeight = getJSONNumber(techDocument,
-                                   "CellHeight[um]",
-                                   "mandatory")
-                     * drs::micrometers;
-
-        //Bitline per cell capa
-        capacitancePerBLCell = getJSONNumber(techDocument,
-                                             "BitlineCapacitancePerCell[aF]",
-                                             "mandatory")
-                               * drs::attofarads;
-
-        //Bitline per cell resistance
-        resistancePerBLCell = getJSONNumber(techDocument,
-                                            "BitlineResistancePerCell[Ohm]",
-                                            "mandatory")
-                              * drs::ohm;
-
-        //Wordline per cell capa
-        capacitancePerWLCell = getJSONNumber(techDocument,
-                                             "WordlineCapacitancePerCell[aF]",
-                                             "mandatory")
-                               * drs::attofarads;
-
-        //Wordline per cell resistance
-        resistancePerWLCell = getJSONNumber(techDocument,
-                                            "WordlineResistancePerCell[Ohm]",
-                                            "mandatory")
-                              * drs::ohm;
-
-        //Sense amp height
-        BLSenseAmpHeight = getJSONNumber(techDocument,
-                                         "PrimarySenseAmpHeight[um]",
-                                         "mandatory")
-                           * drs::micrometer;
-
-        //Local wordline driver width
-        LWLDriverWidth = getJSONNumber(techDocument,
-                                       "LocalWordlineDriverWitdh[um]",
-                                       "mandatory")
-                        * drs::micrometer;
-
-        //Local wordline driver resistance in ohm
-        LWLDriverResistance = getJSONNumber(techDocument,
-                                            "LocalWordlineDriverResistance[Ohm]",
-                                            "mandatory")
-                              * drs::ohm;
-
-        //Row decoder (between tiles) width
-        rowDecoderWidth = getJSONNumber(techDocument,
-                                        "RowDecoderWidth[um]",
-                                        "mandatory")
-                          * drs::micrometer;
-
-        //Global wordline driver resistance in ohm
-        GWLDriverResistance = getJSONNumber(techDocument,
-                                            "GlobalWordlineDriverResistance[Ohm]",
-                                            "mandatory")
-                              * si::ohm;
-
-        //current of SSA in milliamperes
-        Issa = getJSONNumber(techDocument,
-                             "SecondarySenseAmpCurrent[uA]",
-                             "mandatory")
-               * drs::microampere_per_bit;
-
-        // Write Restore Driver resistance
-        WRDriverResistance = getJSONNumber(techDocument,
-                                           "WriteDriverResistance[Ohm]",
-                                           "mandatory")
-                       * drs::ohm;
-
-        //Column decoder (between tiles) height
-        colDecoderHeight = getJSONNumber(techDocument,
-                                         "ColumnDecoderHeight[um]",
-                                         "mandatory")
-                           * drs::micrometer;
-
-        //CSL driver resistance in ohm
-        CSLDriverResistance = getJSONNumber(techDocument,
-                                            "CSLDriverResistance[Ohm]",
-                                            "mandatory")
-                              * si::ohm;
-
-        //CSL load capacitance
-        CSLLoadCapacitance = getJSONNumber(techDocument,
-                                           "CSLLoadCapacitance[fF]",
-                                           "mandatory")
-                         * drs::femtofarads;
-
-        //GDL driver resistance in ohm
-        GDLDriverResistance = getJSONNumber(techDocument,
-                                            "GlobalDataLineDriverResistance[Ohm]",
-                                            "mandatory")
-                              * si::ohm;
-
-        //DQ driver (between banks) height
-        DQDriverHeight = getJSONNumber(techDocument,
-                                       "DQDriverHeight[um]",
-                                       "mandatory")
-                         * drs::micrometer;
-
-        //Length of the wire going from the DQ main wiring to the TSV
-        DQtoTSVWireLength = getJSONNumber(techDocument,
-                                          "DQtoTSVWireLength[um]",
-                                          "mandatory")
-                             * drs::micrometers;
-
-        //DQ driver resistance in ohm
-        DQDriverResistance = getJSONNumber(techDocument,
-                                           "DQDriverResistance[Ohm]",
-                                           "mandatory")
-                             * si::ohm;
-
-        //Background current slope with frequency
-        idd2nFreqSlope = getJSONNumber(techDocument,
-                                       "IDD2NFreqSlope[mA/MHz]",
-                                       "mandatory")
-                                 * drs::milliamperes_per_megahertz_clock;
-
-        //Background current alpha coefficient (models temperature dependency)
-        idd2nTempAlpha = getJSONNumber(techDocument,
-                                       "IDD2NTempAlpha[mA]",
-                                       "mandatory")
-                                 * drs::milliamperes;
-
-        //Background current beta coefficient (models temperature dependency)
-        idd2nTempBeta = getJSONNumber(techDocument,
-                                      "IDD2NTempBeta[C^-1]",
-                                      "mandatory")
-                                 * drs::eergeds;
-
-        //Background current reference temperature (models temperature dependency)
-        idd2nRefTemp = getJSONNumber(techDocument,
-                                     "IDD2NRefTemp[C]",
-                                     "mandatory")
-                                 * bu::celsius::degrees;
-
-        //Background current offset (current at ref temp and 0 MHz)
-        idd2nOffset = getJSONNumber(techDocument,
-                                    "IDD2NOffset[mA]",
-                                    "mandatory")
-                                  * drs::milliamperes;
-
-        //Current slope per IO pin (Off Channel Driver)
-        IddOcdRcvSlope = getJSONNumber(techDocument,
-                                       "OCDCurrentSlope[uA/MHz]",
-                                       "mandatory")
-                                    * drs::microamperes_per_megahertz_clock;
-
-        //Current of the resources shared by all banks
-        fullySharedResourcesCurrent = getJSONNumber(techDocument,
-                                              "FullySharedResourcesCurrent[mA]",
-                                                    "mandatory")
-                                      * drs::milliamperes;
-
-        //Current of the resources shared by blocks of banks
-        semiSharedResourcesCurrent = getJSONNumber(techDocument,
-                                              "SemiSharedResourcesCurrent[mA]",
-                                                   "mandatory")
-                                     * drs::milliamperes;
-
-        //Size of the block of banks that share the same "semi shared" resources
-        nBanksPerSemiSharedResource = getJSONNumber(techDocument,
-                                                "nBanksPerSemiSharedResource[]",
-                                                    "mandatory");
-
-
-        //Height of the TSV area needed for each bank I/O
-        TSVHeight = getJSONNumber(techDocument,
-                                  "TSVHeight[um]",
-                                  "mandatory")
-                    * drs::micrometer;
-
-        //Additional latency required for trl calculation
-        additionalLatencyTrl = getJSONNumber(techDocument,
-                                             "AdditionalTRLLatency[cc]",
-                                             "mandatory")
-                         * drs::clock;
-
-        //Driver enabling delay
-        driverEnableDelay = getJSONNumber(techDocument,
-                                          "DriverEnableDelay[ns]",
-                                          "mandatory")
-                         * drs::nanoseconds;
-
-        //Signal delay from input to output of SSA
-        inOutSSADelay = getJSONNumber(techDocument,
-                                      "InOutSSADelay[ns]",
-                                      "mandatory")
-                         * drs::nanoseconds;
-
-        //Command decoder delay - clock wave pipeline delay
-        cmdDecoderDelay = getJSONNumber(techDocument,
-                                        "CommandDecoderDelay[ns]",
-                                        "mandatory")
-                         * drs::nanoseconds;
-
-        //I/O interface delay
-        IODelay = getJSONNumber(techDocument,
-                                "IODelay[ns]",
-                                "mandatory")
-                         * drs::nanoseconds;
-
-        //Delay for SSA precharging
-        SSAPrechargeDelay = getJSONNumber(techDocument,
-                                          "SSAPrechargeDelay[ns]",
-                                          "mandatory")
-                         * drs::nanoseconds;
-
-        // Security margin for Write Recovery
-        tWRMargin = getJSONNumber(techDocument,
-                                  "tWRMargin[ns]",
-                                  "mandatory")
-                         * drs::nanoseconds;
-
-        //Equalizer circuit enabling delay
-        equalizerDelay = getJSONNumber(techDocument,
-                                       "EqualizerDelay[ns]",
-                                       "mandatory")
-                         * drs::nanoseconds;
-
-        //Vdd -> Vpp pump circuitry efficiency
-        vppPumpsEfficiency = getJSONNumber(techDocument,
-                                           "VppPumpEfficiency[-]",
-                                           "optional",
-                                           0.3);
+void
+TechnologyValues::readjson(const string& t,const string& p)
+{
+    readjson(t, p, vector<string>());
+}
 
-    } catch(string exceptionMsgThrown) {
-        throw exceptionMsgThrown;
-    }
+void
+TechnologyValues::readjson(const string& t,
+                           const string& p,
+                           const vector<string>& parameterOverrides)
+{
+    rapidjson::Document techDocument;
+    rapidjson::Document archDocument;
+    loadJSONDocuments(t, p, parameterOverrides, techDocument, archDocument);
 
+    extractValues(techDocument, archDocument);
+}
 
+void
+TechnologyValues::loadJSONDocuments(const string& t,
+                                    const string& p,
+                                    const vector<string>& parameterOverrides,
+                                    rapidjson::Document& techDocument,
+                                    rapidjson::Document& archDocument)
+{
+    techFileName = t;
+    archFileName = p;
 
+    JSONDocumentCache::load(techFileName, "technology", techDocument);
 
-    // Try to open architecture file given by the user
-    ifstream archFile(archFileName);
-    // Test if file was (and still is) opened
-    if ( archFile.is_open() == false ) {
-        string exceptionMsgThrown;
-        exceptionMsgThrown.append("[ERROR] ");
-        exceptionMsgThrown.append("Could not open architecture file: ");
-        exceptionMsgThrown.append(archFileName);
-        exceptionMsgThrown.append("!\n");
-        throw exceptionMsgThrown;
-    }
+    JSONDocumentCache::load(archFileName, "architecture", archDocument);
 
-    // Find length of the file
-    int archFileLength;
-    archFile.seekg(0, ios::end);
-    archFileLength = archFile.tellg();
-    archFile.seekg(0, ios::beg);
+    applyOverrides(techDocument, archDocument, parameterOverrides);
+}
 
-    // Create an internal copy as a C-style string
-    char* archFileText = new char[archFileLength + 1];
-    archFile.read(archFileText, archFileLength);
-    archFileText[ archFileLength ] = '\0';
+void
+TechnologyValues::applyOverrides(rapidjson::Document& techDocument,
+                                 rapidjson::Document& archDocument,
+                                 const vector<string>& parameterOverrides)
+{
+    for ( const string& parameterOverride : parameterOverrides ) {
+        size_t separatorPos = parameterOverride.find('=');
+        if ( separatorPos == string::npos || separatorPos == 0 ) {
+            string exceptionMsgThrown;
+            exceptionMsgThrown.append("[ERROR] ");
+            exceptionMsgThrown.append("Parameter override \"");
+            exceptionMsgThrown.append(parameterOverride);
+            exceptionMsgThrown.append("\" is not in the form \"Key=value\"!\n");
+            throw exceptionMsgThrown;
+        }
+        string memberName = parameterOverride.substr(0, separatorPos);
+        string memberValue = parameterOverride.substr(separatorPos + 1);
+
+        // The value is read as JSON (numbers, sweeps, ...), and falls back
+        //  to a plain string otherwise (e.g., DRAMType[-]=DDR4)
+        rapidjson::Document overrideDocument;
+        overrideDocument.Parse(memberValue.c_str());
+        // A plain list of values is swept, as {"list": [...]}
+        if ( !overrideDocument.HasParseError()
+             && overrideDocument.IsArray() ) {
+            rapidjson::Value list;
+            list.Swap(overrideDocument);
+            overrideDocument.SetObject();
+            overrideDocument.AddMember("list", list,
+                                       overrideDocument.GetAllocator());
+        }
 
-    // Close the file
-    archFile.close();
+        // Each value is set in the document it belongs to
+        int parameterID = findInputParameter(memberName.c_str(),
+                                             memberName.size());
+        if ( parameterID == -1 ) {
+            string exceptionMsgThrown;
+            exceptionMsgThrown.append("[ERROR] ");
+            exceptionMsgThrown.append("Parameter override \"");
+            exceptionMsgThrown.append(parameterOverride);
+            exceptionMsgThrown.append("\" does not match any input value!\n");
+            throw exceptionMsgThrown;
+        }
+        if ( inputParameters[parameterID].document == TECHNOLOGY_INPUT ) {
+            setJSONMember(techDocument, memberName, memberValue,
+                          overrideDocument);
+        }
+        else {
+            setJSONMember(archDocument, memberName, memberValue,
+                          overrideDocument);
+        }
+    }
+}
 
-    // Parse the file as a JSON Document
-    rapidjson::Document archDocument;
-    archDocument.Parse(archFileText);
-    if ( archDocument.HasParseError() ) {
-        string exceptionMsgThrown;
-        exceptionMsgThrown.append("[ERROR] ");
-        exceptionMsgThrown.append("Could not parse ");
-        exceptionMsgThrown.append(archFileName);
-        exceptionMsgThrown.append(" as a JSON document.\n");
-        throw exceptionMsgThrown;
+void
+TechnologyValues::setJSONMember(rapidjson::Document& jsonDocument,
+                                const string& memberName,
+                                const string& memberValue,
+                                const rapidjson::Document& overrideDocument)
+{
+    rapidjson::Document::AllocatorType& allocator
+            = jsonDocument.GetAllocator();
+
+    rapidjson::Value value;
+    if ( overrideDocument.HasParseError() ) {
+        value.SetString(memberValue.c_str(),
+                        static_cast<rapidjson::SizeType>(memberValue.size()),
+                        allocator);
+    }
+    else {
+        value.CopyFrom(overrideDocument, allocator);
     }
 
-    try {
-        //DRAM Type
-        dramType = getJSONString(archDocument,
-                                 "DRAMType[-]",
-                                 "mandatory");
+    if ( jsonDocument.HasMember(memberName.c_str()) ) {
+        jsonDocument[memberName.c_str()] = value;
+    }
+    else {
+        rapidjson::Value name(memberName.c_str(),
+                              static_cast<rapidjson::SizeType>(memberName.size()),
+                              allocator);
+        jsonDocument.AddMember(name, value, allocator);
+    }
+}
 
-        //3D ON/OFF Feature
-        //set 3D on for HMC/WideIO/HBM
-        is3D = ( getJSONString(archDocument, "3D[-]", "mandatory") == "ON" );
+void
+TechnologyValues::extractValues(const rapidjson::Document& techDocument,
+                                const rapidjson::Document& archDocument)
+{
+    // Value of every input parameter in the files, NULL if not found
+    const rapidjson::Value* jsonValues[nInputParameters] = {};
+    findJSONValues(techDocument, TECHNOLOGY_INPUT, jsonValues);
+    findJSONValues(archDocument, ARCHITECTURE_INPUT, jsonValues);
 
-        // DLL ON/OFF Feature
-        isDLL = ( getJSONString(archDocument, "DLL[-]", "mandatory") == "ON" );
+    try {
+#define EXTRACT_PARAMETER(document, jsonKey, member, unit, attribute, \
+                          defaultValue) \
+        extractValue(member, jsonValues[INPUT_ ## member], \
+                     jsonKey, attribute, defaultValue, unit);
+        DRAMSPEC_INPUT_PARAMETERS(EXTRACT_PARAMETER)
+#undef EXTRACT_PARAMETER
 
         // External Vpp source
-        string hasExternalVppStr = getJSONString(archDocument,
-                                      "ExternalVPP[-]", "optional");
-        if ( hasExternalVppStr == "YES" ) {
-          hasExternalVpp = true;
-        }
+        string hasExternalVppStr
+                = getJSONString(jsonValues[INPUT_hasExternalVpp],
+                                inputParameters[INPUT_hasExternalVpp].jsonKey,
+                                OPTIONAL_INPUT);
         if ( dramType.find("DDR4")    != string::npos ||
              dramType.find("HBM")     != string::npos ||
              dramType.find("WideIO")  != string::npos
@@ -643,121 +381,97 @@ TechnologyValues::readjson(const string& t,const string& p)
           }
         }
 
-        //size of DRAM Channel
-        channelSize = getJSONNumber(archDocument,
-                                    "ChannelSize[Gb]",
-                                    "mandatory")
-                      * drs::gibibits;
-
-        //# of banks
-        nBanks = getJSONNumber(archDocument,
-                               "NumberOfBanksPerChannel[]",
-                               "mandatory");
-
-        //# of banks in the row direction
-        nHorizontalBanks = getJSONNumber(archDocument,
-                                         "NumberOfHorizontalBanksPerChannel[]",
-                                         "optional");
-
-        //# of banks in the column direction
-        nVerticalBanks = getJSONNumber(archDocument,
-                                       "NumberOfVerticalBanksPerChannel[]",
-                                       "optional");
-
-        //cells per subarray row
-        cellsPerLWL = getJSONNumber(archDocument,
-                                    "CellsPerSubarrayRow[]",
-                                    "mandatory");
-
-        //cells per subarray row redundancy
-        cellsPerLWLRedundancy = getJSONNumber(archDocument,
-                                              "RedundantCellsPerSubarrayRow[]",
-                                              "mandatory");
-
-        //cells per subarray column
-        cellsPerLBL = getJSONNumber(archDocument,
-                                    "CellsPerSubarrayColumn[]",
-                                    "mandatory");
-
-        //cells per subarray column redundancy
-        cellsPerLBLRedundancy = getJSONNumber(archDocument,
-                                              "RedundantCellsPerSubarrayColumn[]",
-                                              "mandatory");
-
-        //Interface (channel-wise)
-        interface = getJSONNumber(archDocument,
-                                  "Interface[bit]",
-                                  "mandatory")
-                    * drs::bits;
-
-        //Number of prefetched words (interface wide) per CAS
-        prefetch = getJSONNumber(archDocument,
-                                 "Prefetch[]",
-                                 "mandatory");
-
-        //DRAM Frequency
-        dramFreq = getJSONNumber(archDocument,
-                                 "Frequency[MHz]",
-                                 "mandatory")
-                         * drs::megahertz_clock;
-
-        //DRAM Core Frequency
-        dramCoreFreq = getJSONNumber(archDocument,
-                                     "CoreFrequency[MHz]",
-                                     "mandatory")
-                         * drs::megahertz_clock;
-
-        // Number of tiles per bank
-        nTilesPerBank = getJSONNumber(archDocument,
-                                      "TilesPerBank[]",
-                                      "mandatory");
-
-        // Page size - number of local sense amp. activated in a row access
-        pageStorage = getJSONNumber(archDocument,
-                                    "PageSize[KB]",
-                                    "mandatory")
-                         * drs::kibibyte;
-
-        // Spanning factor of pages across tiles
-        pageSpanningFactor = getJSONNumber(archDocument,
-                                           "PageSpanningFactor[]",
-                                           "mandatory");
-
-        // Subarray to page factor (inverse percentage bitlines that are sensed per row access)
-        subArrayToPageFactor = getJSONNumber(archDocument,
-                                             "SubarrayToPageFactor[]",
-                                             "mandatory");
-
-        // DRAM Bitline Architecture: OPEN or FOLDED bitline
-        BLArchitecture = getJSONString(archDocument,
-                                       "BitlineArchitecture[-]",
-                                       "mandatory");
-
-        // Retention time
-        retentionTime = getJSONNumber(archDocument,
-                                      "RetentionTime[ms]",
-                                      "mandatory")
-                         * drs::millisecond;
-
-        // Normal mode and temp. average interval between AR commands
-        trefIBase = getJSONNumber(archDocument,
-                                  "tREFI(base)[us]",
-                                  "mandatory")
-                         * drs::microsecond;
-
-        // Refresh mode according to JEDEC (eg., JESD79-4B)
-        refreshMode = getJSONNumber(archDocument,
-                                    "RefreshMode[]",
-                                    "mandatory");
-
-        // Temperature used for timings and currents calculations
-        temperature = getJSONNumber(archDocument,
-                                    "Temperature[C]",
-                                    "mandatory")
-                         * bu::celsius::degrees;
+        extractProcessCorners(techDocument);
 
     } catch(string exceptionMsgThrown) {
         throw exceptionMsgThrown;
     }
 
 }
+
+void
+TechnologyValues::extractProcessCorners(
+        const rapidjson::Document& techDocument)
+{
+    processCorners.clear();
+    if ( techDocument.IsObject() == false
+         || techDocument.HasMember("ProcessCorners") == false ) {
+        return;
+    }
+
+    const rapidjson::Value& cornersValue = techDocument["ProcessCorners"];
+    if ( cornersValue.IsObject() == false ) {
+        string exceptionMsgThrown;
+        exceptionMsgThrown.append("[ERROR] ");
+        exceptionMsgThrown.append("Member \"ProcessCorners\" in JSON document ");
+        exceptionMsgThrown.append(techFileName);
+        exceptionMsgThrown.append(" is expected to be an object of corners!\n");
+        throw exceptionMsgThrown;
+    }
+
+    // A multiplier that is not given is 1
+    const char* factorNames[3] = {
+        "Resistance[-]", "Capacitance[-]", "Current[-]"
+    };
+    for ( rapidjson::Value::ConstMemberIterator corner
+          = cornersValue.MemberBegin();
+          corner != cornersValue.MemberEnd();
+          ++corner ) {
+        ProcessCorner processCorner;
+        processCorner.name = corner->name.GetString();
+        // A misspelled multiplier would otherwise be taken as 1
+        if ( corner->value.IsObject() ) {
+            for ( rapidjson::Value::ConstMemberIterator member
+                  = corner->value.MemberBegin();
+                  member != corner->value.MemberEnd();
+                  ++member ) {
+                string memberName = member->name.GetString();
+                if ( memberName != factorNames[0]
+                     && memberName != factorNames[1]
+                     && memberName != factorNames[2] ) {
+                    string exceptionMsgThrown;
+                    exceptionMsgThrown.append("[ERROR] ");
+                    exceptionMsgThrown.append("Process corner \"");
+                    exceptionMsgThrown.append(processCorner.name);
+                    exceptionMsgThrown.append("\" in JSON document ");
+                    exceptionMsgThrown.append(techFileName);
+                    exceptionMsgThrown.append(" has unknown member \"");
+                    exceptionMsgThrown.append(memberName);
+                    exceptionMsgThrown.append("\"!\n");
+                    throw exceptionMsgThrown;
+                }
+            }
+        }
+        double* factors[3] = {
+            &processCorner.resistanceFactor,
+            &processCorner.capacitanceFactor,
+            &processCorner.currentFactor
+        };
+        for ( int factorID = 0; factorID < 3; factorID++ ) {
+            *factors[factorID] = 1.0;
+            if ( corner->value.IsObject()
+                 && corner->value.HasMember(factorNames[factorID]) == false ) {
+                continue;
+            }
+            const rapidjson::Value* factorValue
+                    = ( corner->value.IsObject()
+                        ? &corner->value[factorNames[factorID]] : NULL );
+            if ( factorValue == NULL || factorValue->IsNumber() == false
+                 || !(factorValue->GetDouble() > 0) ) {
+                string exceptionMsgThrown;
+                exceptionMsgThrown.append("[ERROR] ");
+                exceptionMsgThrown.append("Process corner \"");
+                exceptionMsgThrown.append(processCorner.name);
+                exceptionMsgThrown.append("\" in JSON document ");
+                exceptionMsgThrown.append(techFileName);
+                exceptionMsgThrown.append(" is expected to hold positive ");
+                exceptionMsgThrown.append("multipliers \"Resistance[-]\", ");
+                exceptionMsgThrown.append("\"Capacitance[-]\" and ");
+                exceptionMsgThrown.append("\"Current[-]\"!\n");
+                throw exceptionMsgThrown;
+            }
+            *factors[factorID] = factorValue->GetDouble();
+        }
+        processCorners.push_back(processCorner);
+    }
+}
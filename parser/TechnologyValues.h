@@ -51,6 +51,8 @@
 #include <string>
 
 #include "rapidjson/include/rapidjson/document.h"
+#include "JSONDocumentCache.h"
+#include "InputParameters.h"
 
 #include "../utils/utils.h"
 
@@ -64,6 +66,15 @@ namespace drs=boost::units::dramspec;
 
 using namespace std;
 
+// Process corner of a technology (e.g. SS, TT, FF): multipliers of its
+//  resistances, capacitances and currents
+struct ProcessCorner {
+    string name;
+    double resistanceFactor;
+    double capacitanceFactor;
+    double currentFactor;
+};
+
 class TechnologyValues
 {
   public:
@@ -85,6 +96,20 @@ class TechnologyValues
 
     }
 
+    TechnologyValues(const string& technologyFileName,
+                     const string& architectureFileName,
+                     const vector<string>& parameterOverrides)
+    {
+        technologyValuesInitialize();
+        try {
+            readjson(technologyFileName, architectureFileName,
+                     parameterOverrides);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+
+    }
+
     // Technologyfile name to be read
     string techFileName;
 
@@ -229,6 +254,28 @@ class TechnologyValues
     //Vdd -> Vpp pump circuitry efficiency
     double vppPumpsEfficiency;
 
+    //Threshold voltage of the drivers supplied by Vdd
+    bu::quantity<si::electric_potential> driverThresholdVoltage;
+
+    //Threshold voltage of the wordline drivers and cell transistors (Vpp)
+    bu::quantity<si::electric_potential> wordlineThresholdVoltage;
+
+    //Exponent of the alpha-power law of the driver and cell resistances
+    double alphaPowerExponent;
+
+    //Voltages the driver and cell resistances are given at (0 for Vdd/Vpp)
+    bu::quantity<si::electric_potential> referenceVdd;
+    bu::quantity<si::electric_potential> referenceVpp;
+
+    //Linear temperature coefficients of the wire, cell and driver
+    // resistances (R = R_ref (1 + coefficient (T - TRef)))
+    bu::quantity<drs::per_temperature_unit> wireResistanceTempCoefficient;
+    bu::quantity<drs::per_temperature_unit> cellResistanceTempCoefficient;
+    bu::quantity<drs::per_temperature_unit> driverResistanceTempCoefficient;
+
+    //Temperature the resistances are given at
+    bu::quantity<bu::celsius::temperature> resistanceRefTemp;
+
 
 
     //DRAM Type
@@ -307,6 +354,10 @@ class TechnologyValues
     // Temperature used for timings and currents calculations
     bu::quantity<bu::celsius::temperature> temperature;
 
+    // Process corners of the technology file (member "ProcessCorners"),
+    //  in the order of the file, empty if it defines none
+    vector<ProcessCorner> processCorners;
+
 
 
     // String to output warnings
@@ -315,19 +366,128 @@ class TechnologyValues
 
     void technologyValuesInitialize();
 
-    double getJSONNumber(const rapidjson::Document& jsonDoc,
-                         const char* memberName,
-                         const string& attributeType);
-    double getJSONNumber(const rapidjson::Document& jsonDoc,
+    // Value of a member (NULL if the files do not have it)
+    double getJSONNumber(const rapidjson::Value* jsonValue,
                          const char* memberName,
-                         const string& attributeType,
-                         double deafultValue);
+                         InputAttribute attribute,
+                         double defaultValue);
 
-    string getJSONString(const rapidjson::Document& jsonDoc,
+    string getJSONString(const rapidjson::Value* jsonValue,
                          const char* memberName,
-                         const string& attributeType);
+                         InputAttribute attribute);
+
+    // Finds the value of every input parameter in one pass over the members
+    //  of a document. Values of other documents are left untouched.
+    void findJSONValues(const rapidjson::Document& jsonDocument,
+                        InputDocument document,
+                        const rapidjson::Value* jsonValues[]);
+
+    // Sets a member from its value in the files, whatever its type
+    template<class Unit, class ValueUnit>
+    void extractValue(bu::quantity<Unit>& member,
+                      const rapidjson::Value* jsonValue,
+                      const char* memberName,
+                      InputAttribute attribute,
+                      double defaultValue,
+                      const ValueUnit& unit)
+    {
+        member = getJSONNumber(jsonValue, memberName, attribute, defaultValue)
+                 * unit;
+    }
+    void extractValue(double& member,
+                      const rapidjson::Value* jsonValue,
+                      const char* memberName,
+                      InputAttribute attribute,
+                      double defaultValue,
+                      double unit);
+    void extractValue(string& member,
+                      const rapidjson::Value* jsonValue,
+                      const char* memberName,
+                      InputAttribute attribute,
+                      double defaultValue,
+                      const char* unit);
+    void extractValue(bool& member,
+                      const rapidjson::Value* jsonValue,
+                      const char* memberName,
+                      InputAttribute attribute,
+                      double defaultValue,
+                      const char* trueValue);
 
     void readjson(const string& t,const string& p);
+    // Same as above, with "Key=value" overrides applied on top of the files
+    void readjson(const string& t,
+                  const string& p,
+                  const vector<string>& parameterOverrides);
+
+    // Reads both files and applies the overrides, without extracting values
+    void loadJSONDocuments(const string& t,
+                           const string& p,
+                           const vector<string>& parameterOverrides,
+                           rapidjson::Document& techDocument,
+                           rapidjson::Document& archDocument);
+
+    void applyOverrides(rapidjson::Document& techDocument,
+                        rapidjson::Document& archDocument,
+                        const vector<string>& parameterOverrides);
+
+    void setJSONMember(rapidjson::Document& jsonDocument,
+                       const string& memberName,
+                       const string& memberValue,
+                       const rapidjson::Document& overrideDocument);
+
+    // Reads the input values from already parsed documents
+    void extractValues(const rapidjson::Document& techDocument,
+                       const rapidjson::Document& archDocument);
+
+    // Reads the process corners of a technology document
+    void extractProcessCorners(const rapidjson::Document& techDocument);
+
+    // Input values in a canonical text form (used for hashing)
+    string canonicalValues() const;
 
 };
+
+// Raw value of an input member (in the unit it is stored with)
+template<class Unit>
+double inputValue(const bu::quantity<Unit>& member)
+{
+    return member.value();
+}
+
+inline double inputValue(double member)
+{
+    return member;
+}
+
+inline bool inputValue(bool member)
+{
+    return member;
+}
+
+inline const string& inputValue(const string& member)
+{
+    return member;
+}
+
+// Sets an input member to its value before the files are read
+template<class Unit, class ValueUnit>
+void invalidateInputValue(bu::quantity<Unit>& member, const ValueUnit& unit)
+{
+    member = INVALID_VALUE*unit;
+}
+
+inline void invalidateInputValue(double& member, double)
+{
+    member = INVALID_VALUE;
+}
+
+inline void invalidateInputValue(string& member, const char*)
+{
+    member = "";
+}
+
+inline void invalidateInputValue(bool& member, const char*)
+{
+    member = false;
+}
 #endif //TECHNOLOGYVALUES_H
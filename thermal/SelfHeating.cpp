@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+#include "SelfHeating.h"
+#include "../utils/NumberFormat.h"
+
+#include <cmath>
+#include <fstream>
+
+namespace {
+
+// Top of the normal temperature range (included in it) and end of the
+//  operating range in C
+const double normalRangeTop = 85;
+const double operatingRangeEnd = 95;
+
+void appendReportLine(string& report, const string& label, double value,
+                      const string& profileName)
+{
+    report.append(label);
+    if ( label.size() < 30 ) {
+        report.append(30 - label.size(), ' ');
+    }
+    appendNumber(report, value);
+    if ( !profileName.empty() ) {
+        report.append(" (");
+        report.append(profileName);
+        report.push_back(')');
+    }
+    report.push_back('\n');
+}
+
+}
+
+const double SelfHeating::temperatureTolerance = 1e-6;
+
+SelfHeating::SelfHeating(const WorkloadProfiles& profiles,
+                         const Current& dram,
+                         double thermalResistance,
+                         double ambientTemperature) :
+    thermalResistance(thermalResistance),
+    ambientTemperature(ambientTemperature),
+    thermalDram(dram)
+{
+    if ( !(ambientTemperature > 0
+           && ambientTemperature < operatingRangeEnd) ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Ambient temperature outside the ");
+        exceptionMsgThrown.append("operating range from 0 to 95 ");
+        exceptionMsgThrown.append("degrees Celsius!\n");
+        throw exceptionMsgThrown;
+    }
+
+    size_t nProfiles = profiles.names.size();
+    temperatures.resize(nProfiles);
+    powers.resize(nProfiles);
+    nEvaluations.resize(nProfiles);
+    isRunaway.resize(nProfiles);
+    for ( size_t profileID = 0; profileID < nProfiles; profileID++ ) {
+        // Heating left, ambient + Rth P(T) - T (mW times C/W is mC),
+        //  positive below the solution
+        double lower = ambientTemperature;
+        double power = powerAt(profiles, profileID, lower);
+        double heatingLower = thermalResistance * power / 1000.0;
+        unsigned int nPowerEvaluations = 1;
+        // Point before lower, for the secant steps
+        bool hasPrevious = false;
+        double previous = 0;
+        double heatingPrevious = 0;
+        // Point above the solution, once it is bracketed
+        bool isBracketed = false;
+        double upper = 0;
+        double heatingUpper = 0;
+        // End of the bracket moved by the last step, 1 for lower and -1
+        //  for upper, to halve the other one when it stays (Illinois)
+        int movedEnd = 0;
+
+        double temperature = lower;
+        bool isSolved = ( std::fabs(heatingLower) < temperatureTolerance );
+        isRunaway[profileID] = false;
+        while ( !isSolved && nPowerEvaluations < maxIterations ) {
+            double next;
+            if ( !isBracketed ) {
+                // The plain iteration never goes beyond the solution
+                next = lower + heatingLower;
+                if ( next >= operatingRangeEnd ) {
+                    isRunaway[profileID] = true;
+                    break;
+                }
+                if ( hasPrevious && heatingPrevious > heatingLower ) {
+                    double secant = lower - heatingLower * (lower - previous)
+                                            / (heatingLower - heatingPrevious);
+                    next = ( secant > next && secant < operatingRangeEnd
+                             ? secant : next );
+                }
+            }
+            // The power jumps up at 85 C, where the refresh rate doubles,
+            //  so a bracket around it is split there first
+            else if ( lower < normalRangeTop && upper > normalRangeTop ) {
+                next = normalRangeTop;
+            }
+            else {
+                next = ( lower * heatingUpper - upper * heatingLower )
+                       / ( heatingUpper - heatingLower );
+            }
+
+            power = powerAt(profiles, profileID, next);
+            double heatingNext = ambientTemperature
+                                 + thermalResistance * power / 1000.0 - next;
+            nPowerEvaluations++;
+            temperature = next;
+            if ( std::fabs(heatingNext) < temperatureTolerance
+                 || ( isBracketed && upper - lower < temperatureTolerance ) ) {
+                isSolved = true;
+            }
+            else if ( heatingNext > 0 ) {
+                if ( !isBracketed ) {
+                    hasPrevious = true;
+                    previous = lower;
+                    heatingPrevious = heatingLower;
+                }
+                else if ( movedEnd == 1 ) {
+                    heatingUpper /= 2;
+                }
+                lower = next;
+                heatingLower = heatingNext;
+                movedEnd = 1;
+            }
+            else {
+                if ( isBracketed && movedEnd == -1 ) {
+                    heatingLower /= 2;
+                }
+                upper = next;
+                heatingUpper = heatingNext;
+                isBracketed = true;
+                movedEnd = -1;
+            }
+        }
+        // A runaway is reported at the end of the operating range, with
+        //  the power at the highest temperature evaluated below it
+        temperatures[profileID] = ( isRunaway[profileID]
+                                    ? operatingRangeEnd : temperature );
+        powers[profileID] = power;
+        nEvaluations[profileID] = nPowerEvaluations;
+    }
+}
+
+double
+SelfHeating::powerAt(const WorkloadProfiles& profiles, size_t profileID,
+                     double temperature)
+{
+    // The model tells the ranges apart with strict comparisons, so 85 C
+    //  is given to it just below, in the normal range
+    double modelTemperature = ( temperature == normalRangeTop
+                                ? nextafter(normalRangeTop, 0.0)
+                                : temperature );
+    try {
+        thermalDram.temperatureCompute(modelTemperature
+                                       * bu::celsius::degrees);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    WorkloadEnergies energies(thermalDram, thermalDram);
+    return energies.totalPower(profiles, profileID);
+}
+
+void
+SelfHeating::write(const string& selfHeatingFileName,
+                   const WorkloadProfiles& profiles) const
+{
+    string lines("name,temperature[C],power[mW],evaluations,runaway\n");
+    for ( size_t profileID = 0; profileID < temperatures.size();
+          profileID++ ) {
+        lines.append(profiles.names[profileID]);
+        lines.push_back(',');
+        appendNumber(lines, temperatures[profileID]);
+        lines.push_back(',');
+        appendNumber(lines, powers[profileID]);
+        lines.push_back(',');
+        lines.append(to_string(nEvaluations[profileID]));
+        lines.append( isRunaway[profileID] ? ",1\n" : ",0\n" );
+    }
+    ofstream selfHeatingFile(selfHeatingFileName, ofstream::trunc);
+    selfHeatingFile << lines;
+}
+
+void
+SelfHeating::appendReport(string& report,
+                          const WorkloadProfiles& profiles) const
+{
+    size_t lowestID = 0;
+    size_t highestID = 0;
+    size_t nRunaways = 0;
+    unsigned int sumEvaluations = 0;
+    for ( size_t profileID = 0; profileID < temperatures.size();
+          profileID++ ) {
+        lowestID = ( temperatures[profileID] < temperatures[lowestID]
+                     ? profileID : lowestID );
+        highestID = ( temperatures[profileID] > temperatures[highestID]
+                      ? profileID : highestID );
+        nRunaways += isRunaway[profileID];
+        sumEvaluations += nEvaluations[profileID];
+    }
+
+    report.append("Self-heating at ");
+    appendNumber(report, thermalResistance);
+    report.append(" C/W from ");
+    appendNumber(report, ambientTemperature);
+    report.append(" C (");
+    report.append(to_string(temperatures.size()));
+    report.append(" profiles)\n");
+    appendReportLine(report, "Lowest temperature   [C]",
+                     temperatures[lowestID], profiles.names[lowestID]);
+    appendReportLine(report, "Highest temperature  [C]",
+                     temperatures[highestID], profiles.names[highestID]);
+    appendReportLine(report, "Thermal runaways     [-]", nRunaways, "");
+    appendReportLine(report, "Mean evaluations     [-]",
+                     (double) sumEvaluations / temperatures.size(), "");
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+// Self-consistent temperature of a device running a workload profile. The
+//  power of the device heats it above the ambient temperature through a
+//  thermal resistance, and the temperature raises the power (IDD2N grows
+//  exponentially, and tREFI is halved above 85 C):
+//    T = ambient + thermal resistance * P(T)
+//  Each evaluation of P recomputes only the stages of the model that
+//  depend on the temperature (delays through the resistances, refresh
+//  timings and currents) on a copy of the device, and the power of the
+//  profile from them.
+// Since P grows with T, the iterations T <- ambient + Rth P(T) from the
+//  ambient temperature rise towards the lowest solution, the one a device
+//  heating up from the ambient temperature reaches. They are accelerated
+//  with secant steps on T - ambient - Rth P(T); a step beyond the solution
+//  brackets it, and the bracket is narrowed with the Illinois variant of
+//  the false position method. When there is no solution below 95 C (the
+//  end of the operating range), the profile is reported as a thermal
+//  runaway.
+#ifndef SELFHEATING_H
+#define SELFHEATING_H
+
+#include "../workload/WorkloadPower.h"
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class SelfHeating
+{
+  public:
+    // thermalResistance in C/W, ambientTemperature in C. Throws if the
+    //  ambient temperature is outside the operating range.
+    SelfHeating(const WorkloadProfiles& profiles,
+                const Current& dram,
+                double thermalResistance,
+                double ambientTemperature);
+
+    // Writes the temperature and power of every profile to a CSV file
+    void write(const string& selfHeatingFileName,
+               const WorkloadProfiles& profiles) const;
+    // Appends the lowest and highest temperatures as lines of a result table
+    void appendReport(string& report, const WorkloadProfiles& profiles) const;
+
+    // Temperatures are solved within this tolerance in C
+    static const double temperatureTolerance;
+    static const unsigned int maxIterations = 100;
+
+    double thermalResistance;
+    double ambientTemperature;
+    // Temperature in C and power in mW of every profile at the solution
+    vector<double> temperatures;
+    vector<double> powers;
+    // Evaluations of the power for every profile
+    vector<unsigned int> nEvaluations;
+    // Set for the profiles without a solution in the operating range,
+    //  whose temperature is given as 95 C
+    vector<unsigned char> isRunaway;
+
+  private:
+    // Power of a profile in mW with the device at a temperature
+    double powerAt(const WorkloadProfiles& profiles, size_t profileID,
+                   double temperature);
+
+    Current thermalDram;
+};
+
+#endif // SELFHEATING_H
@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+#include "TemperatureProfile.h"
+#include "../utils/MappedFile.h"
+#include "../utils/NumberFormat.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdint.h>
+
+namespace {
+
+const char* logHeader = "time[s],temperature[C]";
+
+// Temperatures of the ranges given to the model, which only tells the
+//  ranges apart for the refresh. The delays of tRFC are then moved to the
+//  temperature of each sample.
+const double rangeTemperatures[TemperatureProfile::N_TEMPERATURE_RANGES]
+        = {45, 90};
+
+// Span in C between the two temperatures the delays are computed at
+const double slopeSpan = 100;
+
+void throwLogError(const string& fileName,
+                   unsigned long lineNumber,
+                   const string& reason)
+{
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Temperature file ");
+    exceptionMsgThrown.append(fileName);
+    exceptionMsgThrown.append(", line ");
+    exceptionMsgThrown.append(to_string(lineNumber));
+    exceptionMsgThrown.append(": ");
+    exceptionMsgThrown.append(reason);
+    exceptionMsgThrown.append("!\n");
+    throw exceptionMsgThrown;
+}
+
+bool isBlank(char character)
+{
+    return character == ' ' || character == '\t' || character == '\r';
+}
+
+// Powers of ten that are exact doubles
+const double powersOfTen[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8,
+                              1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15};
+
+// Reads the number of a field from text up to fieldEnd. Returns false if
+//  the field holds anything else.
+// Plain decimals of at most 15 digits, as "1712345678.25" or "45.5", are
+//  read here: their digits and the power of ten are exact doubles, so the
+//  division is rounded as strtod would round the number. Other numbers
+//  (with an exponent, or longer) are left to strtod, so text must be
+//  followed by a character that ends a number before the end of the text.
+bool readField(const char* text, const char* fieldEnd, double& value)
+{
+    const char* character = text;
+    bool isNegative = ( character < fieldEnd && *character == '-' );
+    character += isNegative;
+    uint64_t digits = 0;
+    int nDigits = 0;
+    int nDecimals = -1;
+    for ( ; character < fieldEnd; character++ ) {
+        if ( *character >= '0' && *character <= '9' ) {
+            digits = 10 * digits + (*character - '0');
+            nDigits++;
+            nDecimals += ( nDecimals >= 0 );
+        }
+        else if ( *character == '.' && nDecimals < 0 ) {
+            nDecimals = 0;
+        }
+        else {
+            break;
+        }
+    }
+    while ( character < fieldEnd && isBlank(*character) ) {
+        character++;
+    }
+    if ( character == fieldEnd && nDigits > 0 && nDigits <= 15 ) {
+        value = static_cast<double>(digits)
+                / powersOfTen[nDecimals > 0 ? nDecimals : 0];
+        value = ( isNegative ? -value : value );
+        return true;
+    }
+
+    char* numberEnd;
+    value = strtod(text, &numberEnd);
+    if ( numberEnd == text ) {
+        return false;
+    }
+    while ( numberEnd < fieldEnd && isBlank(*numberEnd) ) {
+        numberEnd++;
+    }
+    return numberEnd == fieldEnd;
+}
+
+void appendReportLine(string& report, const string& label, double value)
+{
+    report.append(label);
+    if ( label.size() < 30 ) {
+        report.append(30 - label.size(), ' ');
+    }
+    appendNumber(report, value);
+    report.push_back('\n');
+}
+
+}
+
+void
+TemperatureLog::read(const string& logFileName)
+{
+    fileName = logFileName;
+    MappedFile logFile(fileName);
+    if ( !logFile.isOpen ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not read temperature file: ");
+        exceptionMsgThrown.append(fileName);
+        exceptionMsgThrown.append("!\n");
+        throw exceptionMsgThrown;
+    }
+
+    times.clear();
+    temperatures.clear();
+    sampleTexts.clear();
+    sampleTextEnds.clear();
+    // The texts of the samples are at most as long as the file
+    sampleTexts.reserve(logFile.length);
+    const char* position = logFile.text;
+    const char* end = logFile.text + logFile.length;
+    // A last line without a line break is copied, so that every line is
+    //  followed by a character that ends a number
+    string lastLine;
+    unsigned long lineNumber = 0;
+    bool hasHeader = false;
+    while ( position < end ) {
+        const char* text = position;
+        const char* textEnd = static_cast<const char*>(
+                    memchr(position, '\n', end - position));
+        if ( textEnd == NULL ) {
+            lastLine.assign(position, end);
+            text = lastLine.c_str();
+            textEnd = text + lastLine.size();
+            position = end;
+        }
+        else {
+            position = textEnd + 1;
+        }
+        lineNumber++;
+
+        while ( text < textEnd && isBlank(*text) ) {
+            text++;
+        }
+        while ( textEnd > text && isBlank(textEnd[-1]) ) {
+            textEnd--;
+        }
+        if ( text == textEnd || *text == '#' ) {
+            continue;
+        }
+        const char* comma = static_cast<const char*>(
+                    memchr(text, ',', textEnd - text));
+
+        if ( !hasHeader ) {
+            string header;
+            for ( const char* character = text; character < textEnd;
+                  character++ ) {
+                if ( !isBlank(*character) ) {
+                    header.push_back(*character);
+                }
+            }
+            if ( header != logHeader ) {
+                throwLogError(fileName, lineNumber,
+                              string("expected the header ") + logHeader);
+            }
+            hasHeader = true;
+            continue;
+        }
+
+        double time;
+        double temperature;
+        if ( comma == NULL || !readField(text, comma, time)
+             || !readField(comma + 1, textEnd, temperature) ) {
+            throwLogError(fileName, lineNumber,
+                          "expected a time and a temperature");
+        }
+        if ( !(time >= 0) || ( !times.empty() && time < times.back() ) ) {
+            throwLogError(fileName, lineNumber,
+                          "times must not be negative nor decrease");
+        }
+        if ( !(temperature > 0 && temperature < 95) ) {
+            throwLogError(fileName, lineNumber,
+                          "temperature outside the operating range "
+                          "from 0 to 95 degrees Celsius");
+        }
+        times.push_back(time);
+        temperatures.push_back(temperature);
+        const char* timeEnd = comma;
+        while ( isBlank(timeEnd[-1]) ) {
+            timeEnd--;
+        }
+        const char* temperatureText = comma + 1;
+        while ( isBlank(*temperatureText) ) {
+            temperatureText++;
+        }
+        sampleTexts.append(text, timeEnd);
+        sampleTexts.push_back(',');
+        sampleTexts.append(temperatureText, textEnd);
+        sampleTextEnds.push_back(sampleTexts.size());
+    }
+    if ( times.empty() || times.back() == times.front() ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Temperature file ");
+        exceptionMsgThrown.append(fileName);
+        exceptionMsgThrown.append(" spans no time!\n");
+        throw exceptionMsgThrown;
+    }
+
+    size_t nSamples = times.size();
+    durations.resize(nSamples);
+    isExtended.resize(nSamples);
+    duration = times.back() - times.front();
+    extendedDuration = 0;
+    for ( size_t sampleID = 0; sampleID < nSamples; sampleID++ ) {
+        durations[sampleID] = ( sampleID + 1 < nSamples
+                                ? times[sampleID + 1] - times[sampleID]
+                                : 0 );
+        // 85 C is the top of the normal range
+        isExtended[sampleID] = temperatures[sampleID] > 85;
+        extendedDuration += isExtended[sampleID] * durations[sampleID];
+    }
+}
+
+TemperatureProfile::TemperatureProfile(const TemperatureLog& temperatureLog,
+                                       const Current& dram)
+{
+    // Delays of tRFC (the activation of a refreshed row, and tRP) at the
+    //  reference temperature of the resistances and their slope, from a
+    //  copy that keeps the geometry and the wires
+    Timing rcDram(dram);
+    double referenceTemperature = dram.resistanceRefTemp.value();
+    rcDram.temperature = referenceTemperature*bu::celsius::degrees;
+    rcDram.resistiveDelayCompute();
+    double referenceDelay = rcDram.ACTtoRefreshCellDelay.value()
+                            + rcDram.trp.value();
+    rcDram.temperature = (referenceTemperature + slopeSpan)
+                         * bu::celsius::degrees;
+    rcDram.resistiveDelayCompute();
+    double delaySlope = ( rcDram.ACTtoRefreshCellDelay.value()
+                          + rcDram.trp.value() - referenceDelay )
+                        / slopeSpan;
+
+    // The copy keeps the stages that do not depend on the temperature
+    Current rangeDram(dram);
+    double vdd = dram.vdd.value();
+    double vpp = dram.vpp.value();
+    // tRFC without its delays (the clock cycles of the refreshed rows),
+    //  and tREFI, in clock cycles
+    double rangeTrfcBase[N_TEMPERATURE_RANGES];
+    double rangeTrefI[N_TEMPERATURE_RANGES];
+    double clkPeriod = dram.clkPeriod.value();
+    for ( int rangeID = 0; rangeID < N_TEMPERATURE_RANGES; rangeID++ ) {
+        try {
+            rangeDram.temperatureCompute(
+                        rangeTemperatures[rangeID]*bu::celsius::degrees);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+        rangeTrfcBase[rangeID] = ( rangeDram.trfc.value()
+                                   - rangeDram.ACTtoRefreshCellDelay.value()
+                                   - rangeDram.trp.value() ) / clkPeriod;
+        rangeTrefI[rangeID] = rangeDram.trefI_clk.value();
+        refreshPower[rangeID] = ( vdd * ( rangeDram.IDD5b.value()
+                                          - rangeDram.IDD3n.value() )
+                                  + vpp * ( rangeDram.IPP5b.value()
+                                            - rangeDram.IPP3n.value() ) )
+                                * rangeDram.trfc_clk.value()
+                                / rangeDram.trefI_clk.value();
+    }
+
+    // tRFC follows its delays, and IDD2N is evaluated, for every sample
+    Current sampleDram(dram);
+    size_t nSamples = temperatureLog.temperatures.size();
+    refreshOverhead.resize(nSamples);
+    backgroundPower.resize(nSamples);
+    for ( size_t sampleID = 0; sampleID < nSamples; sampleID++ ) {
+        double temperature = temperatureLog.temperatures[sampleID];
+        int rangeID = temperatureLog.isExtended[sampleID];
+        double delay = referenceDelay
+                       + delaySlope * (temperature - referenceTemperature);
+        refreshOverhead[sampleID] = ceil( rangeTrfcBase[rangeID]
+                                          + delay / clkPeriod )
+                                    / rangeTrefI[rangeID];
+        sampleDram.temperature = temperature*bu::celsius::degrees;
+        sampleDram.IDD2NCalc();
+        backgroundPower[sampleID] = vdd * sampleDram.IDD2n.value();
+    }
+
+    // mW times s is mJ
+    backgroundEnergy = 0;
+    highestPowerSampleID = 0;
+    double refreshTime = 0;
+    maxRefreshOverhead = 0;
+    for ( size_t sampleID = 0; sampleID < nSamples; sampleID++ ) {
+        backgroundEnergy += backgroundPower[sampleID]
+                            * temperatureLog.durations[sampleID];
+        highestPowerSampleID = ( backgroundPower[sampleID]
+                                 > backgroundPower[highestPowerSampleID]
+                                 ? sampleID : highestPowerSampleID );
+        refreshTime += refreshOverhead[sampleID]
+                       * temperatureLog.durations[sampleID];
+        maxRefreshOverhead = max(maxRefreshOverhead,
+                                 refreshOverhead[sampleID]);
+    }
+    double normalDuration = temperatureLog.duration
+                            - temperatureLog.extendedDuration;
+    meanRefreshOverhead = refreshTime / temperatureLog.duration;
+    refreshEnergy = refreshPower[NORMAL_RANGE] * normalDuration
+                    + refreshPower[EXTENDED_RANGE]
+                      * temperatureLog.extendedDuration;
+}
+
+void
+TemperatureProfile::write(const string& profileFileName,
+                          const TemperatureLog& temperatureLog) const
+{
+    ofstream profileFile(profileFileName, ofstream::trunc);
+    string lines("time[s],temperature[C],refresh_overhead,background[mW],"
+                 "refresh[mW]\n");
+    // The refresh power is the same for the samples of a range
+    string refreshTexts[N_TEMPERATURE_RANGES];
+    for ( int rangeID = 0; rangeID < N_TEMPERATURE_RANGES; rangeID++ ) {
+        refreshTexts[rangeID].push_back(',');
+        appendNumber(refreshTexts[rangeID], refreshPower[rangeID]);
+        refreshTexts[rangeID].push_back('\n');
+    }
+    size_t sampleTextBegin = 0;
+    for ( size_t sampleID = 0; sampleID < backgroundPower.size();
+          sampleID++ ) {
+        int rangeID = temperatureLog.isExtended[sampleID];
+        size_t sampleTextEnd = temperatureLog.sampleTextEnds[sampleID];
+        lines.append(temperatureLog.sampleTexts, sampleTextBegin,
+                     sampleTextEnd - sampleTextBegin);
+        sampleTextBegin = sampleTextEnd;
+        lines.push_back(',');
+        appendNumber(lines, refreshOverhead[sampleID]);
+        lines.push_back(',');
+        appendNumber(lines, backgroundPower[sampleID]);
+        lines.append(refreshTexts[rangeID]);
+        // Written in chunks, so long logs are not held twice in memory
+        if ( lines.size() > (1 << 20) ) {
+            profileFile << lines;
+            lines.clear();
+        }
+    }
+    profileFile << lines;
+}
+
+void
+TemperatureProfile::appendReport(string& report,
+                                 const TemperatureLog& temperatureLog) const
+{
+    report.append("Temperature profile of ");
+    report.append(temperatureLog.fileName);
+    report.append(" (");
+    report.append(to_string(temperatureLog.times.size()));
+    report.append(" samples)\n");
+    appendReportLine(report, "Duration             [s]",
+                     temperatureLog.duration);
+    appendReportLine(report, "Time extended range  [%]",
+                     100 * temperatureLog.extendedDuration
+                         / temperatureLog.duration);
+    appendReportLine(report, "Refresh overhead     [%]",
+                     100 * meanRefreshOverhead);
+    appendReportLine(report, "Max refresh overhead [%]",
+                     100 * maxRefreshOverhead);
+    appendReportLine(report, "Background energy    [mJ]", backgroundEnergy);
+    appendReportLine(report, "Refresh energy       [mJ]", refreshEnergy);
+    appendReportLine(report, "Background power     [mW]",
+                     backgroundEnergy / temperatureLog.duration);
+    appendReportLine(report, "Max background power [mW]",
+                     backgroundPower[highestPowerSampleID]);
+    appendReportLine(report, "Refresh power        [mW]",
+                     refreshEnergy / temperatureLog.duration);
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+// Refresh and background power of a device over a temperature time series,
+//  as the thermal log of a DIMM. Only the refresh and the background
+//  currents depend on the temperature:
+//  - tREFI takes one value in the normal temperature range (up to 85 C)
+//    and half of it in the extended range (above 85 C, up to 95 C), and
+//    the rows refreshed per REF follow it. tRFC is the clock cycles of
+//    these rows plus two delays of the array (the activation of a row and
+//    tRP), which are linear in the temperature when the resistances depend
+//    on it (as in TemperatureSweep). The clock cycles are evaluated once
+//    per range, the delays at two temperatures, and the refresh overhead
+//    tRFC / tREFI for every sample.
+//  - The refresh currents are the charge of the refreshed rows over tRFC,
+//    so the refresh power only depends on the range.
+//  - IDD2N grows exponentially with the temperature, so it is evaluated
+//    again for every sample.
+//  The other stages of the model are computed once, with the device.
+// Each sample holds until the next one, so the energies are the sums of
+//  the powers of the samples times their durations.
+#ifndef TEMPERATUREPROFILE_H
+#define TEMPERATUREPROFILE_H
+
+#include "../core/Current.h"
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Samples of a CSV file with the header line
+//  time[s],temperature[C]
+//  and one sample per line, whose times never decrease. Empty lines and
+//  lines starting with '#' are skipped. The file is memory-mapped, so logs
+//  of millions of samples are read quickly.
+class TemperatureLog
+{
+  public:
+    // Throws if the file cannot be read or a sample is invalid
+    void read(const string& logFileName);
+
+    string fileName;
+    vector<double> times;
+    vector<double> temperatures;
+    // Time and temperature of every sample as they are written in the
+    //  file ("<time>,<temperature>"), to write them back unchanged: sample
+    //  sampleID ends at sampleTextEnds[sampleID]
+    string sampleTexts;
+    vector<size_t> sampleTextEnds;
+    // Time until the next sample (0 for the last one) in s
+    vector<double> durations;
+    // Set for the samples in the extended temperature range
+    vector<unsigned char> isExtended;
+    // Time of the whole log and in the extended range in s
+    double duration;
+    double extendedDuration;
+};
+
+class TemperatureProfile
+{
+  public:
+    TemperatureProfile(const TemperatureLog& temperatureLog,
+                       const Current& dram);
+
+    // Writes the refresh overhead and the powers of every sample to a CSV
+    //  file
+    void write(const string& profileFileName,
+               const TemperatureLog& temperatureLog) const;
+    // Appends the overheads and energies over the log as lines of a result
+    //  table
+    void appendReport(string& report,
+                      const TemperatureLog& temperatureLog) const;
+
+    // Normal and extended temperature ranges
+    enum TemperatureRange {
+        NORMAL_RANGE,
+        EXTENDED_RANGE,
+        N_TEMPERATURE_RANGES
+    };
+    // Refresh power above the active background in mW
+    double refreshPower[N_TEMPERATURE_RANGES];
+
+    // tRFC / tREFI of every sample, the share of the time the device is
+    //  refreshing
+    vector<double> refreshOverhead;
+    // Background power of every sample in mW, Vdd IDD2N (all banks
+    //  precharged)
+    vector<double> backgroundPower;
+
+    // Over the log: time-weighted and highest refresh overhead, energies
+    //  in mJ
+    double meanRefreshOverhead;
+    double maxRefreshOverhead;
+    double backgroundEnergy;
+    double refreshEnergy;
+    // Sample with the highest background power
+    size_t highestPowerSampleID;
+};
+
+#endif // TEMPERATUREPROFILE_H
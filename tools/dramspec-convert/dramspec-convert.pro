@@ -0,0 +1,63 @@
+# Copyright (c) 2017, University of Kaiserslautern
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+# TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+# PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+# OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+# PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+# LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+# NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+# SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Authors: Matthias Jung, Andr'e Lucas Chinazzo
+
+# dramspec-convert: converts the binary columnar result files written with
+#  "dramspec -columnar <file>" to CSV or JSON
+
+CONFIG += c++11
+CONFIG -= qt
+
+mac {
+    CONFIG -= app_bundle
+}
+
+HEADERS += ../../utils/MappedFile.h
+HEADERS += ../../utils/NumberFormat.h
+HEADERS += ../../parser/ColumnarResultReader.h
+
+SOURCES += ../../utils/MappedFile.cpp
+SOURCES += ../../utils/NumberFormat.cpp
+SOURCES += ../../parser/ColumnarResultReader.cpp
+SOURCES += main.cpp
+
+CONFIG(release, debug|release) {
+    DESTDIR = ../../build/release
+    OBJECTS_DIR = ../../build/release/.obj/dramspec-convert
+    QMAKE_CXXFLAGS += -Wextra -Wall
+}
+
+CONFIG(debug, debug|release) {
+    DESTDIR = ../../build/debug
+    OBJECTS_DIR = ../../build/debug/.obj/dramspec-convert
+}
+
+TARGET = dramspec-convert
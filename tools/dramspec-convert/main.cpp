@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+// Converts a binary columnar result file to CSV or JSON:
+//  dramspec-convert <resultfile> [-csv | -json] [-o <outputfile>]
+#include "../../parser/ColumnarResultReader.h"
+
+#include <fstream>
+
+int main(int argc, char** argv)
+{
+    std::ios::sync_with_stdio(false);
+
+    string usage("Usage: dramspec-convert <resultfile> [-csv | -json] "
+                 "[-o <outputfile>]\n"
+                 "Converts a columnar result file (dramspec -columnar) "
+                 "to CSV (default) or JSON.\n");
+    string resultFileName;
+    string outputFileName;
+    bool isJSON = false;
+    for ( int argID = 1; argID < argc; argID++ ) {
+        string argument(argv[argID]);
+        if ( argument == "-csv" ) {
+            isJSON = false;
+        }
+        else if ( argument == "-json" ) {
+            isJSON = true;
+        }
+        else if ( argument == "-o" && argID + 1 < argc ) {
+            outputFileName = argv[++argID];
+        }
+        else if ( argument == "-h" || argument == "--help" ) {
+            std::cout << usage;
+            return 0;
+        }
+        else if ( resultFileName.empty() && argument[0] != '-' ) {
+            resultFileName = argument;
+        }
+        else {
+            std::cerr << "[ERROR] Unknown argument: " << argument << "\n"
+                      << usage;
+            return -1;
+        }
+    }
+    if ( resultFileName.empty() ) {
+        std::cerr << "[ERROR] No result file given.\n" << usage;
+        return -1;
+    }
+
+    try {
+        ColumnarResultReader resultReader(resultFileName);
+
+        ofstream outputFile;
+        if ( outputFileName.empty() == false ) {
+            outputFile.open(outputFileName, ofstream::trunc);
+            if ( outputFile.is_open() == false ) {
+                std::cerr << "[ERROR] Could not create output file: "
+                          << outputFileName << "!\n";
+                return -1;
+            }
+        }
+        ostream& output = outputFileName.empty() ? std::cout : outputFile;
+
+        if ( isJSON ) {
+            resultReader.writeJSON(output);
+        }
+        else {
+            resultReader.writeCSV(output);
+        }
+    } catch(string exceptionMsgThrown) {
+        std::cerr << exceptionMsgThrown;
+        return -1;
+    }
+
+    return 0;
+}
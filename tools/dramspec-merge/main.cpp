@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+// Combines the outputs of the shards of a run into one result set:
+//  dramspec-merge <manifest> ... [-o <mergedmanifest>]
+//                 [-columnar <resultfile>] [-d <directory>]
+#include "../../parser/ShardManifest.h"
+#include "../../parser/ColumnarResultReader.h"
+#include "../../parser/ColumnarResultWriter.h"
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <queue>
+
+namespace {
+
+// Directory part of a path, with its trailing '/', or an empty string
+string directoryOf(const string& path)
+{
+    size_t slashPosition = path.find_last_of('/');
+    return slashPosition == string::npos ? ""
+                                         : path.substr(0, slashPosition + 1);
+}
+
+// Path of a file named in a manifest, which is relative to the manifest
+string resolvedPath(const string& directory, const string& fileName)
+{
+    if ( fileName.empty() == false && fileName[0] == '/' ) {
+        return fileName;
+    }
+    return directory + fileName;
+}
+
+string baseName(const string& path)
+{
+    return path.substr(path.find_last_of('/') + 1);
+}
+
+void throwMergeError(const string& reason)
+{
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append(reason);
+    exceptionMsgThrown.append("!\n");
+    throw exceptionMsgThrown;
+}
+
+void copyFile(const string& sourceName, const string& targetName)
+{
+    ifstream sourceFile(sourceName, ifstream::binary);
+    ofstream targetFile(targetName, ofstream::binary | ofstream::trunc);
+    if ( sourceFile.is_open() == false || targetFile.is_open() == false ) {
+        throwMergeError("Could not copy result file " + sourceName
+                        + " to " + targetName);
+    }
+    targetFile << sourceFile.rdbuf();
+    targetFile.close();
+    if ( targetFile.fail() ) {
+        throwMergeError("Could not copy result file " + sourceName
+                        + " to " + targetName);
+    }
+}
+
+// Checks that the shards belong to the same run and cover all of it
+void checkShards(const vector<ShardManifest>& shards,
+                 const vector<string>& manifestNames)
+{
+    const ShardManifest& first = shards[0];
+    vector<bool> isShardFound(first.nShards + 1, false);
+    for ( size_t shardID = 0; shardID < shards.size(); shardID++ ) {
+        const ShardManifest& shard = shards[shardID];
+        if ( shard.version != first.version
+             || shard.nShards != first.nShards
+             || shard.arguments != first.arguments
+             || shard.filePairsHash != first.filePairsHash
+             || shard.sweepSizesHash != first.sweepSizesHash
+             || shard.nRunConfigurations != first.nRunConfigurations
+             || shard.columnarFileName.empty()
+                != first.columnarFileName.empty() ) {
+            throwMergeError(manifestNames[shardID] + " belongs to another run"
+                            " than " + manifestNames[0]);
+        }
+        if ( shard.shardID == 0 || shard.shardID > shard.nShards ) {
+            throwMergeError(manifestNames[shardID]
+                            + " is not the manifest of a shard");
+        }
+        if ( isShardFound[shard.shardID] ) {
+            throwMergeError("Shard " + to_string(shard.shardID)
+                            + " is given more than once");
+        }
+        isShardFound[shard.shardID] = true;
+    }
+    for ( unsigned int shardID = 1; shardID <= first.nShards; shardID++ ) {
+        if ( isShardFound[shardID] == false ) {
+            throwMergeError("Shard " + to_string(shardID) + " of "
+                            + to_string(first.nShards) + " is missing");
+        }
+    }
+}
+
+// Merges the columnar files of the shards, in the order of the
+//  configurations. The rows of each shard are already in that order.
+uint64_t mergeColumnarFiles(const vector<ShardManifest>& shards,
+                            const vector<string>& manifestNames,
+                            const string& mergedFileName)
+{
+    vector< unique_ptr<ColumnarResultReader> > readers;
+    for ( size_t shardID = 0; shardID < shards.size(); shardID++ ) {
+        readers.push_back(unique_ptr<ColumnarResultReader>(
+                new ColumnarResultReader(resolvedPath(
+                        directoryOf(manifestNames[shardID]),
+                        shards[shardID].columnarFileName))));
+        const ColumnarResultReader& reader = *readers.back();
+        if ( reader.columns.empty()
+             || reader.columns[0].name != "configuration"
+             || reader.columns[0].type != COLUMN_UINT64 ) {
+            throwMergeError(shards[shardID].columnarFileName
+                            + " has no configuration column");
+        }
+        if ( reader.columns.size() != readers[0]->columns.size() ) {
+            throwMergeError(shards[shardID].columnarFileName
+                            + " has other columns than "
+                            + shards[0].columnarFileName);
+        }
+        for ( size_t columnID = 0; columnID < reader.columns.size();
+              columnID++ ) {
+            if ( reader.columns[columnID].name
+                 != readers[0]->columns[columnID].name
+                 || reader.columns[columnID].type
+                    != readers[0]->columns[columnID].type ) {
+                throwMergeError(shards[shardID].columnarFileName
+                                + " has other columns than "
+                                + shards[0].columnarFileName);
+            }
+        }
+    }
+
+    // Position of the next row of every shard
+    struct Cursor {
+        size_t chunkID;
+        uint64_t row;
+    };
+    vector<Cursor> cursors(readers.size(), Cursor{0, 0});
+    auto rowValue = [&](size_t shardID, size_t columnID) {
+        const ColumnarResultReader::Chunk& chunk
+                = readers[shardID]->chunks[cursors[shardID].chunkID];
+        return ColumnarResultReader::readLittleEndian(chunk.data
+                + (columnID * chunk.nRows + cursors[shardID].row) * 8);
+    };
+    auto hasRow = [&](size_t shardID) {
+        return cursors[shardID].chunkID < readers[shardID]->chunks.size();
+    };
+    auto nextRow = [&](size_t shardID) {
+        Cursor& cursor = cursors[shardID];
+        cursor.row++;
+        while ( hasRow(shardID) && cursor.row
+                >= readers[shardID]->chunks[cursor.chunkID].nRows ) {
+            cursor.chunkID++;
+            cursor.row = 0;
+        }
+    };
+
+    // Smallest configuration number first
+    typedef pair<uint64_t, size_t> NextRow;
+    priority_queue< NextRow, vector<NextRow>, greater<NextRow> > nextRows;
+    for ( size_t shardID = 0; shardID < readers.size(); shardID++ ) {
+        cursors[shardID].row = (uint64_t) -1;
+        nextRow(shardID);
+        if ( hasRow(shardID) ) {
+            nextRows.push(NextRow(rowValue(shardID, 0), shardID));
+        }
+    }
+
+    ColumnarResultWriter mergedWriter(mergedFileName, readers[0]->columns);
+    vector<uint64_t> rowValues(readers[0]->columns.size());
+    uint64_t nRows = 0;
+    while ( nextRows.empty() == false ) {
+        size_t shardID = nextRows.top().second;
+        nextRows.pop();
+        for ( size_t columnID = 0; columnID < rowValues.size(); columnID++ ) {
+            rowValues[columnID] = rowValue(shardID, columnID);
+        }
+        mergedWriter.appendRow(rowValues.data());
+        nRows++;
+        nextRow(shardID);
+        if ( hasRow(shardID) ) {
+            nextRows.push(NextRow(rowValue(shardID, 0), shardID));
+        }
+    }
+    mergedWriter.close();
+    return nRows;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    std::ios::sync_with_stdio(false);
+
+    string usage("Usage: dramspec-merge <manifest> ... [-o <mergedmanifest>] "
+                 "[-columnar <resultfile>] [-d <directory>]\n"
+                 "Combines the outputs of the shards of a run "
+                 "(dramspec --shard i/N), given by their manifests.\n"
+                 "  -o         merged manifest (default: "
+                 "merged_manifest.json)\n"
+                 "  -columnar  merged result file, for shards written "
+                 "with -columnar\n"
+                 "  -d         directory the result files of the shards "
+                 "are copied to\n");
+    vector<string> manifestNames;
+    string mergedManifestName("merged_manifest.json");
+    string columnarFileName;
+    string outputDirectory;
+    for ( int argID = 1; argID < argc; argID++ ) {
+        string argument(argv[argID]);
+        if ( argument == "-o" && argID + 1 < argc ) {
+            mergedManifestName = argv[++argID];
+        }
+        else if ( argument == "-columnar" && argID + 1 < argc ) {
+            columnarFileName = argv[++argID];
+        }
+        else if ( argument == "-d" && argID + 1 < argc ) {
+            outputDirectory = argv[++argID];
+            if ( outputDirectory.back() != '/' ) {
+                outputDirectory.push_back('/');
+            }
+        }
+        else if ( argument == "-h" || argument == "--help" ) {
+            std::cout << usage;
+            return 0;
+        }
+        else if ( argument[0] != '-' ) {
+            manifestNames.push_back(argument);
+        }
+        else {
+            std::cerr << "[ERROR] Unknown argument: " << argument << "\n"
+                      << usage;
+            return -1;
+        }
+    }
+    if ( manifestNames.empty() ) {
+        std::cerr << "[ERROR] No manifest given.\n" << usage;
+        return -1;
+    }
+
+    try {
+        vector<ShardManifest> shards(manifestNames.size());
+        for ( size_t shardID = 0; shardID < shards.size(); shardID++ ) {
+            shards[shardID].read(manifestNames[shardID]);
+        }
+        checkShards(shards, manifestNames);
+
+        ShardManifest merged;
+        merged.version = shards[0].version;
+        merged.nShards = shards[0].nShards;
+        merged.arguments = shards[0].arguments;
+        merged.filePairsHash = shards[0].filePairsHash;
+        merged.sweepSizesHash = shards[0].sweepSizesHash;
+        merged.nRunConfigurations = shards[0].nRunConfigurations;
+
+        for ( size_t shardID = 0; shardID < shards.size(); shardID++ ) {
+            string shardDirectory = directoryOf(manifestNames[shardID]);
+            for ( ShardManifest::Configuration configuration
+                  : shards[shardID].configurations ) {
+                for ( string& outputFileName
+                      : configuration.outputFileNames ) {
+                    string sourceName = resolvedPath(shardDirectory,
+                                                     outputFileName);
+                    if ( outputDirectory.empty() ) {
+                        outputFileName = sourceName;
+                    }
+                    else {
+                        outputFileName = outputDirectory
+                                         + baseName(outputFileName);
+                        copyFile(sourceName, outputFileName);
+                    }
+                }
+                merged.configurations.push_back(configuration);
+            }
+        }
+
+        sort(merged.configurations.begin(), merged.configurations.end(),
+             [](const ShardManifest::Configuration& first,
+                const ShardManifest::Configuration& second) {
+                 return first.configuration < second.configuration;
+             });
+        for ( uint64_t configurationID = 0;
+              configurationID < merged.configurations.size()
+              || configurationID < merged.nRunConfigurations;
+              configurationID++ ) {
+            if ( configurationID >= merged.configurations.size()
+                 || merged.configurations[configurationID].configuration
+                    != configurationID + 1 ) {
+                throwMergeError("Configuration "
+                                + to_string(configurationID + 1)
+                                + " is missing or duplicated in the shards");
+            }
+        }
+
+        if ( shards[0].columnarFileName.empty() == false ) {
+            if ( columnarFileName.empty() ) {
+                throwMergeError("The shards have columnar result files, "
+                                "give the merged one with -columnar");
+            }
+            uint64_t nRows = mergeColumnarFiles(shards, manifestNames,
+                                                columnarFileName);
+            if ( nRows != merged.nRunConfigurations ) {
+                throwMergeError("The columnar result files hold "
+                                + to_string(nRows) + " rows instead of "
+                                + to_string(merged.nRunConfigurations));
+            }
+            merged.columnarFileName = columnarFileName;
+        }
+
+        merged.write(mergedManifestName);
+        std::cout << "Merged " << shards.size() << " shards: "
+                  << merged.configurations.size() << " configurations, "
+                  << "listed in " << mergedManifestName << "\n";
+    } catch(string exceptionMsgThrown) {
+        std::cerr << exceptionMsgThrown;
+        return -1;
+    }
+
+    return 0;
+}
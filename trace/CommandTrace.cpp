@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+#include "CommandTrace.h"
+
+#include <cstring>
+
+const char* CommandTrace::commandNames[N_TRACE_COMMANDS] = {
+    "ACT", "RD", "WR", "PRE", "REF"
+};
+
+namespace {
+
+inline bool isBlank(char character)
+{
+    return character == ' ' || character == '\t' || character == '\r';
+}
+
+inline const char* skipBlanks(const char* position, const char* end)
+{
+    while ( position < end && isBlank(*position) ) {
+        position++;
+    }
+    return position;
+}
+
+// Reads an unsigned number, returns NULL if there is none
+inline const char* readUnsigned(const char* position,
+                                const char* end,
+                                uint64_t& value)
+{
+    const char* first = position;
+    value = 0;
+    while ( position < end
+            && (unsigned char) (*position - '0') < 10 ) {
+        value = value * 10 + (*position - '0');
+        position++;
+    }
+    // At most 19 digits, so that the value does not overflow
+    if ( position == first || position - first > 19 ) {
+        return NULL;
+    }
+    return position;
+}
+
+// Command of the name starting at position, or N_TRACE_COMMANDS
+inline unsigned int readCommand(const char* position,
+                                const char* end,
+                                const char*& nameEnd)
+{
+    const char* first = position;
+    while ( position < end && *position >= 'A' && *position <= 'Z' ) {
+        position++;
+    }
+    nameEnd = position;
+    size_t nameLength = position - first;
+    for ( unsigned int command = 0; command < N_TRACE_COMMANDS; command++ ) {
+        const char* name = CommandTrace::commandNames[command];
+        if ( strlen(name) == nameLength
+             && memcmp(name, first, nameLength) == 0 ) {
+            return command;
+        }
+    }
+    return N_TRACE_COMMANDS;
+}
+
+// Reads a line of the usual form "<cycle>,<command>,<bank>\n", without any
+//  blank, and returns the start of the next line. Returns NULL on any other
+//  line, which is then read by the general (slower) parser.
+inline const char* readPlainLine(const char* position,
+                                 const char* end,
+                                 TraceCommand& command)
+{
+    const char* first = position;
+    uint64_t cycle = 0;
+    while ( position < end
+            && (unsigned char) (*position - '0') < 10 ) {
+        cycle = cycle * 10 + (*position - '0');
+        position++;
+    }
+    if ( position == first || position - first > 19
+         || end - position < 4 || *position != ',' ) {
+        return NULL;
+    }
+    position++;
+
+    unsigned int commandType;
+    const char* name = position;
+    switch ( name[0] ) {
+      case 'A':
+        commandType = ( name[1] == 'C' && name[2] == 'T' ) ? TRACE_ACT
+                                                           : N_TRACE_COMMANDS;
+        position += 3;
+        break;
+      case 'R':
+        if ( name[1] == 'D' ) {
+            commandType = TRACE_RD;
+            position += 2;
+        }
+        else {
+            commandType = ( name[1] == 'E' && name[2] == 'F' )
+                          ? TRACE_REF : N_TRACE_COMMANDS;
+            position += 3;
+        }
+        break;
+      case 'W':
+        commandType = ( name[1] == 'R' ) ? TRACE_WR : N_TRACE_COMMANDS;
+        position += 2;
+        break;
+      case 'P':
+        commandType = ( name[1] == 'R' && name[2] == 'E' ) ? TRACE_PRE
+                                                           : N_TRACE_COMMANDS;
+        position += 3;
+        break;
+      default:
+        return NULL;
+    }
+    if ( commandType == N_TRACE_COMMANDS || position >= end
+         || *position != ',' ) {
+        return NULL;
+    }
+    position++;
+
+    first = position;
+    uint64_t bank = 0;
+    while ( position < end
+            && (unsigned char) (*position - '0') < 10 ) {
+        bank = bank * 10 + (*position - '0');
+        position++;
+    }
+    if ( position == first || position - first > 9 || bank > UINT32_MAX
+         || ( position < end && *position != '\n' ) ) {
+        return NULL;
+    }
+
+    command.cycle = cycle;
+    command.command = commandType;
+    command.bank = ( commandType == TRACE_REF ? 0 : bank );
+    return ( position < end ? position + 1 : end );
+}
+
+}
+
+CommandTrace::CommandTrace(const string& traceFileName) :
+    fileName(traceFileName),
+    traceFile(traceFileName)
+{
+    if ( traceFile.isOpen == false ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not read trace file: ");
+        exceptionMsgThrown.append(fileName);
+        exceptionMsgThrown.append("!\n");
+        throw exceptionMsgThrown;
+    }
+    position = traceFile.text;
+    end = traceFile.text + traceFile.length;
+    lineNumber = 0;
+    lastCycle = 0;
+}
+
+bool
+CommandTrace::readBlock(vector<TraceCommand>& commands, size_t maxCommands)
+{
+    commands.clear();
+    while ( position < end && commands.size() < maxCommands ) {
+        TraceCommand plainCommand;
+        const char* plainLineEnd = readPlainLine(position, end, plainCommand);
+        if ( plainLineEnd != NULL && plainCommand.cycle >= lastCycle ) {
+            lineNumber++;
+            lastCycle = plainCommand.cycle;
+            commands.push_back(plainCommand);
+            position = plainLineEnd;
+            continue;
+        }
+
+        const char* lineEnd = static_cast<const char*>(
+                    memchr(position, '\n', end - position));
+        if ( lineEnd == NULL ) {
+            lineEnd = end;
+        }
+        const char* nextLine = ( lineEnd < end ? lineEnd + 1 : end );
+        lineNumber++;
+
+        const char* field = skipBlanks(position, lineEnd);
+        if ( field == lineEnd || *field == '#' ) {
+            position = nextLine;
+            continue;
+        }
+
+        TraceCommand command;
+        field = readUnsigned(field, lineEnd, command.cycle);
+        if ( field == NULL ) {
+            throwLineError("invalid cycle");
+        }
+        field = skipBlanks(field, lineEnd);
+        if ( field == lineEnd || *field != ',' ) {
+            throwLineError("missing command");
+        }
+        field = skipBlanks(field + 1, lineEnd);
+        const char* nameEnd;
+        command.command = readCommand(field, lineEnd, nameEnd);
+        if ( command.command == N_TRACE_COMMANDS ) {
+            throwLineError("unknown command");
+        }
+        field = skipBlanks(nameEnd, lineEnd);
+
+        // The bank of an all-bank refresh is optional
+        uint64_t bank = 0;
+        if ( field != lineEnd && *field == ',' ) {
+            field = readUnsigned(skipBlanks(field + 1, lineEnd),
+                                 lineEnd, bank);
+            if ( field == NULL || bank > UINT32_MAX ) {
+                throwLineError("invalid bank");
+            }
+            field = skipBlanks(field, lineEnd);
+        }
+        else if ( command.command != TRACE_REF ) {
+            throwLineError("missing bank");
+        }
+        if ( field != lineEnd ) {
+            throwLineError("unexpected text after the bank");
+        }
+        if ( command.cycle < lastCycle ) {
+            throwLineError("cycle before the one of the previous command");
+        }
+        lastCycle = command.cycle;
+        command.bank = ( command.command == TRACE_REF ? 0 : bank );
+
+        commands.push_back(command);
+        position = nextLine;
+    }
+    return !commands.empty();
+}
+
+void
+CommandTrace::throwLineError(const string& reason) const
+{
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Trace file ");
+    exceptionMsgThrown.append(fileName);
+    exceptionMsgThrown.append(", line ");
+    exceptionMsgThrown.append(to_string(lineNumber));
+    exceptionMsgThrown.append(": ");
+    exceptionMsgThrown.append(reason);
+    exceptionMsgThrown.append("!\n");
+    throw exceptionMsgThrown;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+// Reader of DRAM command traces, as written by memory controllers or
+//  simulators. Each line holds one command: "<cycle>,<command>,<bank>",
+//  where the cycle is counted in clock cycles of the DRAM (tCK) and the
+//  command is ACT, RD, WR, PRE or REF (all-bank refresh, whose bank is
+//  ignored and may be left out). Spaces around the fields, empty lines and
+//  lines starting with '#' are ignored. The cycles never decrease.
+// The trace is memory-mapped and read in blocks of compact commands, so
+//  traces of many gigabytes are read at the speed of the page cache,
+//  without holding them in memory.
+#ifndef COMMANDTRACE_H
+#define COMMANDTRACE_H
+
+#include "../utils/MappedFile.h"
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+using namespace std;
+
+enum TraceCommandType {
+    TRACE_ACT,
+    TRACE_RD,
+    TRACE_WR,
+    TRACE_PRE,
+    TRACE_REF,
+    N_TRACE_COMMANDS
+};
+
+struct TraceCommand {
+    uint64_t cycle;
+    uint32_t bank;
+    uint32_t command;
+};
+
+class CommandTrace
+{
+  public:
+    // Throws if the trace cannot be read
+    CommandTrace(const string& traceFileName);
+
+    // Replaces commands with the next commands of the trace, at most
+    //  maxCommands of them. Returns false once the trace is read to its
+    //  end. Throws on a line that is not a command.
+    bool readBlock(vector<TraceCommand>& commands, size_t maxCommands);
+
+    static const char* commandNames[N_TRACE_COMMANDS];
+
+    string fileName;
+    // Line of the last command read
+    unsigned long lineNumber;
+
+  private:
+    void throwLineError(const string& reason) const;
+
+    MappedFile traceFile;
+    const char* position;
+    const char* end;
+    uint64_t lastCycle;
+};
+
+#endif // COMMANDTRACE_H
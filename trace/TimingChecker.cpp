@@ -0,0 +1,450 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+#include "TimingChecker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <fstream>
+#include <thread>
+
+namespace {
+
+// Commands read at a time, checked while the next ones are read
+const size_t blockSize = 1 << 20;
+
+// Refreshes that may be postponed, so that up to (1 + postponed) tREFI
+//  pass between two REF
+const uint64_t maxPostponedRefreshes = 8;
+
+// True if a command at cycle comes less than minCycles after the command
+//  at lastPlusOne - 1 (lastPlusOne is 0 if there was none)
+inline bool isTooEarly(uint64_t cycle, uint64_t lastPlusOne,
+                       uint64_t minCycles)
+{
+    return lastPlusOne != 0 && cycle + 1 < lastPlusOne + minCycles;
+}
+
+// Same as isTooEarly, as 0 or 1 and without branches
+inline uint32_t tooEarly(uint64_t cycle, uint64_t lastPlusOne,
+                         uint64_t minCycles)
+{
+    return ( lastPlusOne != 0 ) & ( cycle + 1 < lastPlusOne + minCycles );
+}
+
+// value if condition (0 or 1) is set, otherValue if not, without branches
+inline uint64_t select(uint32_t condition, uint64_t value, uint64_t otherValue)
+{
+    uint64_t mask = -(uint64_t) condition;
+    return ( value & mask ) | ( otherValue & ~mask );
+}
+
+// Timing in clock cycles, rounded up as the controller has to wait for it
+uint64_t clockCycles(double value)
+{
+    return ( value > 0 ? (uint64_t) ceil(value) : 0 );
+}
+
+bool isBefore(const TimingViolation& violation,
+              const TimingViolation& otherViolation)
+{
+    if ( violation.commandNumber != otherViolation.commandNumber ) {
+        return violation.commandNumber < otherViolation.commandNumber;
+    }
+    if ( violation.bank != otherViolation.bank ) {
+        return violation.bank < otherViolation.bank;
+    }
+    return violation.constraint < otherViolation.constraint;
+}
+
+}
+
+const char* TimingChecker::constraintNames[N_TIMING_CONSTRAINTS] = {
+    "tRCD", "tRAS", "tRP", "tRC", "tRTP", "tWR", "tCCD", "tRFC", "tREFI",
+    "bank state"
+};
+
+TimingChecker::TimingChecker(const Current& dram,
+                             const TechnologyValues& technologyValues,
+                             unsigned int nThreads)
+{
+    // Only the results are used, since results loaded from the cache have
+    //  no intermediate values
+    timings.rcd = clockCycles(dram.trcd_clk.value());
+    timings.ras = clockCycles(dram.tras_clk.value());
+    timings.rp = clockCycles(dram.trp_clk.value());
+    timings.rc = clockCycles(dram.trc_clk.value());
+    timings.rtp = clockCycles(dram.trtp_clk.value());
+    timings.wr = clockCycles(dram.twr_clk.value());
+    timings.ccd = clockCycles(dram.tccd_clk.value());
+    timings.rfc = clockCycles(dram.trfc_clk.value());
+    timings.refI = clockCycles(dram.trefI_clk.value());
+
+    nBanks = technologyValues.nBanks;
+    nShards = max(min(nThreads, nBanks), 1u);
+    nCommands = 0;
+    for ( int constraint = 0; constraint < N_TIMING_CONSTRAINTS;
+          constraint++ ) {
+        nViolations[constraint] = 0;
+        firstViolations[constraint] = TimingViolation();
+    }
+}
+
+void
+TimingChecker::check(const string& fileName,
+                     const string& violationFileName)
+{
+    traceFileName = fileName;
+    CommandTrace trace(fileName);
+
+    Shard::BankState closedBank = { 0, 0, 0, 0, 0 };
+    shards.assign(nShards, Shard());
+    for ( uint32_t shardID = 0; shardID < nShards; shardID++ ) {
+        Shard& shard = shards[shardID];
+        shard.timings = &timings;
+        shard.shardID = shardID;
+        shard.nShards = nShards;
+        // The banks of the other shards share a last, scratch state
+        uint32_t nShardBanks = (nBanks - shardID + nShards - 1) / nShards;
+        shard.banks.assign(nShardBanks + 1, closedBank);
+        shard.bankSlots.assign(nBanks, nShardBanks);
+        for ( uint32_t bankID = shardID; bankID < nBanks;
+              bankID += nShards ) {
+            shard.bankSlots[bankID] = bankID / nShards;
+        }
+        shard.refresh = 0;
+        shard.columnAccess = 0;
+    }
+
+    ofstream violationFile;
+    if ( !violationFileName.empty() ) {
+        violationFile.open(violationFileName, ofstream::trunc);
+        violationFile << "command,cycle,type,bank,constraint,allowed_cycle\n";
+    }
+    string violationLines;
+    vector<TimingViolation> blockViolations;
+
+    vector<TraceCommand> commands;
+    vector<TraceCommand> nextCommands;
+    commands.reserve(blockSize);
+    nextCommands.reserve(blockSize);
+    trace.readBlock(commands, blockSize);
+    while ( !commands.empty() ) {
+        for ( const TraceCommand& command : commands ) {
+            if ( command.bank >= nBanks ) {
+                string exceptionMsgThrown("[ERROR] ");
+                exceptionMsgThrown.append("Trace file ");
+                exceptionMsgThrown.append(traceFileName);
+                exceptionMsgThrown.append(" uses bank ");
+                exceptionMsgThrown.append(to_string(command.bank));
+                exceptionMsgThrown.append(", but the device has ");
+                exceptionMsgThrown.append(to_string(nBanks));
+                exceptionMsgThrown.append(" banks!\n");
+                throw exceptionMsgThrown;
+            }
+        }
+
+        vector<thread> shardThreads;
+        for ( Shard& shard : shards ) {
+            shardThreads.push_back(thread(&Shard::check, &shard,
+                                          cref(commands), nCommands + 1));
+        }
+        // The threads are joined before an error of the reader is thrown
+        string readError;
+        try {
+            trace.readBlock(nextCommands, blockSize);
+        } catch(string exceptionMsgThrown) {
+            readError = exceptionMsgThrown;
+        }
+        for ( thread& shardThread : shardThreads ) {
+            shardThread.join();
+        }
+        if ( !readError.empty() ) {
+            throw readError;
+        }
+
+        blockViolations.clear();
+        for ( const Shard& shard : shards ) {
+            blockViolations.insert(blockViolations.end(),
+                                   shard.violations.begin(),
+                                   shard.violations.end());
+        }
+        sort(blockViolations.begin(), blockViolations.end(), isBefore);
+        violationLines.clear();
+        addViolations(blockViolations, violationLines);
+        if ( violationFile.is_open() ) {
+            violationFile << violationLines;
+        }
+
+        nCommands += commands.size();
+        commands.swap(nextCommands);
+    }
+}
+
+void
+TimingChecker::addViolations(const vector<TimingViolation>& violations,
+                             string& violationLines)
+{
+    for ( const TimingViolation& violation : violations ) {
+        if ( nViolations[violation.constraint] == 0 ) {
+            firstViolations[violation.constraint] = violation;
+        }
+        nViolations[violation.constraint]++;
+
+        violationLines.append(to_string(violation.commandNumber));
+        violationLines.push_back(',');
+        violationLines.append(to_string(violation.cycle));
+        violationLines.push_back(',');
+        violationLines.append(CommandTrace::commandNames[violation.command]);
+        violationLines.push_back(',');
+        violationLines.append(to_string(violation.bank));
+        violationLines.push_back(',');
+        violationLines.append(constraintNames[violation.constraint]);
+        violationLines.push_back(',');
+        violationLines.append(to_string(violation.allowedCycle));
+        violationLines.push_back('\n');
+    }
+}
+
+void
+TimingChecker::Shard::addViolation(const TraceCommand& command,
+                                   uint32_t bank,
+                                   uint64_t number,
+                                   int constraint,
+                                   uint64_t allowedCycle)
+{
+    TimingViolation violation;
+    violation.commandNumber = number;
+    violation.cycle = command.cycle;
+    violation.allowedCycle = allowedCycle;
+    violation.bank = bank;
+    violation.command = command.command;
+    violation.constraint = constraint;
+    violations.push_back(violation);
+}
+
+void
+TimingChecker::Shard::addBankViolations(const TraceCommand& command,
+                                        uint64_t number,
+                                        uint32_t violationMask,
+                                        const BankState& bank)
+{
+    const uint64_t lastCycles[N_TIMING_CONSTRAINTS] = {
+        bank.activate, bank.activate, bank.precharge, bank.activate,
+        bank.read, bank.write, columnAccess, refresh, 0, 0
+    };
+    const uint64_t minCycles[N_TIMING_CONSTRAINTS] = {
+        timings->rcd, timings->ras, timings->rp, timings->rc,
+        timings->rtp, timings->wr, timings->ccd, timings->rfc, 0, 0
+    };
+    for ( int constraint = 0; constraint < N_TIMING_CONSTRAINTS;
+          constraint++ ) {
+        if ( ( violationMask >> constraint & 1 ) == 0 ) {
+            continue;
+        }
+        uint64_t allowedCycle = ( constraint == CONSTRAINT_BANK_STATE
+                                  ? command.cycle
+                                  : lastCycles[constraint] - 1
+                                    + minCycles[constraint] );
+        addViolation(command, command.bank, number, constraint,
+                     allowedCycle);
+    }
+}
+
+void
+TimingChecker::Shard::checkRefresh(const TraceCommand& command,
+                                   uint64_t number)
+{
+    uint64_t cycle = command.cycle;
+    if ( shardID == 0 ) {
+        if ( isTooEarly(cycle, refresh, timings->rfc) ) {
+            addViolation(command, command.bank, number,
+                         CONSTRAINT_TRFC, refresh - 1 + timings->rfc);
+        }
+        uint64_t maxInterval = (1 + maxPostponedRefreshes) * timings->refI;
+        if ( refresh != 0 && cycle > refresh - 1 + maxInterval ) {
+            addViolation(command, command.bank, number,
+                         CONSTRAINT_TREFI, refresh - 1 + maxInterval);
+        }
+    }
+    // The last state is the scratch one of the banks of other shards
+    for ( size_t bankID = 0; bankID + 1 < banks.size(); bankID++ ) {
+        const BankState& bank = banks[bankID];
+        uint32_t bankNumber = shardID + bankID * nShards;
+        if ( bank.isOpen ) {
+            addViolation(command, bankNumber, number,
+                         CONSTRAINT_BANK_STATE, cycle);
+        }
+        if ( isTooEarly(cycle, bank.precharge, timings->rp) ) {
+            addViolation(command, bankNumber, number,
+                         CONSTRAINT_TRP, bank.precharge - 1 + timings->rp);
+        }
+    }
+    refresh = cycle + 1;
+}
+
+void
+TimingChecker::Shard::check(const vector<TraceCommand>& commands,
+                            uint64_t firstNumber)
+{
+    violations.clear();
+    uint32_t otherBanksSlot = banks.size() - 1;
+    uint32_t isFirstShard = ( shardID == 0 );
+
+    // All constraints of a command are checked with arithmetic and
+    //  selects rather than branches, which the order of the commands of a
+    //  trace makes unpredictable. Only the (rare) violations branch off.
+    for ( size_t commandID = 0; commandID < commands.size(); commandID++ ) {
+        const TraceCommand& command = commands[commandID];
+        uint64_t cycle = command.cycle;
+        if ( command.command == TRACE_REF ) {
+            checkRefresh(command, firstNumber + commandID);
+            continue;
+        }
+
+        uint32_t bankSlot = bankSlots[command.bank];
+        BankState& bank = banks[bankSlot];
+        uint32_t isOwnBank = ( bankSlot != otherBanksSlot );
+        uint32_t isActivate = ( command.command == TRACE_ACT );
+        uint32_t isRead = ( command.command == TRACE_RD );
+        uint32_t isWrite = ( command.command == TRACE_WR );
+        uint32_t isColumn = isRead | isWrite;
+        uint32_t isOpen = bank.isOpen;
+        uint32_t isClosing = ( command.command == TRACE_PRE ) & isOpen;
+
+        uint32_t activateMask
+                = isOpen << CONSTRAINT_BANK_STATE
+                  | tooEarly(cycle, bank.precharge, timings->rp)
+                    << CONSTRAINT_TRP
+                  | tooEarly(cycle, bank.activate, timings->rc)
+                    << CONSTRAINT_TRC
+                  | tooEarly(cycle, refresh, timings->rfc)
+                    << CONSTRAINT_TRFC;
+        uint32_t columnMask
+                = (isOpen ^ 1) << CONSTRAINT_BANK_STATE
+                  | ( isOpen & tooEarly(cycle, bank.activate, timings->rcd) )
+                    << CONSTRAINT_TRCD;
+        uint32_t prechargeMask
+                = tooEarly(cycle, bank.activate, timings->ras)
+                  << CONSTRAINT_TRAS
+                  | tooEarly(cycle, bank.read, timings->rtp)
+                    << CONSTRAINT_TRTP
+                  | tooEarly(cycle, bank.write, timings->wr)
+                    << CONSTRAINT_TWR;
+        uint32_t violationMask
+                = ( ( activateMask & -isActivate )
+                    | ( columnMask & -isColumn )
+                    | ( prechargeMask & -isClosing ) ) & -isOwnBank;
+        // Constraints between banks are checked by shard 0 only
+        violationMask |= ( isFirstShard & isColumn
+                           & tooEarly(cycle, columnAccess, timings->ccd) )
+                         << CONSTRAINT_TCCD;
+        if ( violationMask != 0 ) {
+            addBankViolations(command, firstNumber + commandID,
+                              violationMask, bank);
+        }
+
+        uint64_t nextCycle = cycle + 1;
+        columnAccess = select(isColumn, nextCycle, columnAccess);
+        bank.activate = select(isActivate, nextCycle, bank.activate);
+        bank.read = select(isActivate, 0,
+                           select(isRead, nextCycle, bank.read));
+        bank.write = select(isActivate, 0,
+                            select(isWrite, nextCycle, bank.write));
+        bank.precharge = select(isClosing, nextCycle, bank.precharge);
+        bank.isOpen = isActivate | ( isOpen & (isClosing ^ 1) );
+    }
+}
+
+string
+TimingChecker::timingsKey() const
+{
+    const uint64_t values[] = { timings.rcd, timings.ras, timings.rp,
+                                timings.rc, timings.rtp, timings.wr,
+                                timings.ccd, timings.rfc, timings.refI,
+                                nBanks };
+    string key;
+    for ( uint64_t value : values ) {
+        key.append(to_string(value));
+        key.push_back(',');
+    }
+    return key;
+}
+
+void
+TimingChecker::appendReport(string& report) const
+{
+    uint64_t nAllViolations = 0;
+    for ( int constraint = 0; constraint < N_TIMING_CONSTRAINTS;
+          constraint++ ) {
+        nAllViolations += nViolations[constraint];
+    }
+    report.append("Timing check of ");
+    report.append(traceFileName);
+    report.append(" (");
+    report.append(to_string(nCommands));
+    report.append(" commands, ");
+    report.append(to_string(nAllViolations));
+    report.append(" violations)\n");
+
+    // Lines of a result table, the label padded like the DRAMSpec tables
+    for ( int constraint = 0; constraint < N_TIMING_CONSTRAINTS;
+          constraint++ ) {
+        string label(constraintNames[constraint]);
+        label.append(" violations");
+        label.resize(30, ' ');
+        report.append(label);
+        report.append(to_string(nViolations[constraint]));
+        if ( nViolations[constraint] != 0 ) {
+            const TimingViolation& violation = firstViolations[constraint];
+            report.append(" (first: ");
+            report.append(CommandTrace::commandNames[violation.command]);
+            report.append(" of bank ");
+            report.append(to_string(violation.bank));
+            report.append(" at cycle ");
+            report.append(to_string(violation.cycle));
+            report.append(")");
+        }
+        report.push_back('\n');
+    }
+}
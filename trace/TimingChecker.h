@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+// Checks that a DRAM command trace (see CommandTrace.h) keeps the timings
+//  of a device, in clock cycles as computed by DRAMSpec:
+//  - tRCD: ACT to RD or WR of the bank
+//  - tRAS: ACT to PRE of the bank
+//  - tRP: PRE to ACT of the bank, and to REF
+//  - tRC: ACT to ACT of the bank
+//  - tRTP: RD to PRE of the bank
+//  - tWR: WR to PRE of the bank
+//  - tCCD: RD or WR to RD or WR of any bank
+//  - tRFC: REF to ACT of any bank, and to REF
+//  - tREFI: at most 9 tREFI between two REF, as up to 8 refreshes may
+//    be postponed
+//  - bank state: ACT to an open bank, RD or WR to a closed bank, and REF
+//    while a bank is open
+// A PRE to a closed bank does nothing, as in the JEDEC standards.
+// The banks are split into shards that are checked in parallel, each one
+//  by its own thread over the same blocks of the trace, while the next
+//  block is read. The violations of the shards are then merged in the
+//  order of the trace.
+#ifndef TIMINGCHECKER_H
+#define TIMINGCHECKER_H
+
+#include "CommandTrace.h"
+#include "../core/Current.h"
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+using namespace std;
+
+enum TimingConstraint {
+    CONSTRAINT_TRCD,
+    CONSTRAINT_TRAS,
+    CONSTRAINT_TRP,
+    CONSTRAINT_TRC,
+    CONSTRAINT_TRTP,
+    CONSTRAINT_TWR,
+    CONSTRAINT_TCCD,
+    CONSTRAINT_TRFC,
+    CONSTRAINT_TREFI,
+    CONSTRAINT_BANK_STATE,
+    N_TIMING_CONSTRAINTS
+};
+
+struct TimingViolation {
+    // Number of the command in the trace, from 1
+    uint64_t commandNumber;
+    uint64_t cycle;
+    // Earliest cycle allowed for the command (latest one for tREFI, and
+    //  the cycle of the command for the bank state)
+    uint64_t allowedCycle;
+    uint32_t bank;
+    uint16_t command;
+    uint16_t constraint;
+};
+
+class TimingChecker
+{
+  public:
+    // The timings are taken from the results of a configuration, and the
+    //  banks are checked by up to nThreads threads
+    TimingChecker(const Current& dram,
+                  const TechnologyValues& technologyValues,
+                  unsigned int nThreads);
+
+    // Checks a whole trace. Every violation is written to violationFileName
+    //  as CSV, unless it is empty (then they are only counted). Throws if
+    //  the trace cannot be read, or uses banks that the device does not have.
+    void check(const string& traceFileName, const string& violationFileName);
+
+    // Appends the number of violations of each constraint as lines of a
+    //  result table
+    void appendReport(string& report) const;
+
+    // Identifies what the check depends on (timings and banks), so that
+    //  configurations with the same key get the same violations
+    string timingsKey() const;
+
+    static const char* constraintNames[N_TIMING_CONSTRAINTS];
+
+    string traceFileName;
+    uint64_t nCommands;
+    uint64_t nViolations[N_TIMING_CONSTRAINTS];
+    // First violation of each constraint, if there is one
+    TimingViolation firstViolations[N_TIMING_CONSTRAINTS];
+
+  private:
+    // Timings in clock cycles
+    struct Timings {
+        uint64_t rcd;
+        uint64_t ras;
+        uint64_t rp;
+        uint64_t rc;
+        uint64_t rtp;
+        uint64_t wr;
+        uint64_t ccd;
+        uint64_t rfc;
+        uint64_t refI;
+    };
+
+    // Banks bank % nShards == shardID. Their states are contiguous, so the
+    //  shard of a thread stays in its cache, apart from the other shards.
+    struct Shard {
+        // Cycles of the last commands of a bank, plus 1 (0 before the
+        //  first one), in 40 bytes
+        struct BankState {
+            uint64_t activate;
+            uint64_t precharge;
+            uint64_t read;
+            uint64_t write;
+            uint32_t isOpen;
+        };
+
+        // Checks commands, numbered from firstNumber, after the ones
+        //  checked before. The violations of the commands replace the
+        //  previous ones.
+        void check(const vector<TraceCommand>& commands,
+                   uint64_t firstNumber);
+        void checkRefresh(const TraceCommand& command, uint64_t number);
+        void addBankViolations(const TraceCommand& command, uint64_t number,
+                               uint32_t violationMask,
+                               const BankState& bank);
+        void addViolation(const TraceCommand& command, uint32_t bank,
+                          uint64_t number, int constraint,
+                          uint64_t allowedCycle);
+
+        const Timings * timings;
+        uint32_t shardID;
+        uint32_t nShards;
+        vector<BankState> banks;
+        // Index in banks of every bank of the device, which saves a
+        //  division per command. The banks of other shards share the last,
+        //  scratch state.
+        vector<uint32_t> bankSlots;
+        // Last REF, plus 1
+        uint64_t refresh;
+        // Last RD or WR of any bank, plus 1, checked by shard 0 only
+        uint64_t columnAccess;
+        vector<TimingViolation> violations;
+    };
+
+    void addViolations(const vector<TimingViolation>& violations,
+                       string& violationLines);
+
+    Timings timings;
+    uint32_t nBanks;
+    uint32_t nShards;
+    vector<Shard> shards;
+};
+
+#endif // TIMINGCHECKER_H
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+#include "TraceEnergy.h"
+#include "../utils/NumberFormat.h"
+
+namespace {
+
+// Line of a result table, the label padded like the DRAMSpec tables
+void appendReportLine(string& report, const string& label, double value)
+{
+    report.append(label);
+    if ( label.size() < 30 ) {
+        report.append(30 - label.size(), ' ');
+    }
+    appendNumber(report, value);
+    report.push_back('\n');
+}
+
+// Banks open after a command, given if the bank was open before it
+const uint64_t nextOpenState[N_TRACE_COMMANDS][2] = {
+    { 1, 1 },   // ACT
+    { 0, 1 },   // RD
+    { 0, 1 },   // WR
+    { 0, 0 },   // PRE
+    { 0, 1 }    // REF (of all banks, which are expected to be closed)
+};
+
+}
+
+const uint32_t TraceActivity::maxBanks;
+
+TraceActivity::TraceActivity()
+{
+    for ( int command = 0; command < N_TRACE_COMMANDS; command++ ) {
+        nCommands[command] = 0;
+    }
+    anyOpenCycles = 0;
+    firstCycle = 0;
+    lastCycle = 0;
+    nOpenBanks = 0;
+    anyOpenSince = 0;
+}
+
+void
+TraceActivity::read(const string& fileName)
+{
+    traceFileName = fileName;
+    CommandTrace trace(fileName);
+    vector<TraceCommand> commands;
+    commands.reserve(65536);
+    while ( trace.readBlock(commands, 65536) ) {
+        add(commands);
+    }
+    finish();
+}
+
+void
+TraceActivity::add(const vector<TraceCommand>& commands)
+{
+    if ( commands.empty() ) {
+        return;
+    }
+    uint64_t nCommandsBefore = 0;
+    for ( int command = 0; command < N_TRACE_COMMANDS; command++ ) {
+        nCommandsBefore += nCommands[command];
+    }
+    if ( nCommandsBefore == 0 ) {
+        firstCycle = commands.front().cycle;
+    }
+
+    // The state of a bank is updated with selects rather than branches,
+    //  which the order of the commands of a trace makes unpredictable
+    for ( const TraceCommand& command : commands ) {
+        if ( command.bank >= banks.size() ) {
+            if ( command.bank >= maxBanks ) {
+                string exceptionMsgThrown("[ERROR] ");
+                exceptionMsgThrown.append("Trace file ");
+                exceptionMsgThrown.append(traceFileName);
+                exceptionMsgThrown.append(" uses bank ");
+                exceptionMsgThrown.append(to_string(command.bank));
+                exceptionMsgThrown.append(", but devices have at most ");
+                exceptionMsgThrown.append(to_string(maxBanks));
+                exceptionMsgThrown.append(" banks!\n");
+                throw exceptionMsgThrown;
+            }
+            BankActivity unusedBank = BankActivity();
+            BankState closedBank = { 0, 0 };
+            banks.resize(command.bank + 1, unusedBank);
+            bankStates.resize(command.bank + 1, closedBank);
+        }
+        BankActivity& bank = banks[command.bank];
+        BankState& state = bankStates[command.bank];
+        uint64_t cycle = command.cycle;
+
+        uint64_t wasOpen = state.isOpen;
+        uint64_t isOpen = nextOpenState[command.command][wasOpen];
+        bank.nCommands[command.command]++;
+        nCommands[command.command]++;
+
+        bank.openCycles += ( wasOpen & ~isOpen ) * (cycle - state.openSince);
+        state.openSince = ( isOpen & ~wasOpen ) ? cycle : state.openSince;
+        state.isOpen = isOpen;
+
+        uint64_t wasAnyOpen = ( nOpenBanks != 0 );
+        nOpenBanks += isOpen - wasOpen;
+        uint64_t isAnyOpen = ( nOpenBanks != 0 );
+        anyOpenCycles += ( wasAnyOpen & ~isAnyOpen )
+                         * (cycle - anyOpenSince);
+        anyOpenSince = ( isAnyOpen & ~wasAnyOpen ) ? cycle : anyOpenSince;
+    }
+    lastCycle = commands.back().cycle;
+}
+
+void
+TraceActivity::finish()
+{
+    for ( size_t bankID = 0; bankID < banks.size(); bankID++ ) {
+        if ( bankStates[bankID].isOpen ) {
+            banks[bankID].openCycles += lastCycle
+                                        - bankStates[bankID].openSince;
+            bankStates[bankID].isOpen = 0;
+        }
+    }
+    if ( nOpenBanks != 0 ) {
+        anyOpenCycles += lastCycle - anyOpenSince;
+        nOpenBanks = 0;
+    }
+}
+
+TraceEnergy::TraceEnergy(const TraceActivity& activity,
+                         const Current& dram,
+                         const TechnologyValues& technologyValues)
+{
+    if ( activity.banks.size() > technologyValues.nBanks ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Trace file ");
+        exceptionMsgThrown.append(activity.traceFileName);
+        exceptionMsgThrown.append(" uses bank ");
+        exceptionMsgThrown.append(to_string(activity.banks.size() - 1));
+        exceptionMsgThrown.append(", but the device has ");
+        exceptionMsgThrown.append(to_string((long) technologyValues.nBanks));
+        exceptionMsgThrown.append(" banks!\n");
+        throw exceptionMsgThrown;
+    }
+
+    // The energies of the commands and the background powers are the
+    //  ones of the workload profiles
+    WorkloadEnergies energies(dram, technologyValues);
+    double tck = 1000.0 / dram.dramFreq.value();
+
+    duration = ( activity.lastCycle - activity.firstCycle ) * tck;
+    refreshEnergy = activity.nCommands[TRACE_REF] * energies.refreshEnergy;
+    sharedBackgroundEnergy = energies.idlePower * duration
+                             + energies.sharedOpenPower
+                               * activity.anyOpenCycles * tck;
+    totalEnergy = sharedBackgroundEnergy + refreshEnergy;
+
+    banks.resize(activity.banks.size());
+    for ( size_t bankID = 0; bankID < banks.size(); bankID++ ) {
+        const TraceActivity::BankActivity& bankActivity
+                = activity.banks[bankID];
+        BankEnergy& bank = banks[bankID];
+        bank.activate = bankActivity.nCommands[TRACE_ACT]
+                        * energies.activateEnergy;
+        bank.read = bankActivity.nCommands[TRACE_RD]
+                    * energies.readBurstEnergy;
+        bank.write = bankActivity.nCommands[TRACE_WR]
+                     * energies.writeBurstEnergy;
+        bank.background = energies.openBankPower
+                          * bankActivity.openCycles * tck;
+        bank.total = bank.activate + bank.read + bank.write
+                     + bank.background;
+        totalEnergy += bank.total;
+    }
+
+    averagePower = ( duration > 0 ? totalEnergy / duration : 0 );
+}
+
+void
+TraceEnergy::appendReport(string& report,
+                          const TraceActivity& activity) const
+{
+    report.append("Trace energy of ");
+    report.append(activity.traceFileName);
+    report.append(" (");
+    for ( int command = 0; command < N_TRACE_COMMANDS; command++ ) {
+        report.append(command == 0 ? "" : ", ");
+        report.append(to_string(activity.nCommands[command]));
+        report.push_back(' ');
+        report.append(CommandTrace::commandNames[command]);
+    }
+    report.append(")\n");
+
+    BankEnergy allBanks = BankEnergy();
+    for ( const BankEnergy& bank : banks ) {
+        allBanks.activate += bank.activate;
+        allBanks.read += bank.read;
+        allBanks.write += bank.write;
+        allBanks.background += bank.background;
+    }
+
+    appendReportLine(report, "Trace duration       [ns]", duration);
+    appendReportLine(report, "Total energy         [nJ]", totalEnergy / 1e3);
+    appendReportLine(report, "Average power        [mW]", averagePower);
+    appendReportLine(report, "ACT energy           [nJ]",
+                     allBanks.activate / 1e3);
+    appendReportLine(report, "RD energy            [nJ]", allBanks.read / 1e3);
+    appendReportLine(report, "WR energy            [nJ]",
+                     allBanks.write / 1e3);
+    appendReportLine(report, "REF energy           [nJ]",
+                     refreshEnergy / 1e3);
+    appendReportLine(report, "Background energy    [nJ]",
+                     (sharedBackgroundEnergy + allBanks.background) / 1e3);
+    // Energy caused by each bank, without the shared background and refresh
+    for ( size_t bankID = 0; bankID < banks.size(); bankID++ ) {
+        string bankLabel("Bank ");
+        bankLabel.append(to_string(bankID));
+        bankLabel.resize(21, ' ');
+        bankLabel.append("[nJ]");
+        appendReportLine(report, bankLabel, banks[bankID].total / 1e3);
+    }
+}
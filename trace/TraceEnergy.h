@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+// Energy of a DRAM command trace, from the currents and timings computed
+//  by DRAMSpec (IDD0, IDD2N, IDD3N, IDD4R/W, IDD5B, rho, tRC, tRAS, ...).
+// The trace is read once into the activity of its banks (commands and
+//  cycles with the bank open), which does not depend on the device. The
+//  activity is then priced for every configuration of a run, with the
+//  energies of the workload profiles (WorkloadEnergies):
+//  - ACT (with its PRE), RD and WR bursts, and REF: their energy per
+//    command
+//  - background: IDD2N all along, plus (IDD3N - IDD2N) while banks are
+//    open, split with rho into a part shared by all banks (paid while any
+//    bank is open) and a part of each open bank, as in:
+//    Jung, M. et al, "A New Bank Sensitive DRAMPower Model for Efficient
+//    Design Space Exploration", 2016
+#ifndef TRACEENERGY_H
+#define TRACEENERGY_H
+
+#include "CommandTrace.h"
+#include "../core/Current.h"
+#include "../workload/WorkloadPower.h"
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+using namespace std;
+
+class TraceActivity
+{
+  public:
+    TraceActivity();
+
+    // Reads a whole trace. Throws if it cannot be read.
+    void read(const string& traceFileName);
+
+    // Applies commands, which follow the ones already applied. Throws if
+    //  a command uses a bank above maxBanks.
+    void add(const vector<TraceCommand>& commands);
+    // Closes the banks still open at the end of the trace
+    void finish();
+
+    struct BankActivity {
+        uint64_t nCommands[N_TRACE_COMMANDS];
+        // Cycles with the bank open (from ACT to PRE)
+        uint64_t openCycles;
+    };
+    // Banks up to the highest one of the trace. The devices of the run are
+    //  not known when the trace is read, so the banks are only bounded by
+    //  maxBanks, above any device, and checked against each device later.
+    static const uint32_t maxBanks = 65536;
+    vector<BankActivity> banks;
+    uint64_t nCommands[N_TRACE_COMMANDS];
+    // Cycles with at least one bank open
+    uint64_t anyOpenCycles;
+    uint64_t firstCycle;
+    uint64_t lastCycle;
+    string traceFileName;
+
+  private:
+    struct BankState {
+        uint64_t openSince;
+        uint64_t isOpen;
+    };
+    vector<BankState> bankStates;
+    uint64_t nOpenBanks;
+    uint64_t anyOpenSince;
+};
+
+class TraceEnergy
+{
+  public:
+    // Throws if the trace uses banks that the device does not have
+    TraceEnergy(const TraceActivity& activity,
+                const Current& dram,
+                const TechnologyValues& technologyValues);
+
+    // Energies in pJ
+    struct BankEnergy {
+        double activate;
+        double read;
+        double write;
+        // Background energy of the bank while it is open
+        double background;
+        double total;
+    };
+    vector<BankEnergy> banks;
+    // Background energy that no bank causes on its own
+    double sharedBackgroundEnergy;
+    double refreshEnergy;
+    double totalEnergy;
+    // Time of the trace in ns, and average power in mW (pJ/ns)
+    double duration;
+    double averagePower;
+
+    // Appends the energies as lines of a result table
+    void appendReport(string& report, const TraceActivity& activity) const;
+};
+
+#endif // TRACEENERGY_H
@@ -49,3 +49,22 @@
 #include "unit_tests/ChannelTest.cpp"
 #include "unit_tests/TimingTest.cpp"
 #include "unit_tests/CurrentTest.cpp"
+#include "unit_tests/ResultCacheTest.cpp"
+#include "unit_tests/JSONDocumentCacheTest.cpp"
+#include "unit_tests/ParameterSweepTest.cpp"
+#include "unit_tests/StreamProcessorTest.cpp"
+#include "unit_tests/MappedFileTest.cpp"
+#include "unit_tests/ColumnarResultTest.cpp"
+#include "unit_tests/NumberFormatTest.cpp"
+#include "unit_tests/ShardManifestTest.cpp"
+#include "unit_tests/RunCheckpointTest.cpp"
+#include "unit_tests/RunProgressTest.cpp"
+#include "unit_tests/TraceEnergyTest.cpp"
+#include "unit_tests/TimingCheckerTest.cpp"
+#include "unit_tests/WorkloadPowerTest.cpp"
+#include "unit_tests/SpeedBinTableTest.cpp"
+#include "unit_tests/VoltageSweepTest.cpp"
+#include "unit_tests/TemperatureSweepTest.cpp"
+#include "unit_tests/ProcessCornerTableTest.cpp"
+#include "unit_tests/TemperatureProfileTest.cpp"
+#include "unit_tests/SelfHeatingTest.cpp"
@@ -76,6 +76,58 @@ BOOST_AUTO_TEST_CASE( checkInputParametersParser_wrong_first_flag )
               "(Include IO termination currents for read and write operations.)\n"
             "    -internaltimings                      "
               "(Enable print out of internal timings.)\n"
+            "    -cache <path/to/cachedirectory>       "
+              "(Reuse results stored in a persistent cache directory.)\n"
+            "    -columnar <path/to/resultfile>        "
+              "(Write all results to a single binary columnar file.)\n"
+            "    -pretty                               "
+              "(Indent the JSON result files.)\n"
+            "    -notable                              "
+              "(Do not print the result table of every configuration.)\n"
+            "    -set \"<Key>=<value>\"                  "
+              "(Override an input value, e.g. -set \"Temperature[C]=90\".)\n"
+            "    -threads <number>                     "
+              "(Number of configurations evaluated in parallel.)\n"
+            "    -stream                               "
+              "(Read JSON configurations from stdin, write results to stdout.)\n"
+            "    -unordered                            "
+              "(With -stream, write results as soon as they are ready.)\n"
+            "    --shard <i/N>                         "
+              "(Evaluate only the i-th of N shares of the configurations.)\n"
+            "    -checkpoint <path/to/checkpointfile>  "
+              "(Save the progress of the run periodically.)\n"
+            "    --resume                              "
+              "(Go on from the checkpoint, skipping the results written.)\n"
+            "    -progress                             "
+              "(Report the progress of the run on stderr periodically.)\n"
+            "    -status <path/to/statusfile>          "
+              "(Write the progress of the run to a JSON status file.)\n"
+            "    -metrics <port>                       "
+              "(Serve Prometheus metrics on http://127.0.0.1:<port>/metrics.)\n"
+            "    -energytrace <path/to/tracefile>      "
+              "(Report the energy of a DRAM command trace.)\n"
+            "    -checktrace <path/to/tracefile>       "
+              "(Check a DRAM command trace against the timings.)\n"
+            "    -checksummary                         "
+              "(Only count the timing violations, without listing them.)\n"
+            "    -workloads <path/to/profilefile.csv>  "
+              "(Estimate the power of workload profiles.)\n"
+            "    -thermal <C/W>,<ambient C>            "
+              "(Solve the temperature each workload heats the device to.)\n"
+            "    -speedbins <MHz,MHz,...>              "
+              "(Write the clock-cycle timings at every listed frequency.)\n"
+            "    -voltages <Vdd:Vpp,Vdd:Vpp,...>       "
+              "(Write the latencies and energies at every listed Vdd and Vpp.)\n"
+            "    -temperaturesweep <C,C,...>           "
+              "(Write the array latencies at every listed temperature.)\n"
+            "    -corners                              "
+              "(Write the timings and currents at every process corner.)\n"
+            "    -temperatures <path/to/templog.csv>   "
+              "(Evaluate refresh and background power over a temperature log.)\n"
+            "    --pairs-from <path/to/pairsfile|->    "
+              "(Read technology/architecture file pairs, one pair per line.)\n"
+            "    @<path/to/listfile>                   "
+              "(Read further arguments from a file, one per line.)\n"
             "For more information, see README.md.\n";
 
     string expectedMsg("[ERROR] ");
@@ -118,6 +170,58 @@ BOOST_AUTO_TEST_CASE( checkInputParametersParser_wrong_second_flag1 )
               "(Include IO termination currents for read and write operations.)\n"
             "    -internaltimings                      "
               "(Enable print out of internal timings.)\n"
+            "    -cache <path/to/cachedirectory>       "
+              "(Reuse results stored in a persistent cache directory.)\n"
+            "    -columnar <path/to/resultfile>        "
+              "(Write all results to a single binary columnar file.)\n"
+            "    -pretty                               "
+              "(Indent the JSON result files.)\n"
+            "    -notable                              "
+              "(Do not print the result table of every configuration.)\n"
+            "    -set \"<Key>=<value>\"                  "
+              "(Override an input value, e.g. -set \"Temperature[C]=90\".)\n"
+            "    -threads <number>                     "
+              "(Number of configurations evaluated in parallel.)\n"
+            "    -stream                               "
+              "(Read JSON configurations from stdin, write results to stdout.)\n"
+            "    -unordered                            "
+              "(With -stream, write results as soon as they are ready.)\n"
+            "    --shard <i/N>                         "
+              "(Evaluate only the i-th of N shares of the configurations.)\n"
+            "    -checkpoint <path/to/checkpointfile>  "
+              "(Save the progress of the run periodically.)\n"
+            "    --resume                              "
+              "(Go on from the checkpoint, skipping the results written.)\n"
+            "    -progress                             "
+              "(Report the progress of the run on stderr periodically.)\n"
+            "    -status <path/to/statusfile>          "
+              "(Write the progress of the run to a JSON status file.)\n"
+            "    -metrics <port>                       "
+              "(Serve Prometheus metrics on http://127.0.0.1:<port>/metrics.)\n"
+            "    -energytrace <path/to/tracefile>      "
+              "(Report the energy of a DRAM command trace.)\n"
+            "    -checktrace <path/to/tracefile>       "
+              "(Check a DRAM command trace against the timings.)\n"
+            "    -checksummary                         "
+              "(Only count the timing violations, without listing them.)\n"
+            "    -workloads <path/to/profilefile.csv>  "
+              "(Estimate the power of workload profiles.)\n"
+            "    -thermal <C/W>,<ambient C>            "
+              "(Solve the temperature each workload heats the device to.)\n"
+            "    -speedbins <MHz,MHz,...>              "
+              "(Write the clock-cycle timings at every listed frequency.)\n"
+            "    -voltages <Vdd:Vpp,Vdd:Vpp,...>       "
+              "(Write the latencies and energies at every listed Vdd and Vpp.)\n"
+            "    -temperaturesweep <C,C,...>           "
+              "(Write the array latencies at every listed temperature.)\n"
+            "    -corners                              "
+              "(Write the timings and currents at every process corner.)\n"
+            "    -temperatures <path/to/templog.csv>   "
+              "(Evaluate refresh and background power over a temperature log.)\n"
+            "    --pairs-from <path/to/pairsfile|->    "
+              "(Read technology/architecture file pairs, one pair per line.)\n"
+            "    @<path/to/listfile>                   "
+              "(Read further arguments from a file, one per line.)\n"
             "For more information, see README.md.\n";
 
     string expectedMsg("[ERROR] ");
@@ -160,6 +264,58 @@ BOOST_AUTO_TEST_CASE( checkInputParametersParser_wrong_second_flag2 )
               "(Include IO termination currents for read and write operations.)\n"
             "    -internaltimings                      "
               "(Enable print out of internal timings.)\n"
+            "    -cache <path/to/cachedirectory>       "
+              "(Reuse results stored in a persistent cache directory.)\n"
+            "    -columnar <path/to/resultfile>        "
+              "(Write all results to a single binary columnar file.)\n"
+            "    -pretty                               "
+              "(Indent the JSON result files.)\n"
+            "    -notable                              "
+              "(Do not print the result table of every configuration.)\n"
+            "    -set \"<Key>=<value>\"                  "
+              "(Override an input value, e.g. -set \"Temperature[C]=90\".)\n"
+            "    -threads <number>                     "
+              "(Number of configurations evaluated in parallel.)\n"
+            "    -stream                               "
+              "(Read JSON configurations from stdin, write results to stdout.)\n"
+            "    -unordered                            "
+              "(With -stream, write results as soon as they are ready.)\n"
+            "    --shard <i/N>                         "
+              "(Evaluate only the i-th of N shares of the configurations.)\n"
+            "    -checkpoint <path/to/checkpointfile>  "
+              "(Save the progress of the run periodically.)\n"
+            "    --resume                              "
+              "(Go on from the checkpoint, skipping the results written.)\n"
+            "    -progress                             "
+              "(Report the progress of the run on stderr periodically.)\n"
+            "    -status <path/to/statusfile>          "
+              "(Write the progress of the run to a JSON status file.)\n"
+            "    -metrics <port>                       "
+              "(Serve Prometheus metrics on http://127.0.0.1:<port>/metrics.)\n"
+            "    -energytrace <path/to/tracefile>      "
+              "(Report the energy of a DRAM command trace.)\n"
+            "    -checktrace <path/to/tracefile>       "
+              "(Check a DRAM command trace against the timings.)\n"
+            "    -checksummary                         "
+              "(Only count the timing violations, without listing them.)\n"
+            "    -workloads <path/to/profilefile.csv>  "
+              "(Estimate the power of workload profiles.)\n"
+            "    -thermal <C/W>,<ambient C>            "
+              "(Solve the temperature each workload heats the device to.)\n"
+            "    -speedbins <MHz,MHz,...>              "
+              "(Write the clock-cycle timings at every listed frequency.)\n"
+            "    -voltages <Vdd:Vpp,Vdd:Vpp,...>       "
+              "(Write the latencies and energies at every listed Vdd and Vpp.)\n"
+            "    -temperaturesweep <C,C,...>           "
+              "(Write the array latencies at every listed temperature.)\n"
+            "    -corners                              "
+              "(Write the timings and currents at every process corner.)\n"
+            "    -temperatures <path/to/templog.csv>   "
+              "(Evaluate refresh and background power over a temperature log.)\n"
+            "    --pairs-from <path/to/pairsfile|->    "
+              "(Read technology/architecture file pairs, one pair per line.)\n"
+            "    @<path/to/listfile>                   "
+              "(Read further arguments from a file, one per line.)\n"
             "For more information, see README.md.\n";
 
     string expectedMsg("[ERROR] ");
@@ -603,6 +759,1199 @@ BOOST_AUTO_TEST_CASE( checkInputParametersParser_flags_4 )
 }
 
 
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_cache )
+{
+    int sim_argc = 7;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-cache",
+                        "result_cache",
+                        "-p",
+                        "architecture_input/test_architecture.json"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE( inputFileName.cacheDirectory == "result_cache",
+                        "Cache directory different from what was expected."
+                        << "\nExpected: " << "result_cache"
+                        << "\nGot: " << inputFileName.cacheDirectory);
+
+    BOOST_CHECK_MESSAGE( inputFileName.nConfigurations == 1,
+                        "Number of configurations different from what was expected."
+                        << "\nExpected: " << 1
+                        << "\nGot: " << inputFileName.nConfigurations);
+
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_columnar )
+{
+    int sim_argc = 7;
+    char* sim_argv[] = {"./executable",
+                        "-columnar",
+                        "results.col",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE( inputFileName.columnarFileName == "results.col",
+                        "Columnar file name different from what was expected."
+                        << "\nExpected: " << "results.col"
+                        << "\nGot: " << inputFileName.columnarFileName);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_pretty )
+{
+    int sim_argc = 6;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-pretty",
+                        "-p",
+                        "architecture_input/test_architecture.json"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE( inputFileName.prettyJSONFlag,
+                        "Pretty flag different from what was expected.");
+    BOOST_CHECK_MESSAGE( inputFileName.printResultTable,
+                        "Table flag different from what was expected.");
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_notable )
+{
+    int sim_argc = 6;
+    char* sim_argv[] = {"./executable",
+                        "-notable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE( inputFileName.printResultTable == false,
+                        "Table flag different from what was expected.");
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_cache_missing_value )
+{
+    int sim_argc = 6;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-cache"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("[ERROR] ");
+    expectedMsg.append("Missing value for flag \'-cache\'\n");
+    expectedMsg.append(inputFileName.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_set )
+{
+    int sim_argc = 9;
+    char* sim_argv[] = {"./executable",
+                        "-set",
+                        "Frequency[MHz]=1066",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-set",
+                        "Temperature[C]=90"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_REQUIRE_MESSAGE( inputFileName.parameterOverrides.size() == 2,
+                        "Number of overrides different from what was expected."
+                        << "\nExpected: " << 2
+                        << "\nGot: " << inputFileName.parameterOverrides.size());
+
+    BOOST_CHECK_MESSAGE( inputFileName.parameterOverrides[0] == "Frequency[MHz]=1066",
+                        "First override different from what was expected."
+                        << "\nExpected: " << "Frequency[MHz]=1066"
+                        << "\nGot: " << inputFileName.parameterOverrides[0]);
+
+    BOOST_CHECK_MESSAGE( inputFileName.parameterOverrides[1] == "Temperature[C]=90",
+                        "Second override different from what was expected."
+                        << "\nExpected: " << "Temperature[C]=90"
+                        << "\nGot: " << inputFileName.parameterOverrides[1]);
+
+    BOOST_CHECK_MESSAGE( inputFileName.nConfigurations == 1,
+                        "Number of configurations different from what was expected."
+                        << "\nExpected: " << 1
+                        << "\nGot: " << inputFileName.nConfigurations);
+
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_threads )
+{
+    int sim_argc = 7;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-threads",
+                        "4"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE( inputFileName.nThreads == 4,
+                        "Number of threads different from what was expected."
+                        << "\nExpected: " << 4
+                        << "\nGot: " << inputFileName.nThreads);
+
+    sim_argv[6] = "zero";
+    ArgumentsParser badInputFileName(sim_argc, sim_argv);
+    exceptionMsg = "Empty";
+    try {
+        badInputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] ";
+    expectedMsg.append("Invalid value for flag \'-threads\': zero\n");
+    expectedMsg.append(badInputFileName.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_shard )
+{
+    int sim_argc = 7;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "--shard",
+                        "2/3"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE( inputFileName.shardID == 2
+                         && inputFileName.nShards == 3,
+                        "Shard different from what was expected."
+                        << "\nExpected: " << "2/3"
+                        << "\nGot: " << inputFileName.shardID
+                        << "/" << inputFileName.nShards);
+
+    const char* badShards[] = {"4/3", "0/3", "2", "2/", "a/3"};
+    for ( const char* badShard : badShards ) {
+        sim_argv[6] = const_cast<char*>(badShard);
+        ArgumentsParser badInputFileName(sim_argc, sim_argv);
+        exceptionMsg = "Empty";
+        try {
+            badInputFileName.runArgParser();
+        }catch (string exceptionMsgThrown){
+            exceptionMsg = exceptionMsgThrown;
+        }
+
+        expectedMsg = "[ERROR] ";
+        expectedMsg.append("Invalid value for flag '--shard': ");
+        expectedMsg.append(badShard);
+        expectedMsg.append("\n");
+        expectedMsg.append(badInputFileName.helpMessage);
+        BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                            "Error message different from what was expected."
+                            << "\nExpected: " << expectedMsg
+                            << "\nGot: " << exceptionMsg);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_checkpoint )
+{
+    int sim_argc = 8;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-checkpoint",
+                        "run.checkpoint",
+                        "--resume"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE( inputFileName.checkpointFileName == "run.checkpoint"
+                         && inputFileName.isResumed,
+                        "Checkpoint flags different from what was expected.");
+
+    // Resuming needs the checkpoint file
+    int bad_argc = 6;
+    char* bad_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "--resume"};
+    ArgumentsParser badInputFileName(bad_argc, bad_argv);
+    exceptionMsg = "Empty";
+    try {
+        badInputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] ";
+    expectedMsg.append("--resume needs a checkpoint file ");
+    expectedMsg.append("(-checkpoint <path/to/checkpointfile>)!\n");
+    expectedMsg.append(badInputFileName.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_energytrace )
+{
+    int sim_argc = 7;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-energytrace",
+                        "commands.trace"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE( inputFileName.energyTraceFileName == "commands.trace",
+                        "Trace file different from what was expected.");
+
+    // The trace energy is reported in the result tables of batch runs only
+    int bad_argc = 4;
+    char* bad_argv[] = {"./executable",
+                        "-stream",
+                        "-energytrace",
+                        "commands.trace"};
+    ArgumentsParser badInputFileName(bad_argc, bad_argv);
+    exceptionMsg = "Empty";
+    try {
+        badInputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] ";
+    expectedMsg.append("-energytrace cannot be given together with -stream!\n");
+    expectedMsg.append(badInputFileName.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_checktrace )
+{
+    int sim_argc = 8;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-checktrace",
+                        "commands.trace",
+                        "-checksummary"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE( inputFileName.checkTraceFileName == "commands.trace"
+                         && inputFileName.checkSummaryFlag,
+                        "Trace check flags different from what was expected.");
+
+    // The summary is the one of a checked trace
+    int bad_argc = 6;
+    char* bad_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-checksummary"};
+    ArgumentsParser badInputFileName(bad_argc, bad_argv);
+    exceptionMsg = "Empty";
+    try {
+        badInputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] ";
+    expectedMsg.append("-checksummary needs a trace file ");
+    expectedMsg.append("(-checktrace <path/to/tracefile>)!\n");
+    expectedMsg.append(badInputFileName.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_workloads )
+{
+    int sim_argc = 7;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-workloads",
+                        "profiles.csv"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE( inputFileName.workloadFileName == "profiles.csv",
+                        "Workload file different from what was expected.");
+
+    int bad_argc = 4;
+    char* bad_argv[] = {"./executable",
+                        "-stream",
+                        "-workloads",
+                        "profiles.csv"};
+    ArgumentsParser badInputFileName(bad_argc, bad_argv);
+    exceptionMsg = "Empty";
+    try {
+        badInputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] ";
+    expectedMsg.append("-workloads cannot be given together with -stream!\n");
+    expectedMsg.append(badInputFileName.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_speedbins )
+{
+    int sim_argc = 7;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-speedbins",
+                        "800,1066.5,1600"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    vector<double> expectedFrequencies = {800, 1066.5, 1600};
+    BOOST_CHECK_MESSAGE( inputFileName.speedBinFrequencies
+                         == expectedFrequencies,
+                        "Frequencies different from what was expected.");
+
+    int bad_argc = 7;
+    char* bad_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-speedbins",
+                        "800,,1600"};
+    ArgumentsParser badInputFileName(bad_argc, bad_argv);
+    exceptionMsg = "Empty";
+    try {
+        badInputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] ";
+    expectedMsg.append("Invalid value for flag \'-speedbins\': 800,,1600\n");
+    expectedMsg.append(badInputFileName.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_voltages )
+{
+    int sim_argc = 7;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-voltages",
+                        "1.2:2.5,1.1:2.4,1.05:2.5"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    vector<double> expectedVdds = {1.2, 1.1, 1.05};
+    vector<double> expectedVpps = {2.5, 2.4, 2.5};
+    BOOST_CHECK_MESSAGE( inputFileName.voltageSweepVdds == expectedVdds
+                         && inputFileName.voltageSweepVpps == expectedVpps,
+                        "Voltages different from what was expected.");
+
+    int bad_argc = 7;
+    char* bad_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-voltages",
+                        "1.2:2.5,1.1"};
+    ArgumentsParser badInputFileName(bad_argc, bad_argv);
+    exceptionMsg = "Empty";
+    try {
+        badInputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] ";
+    expectedMsg.append("Invalid value for flag \'-voltages\': 1.2:2.5,1.1\n");
+    expectedMsg.append(badInputFileName.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_temperaturesweep )
+{
+    int sim_argc = 7;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-temperaturesweep",
+                        "25,85,94.5"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    vector<double> expectedTemperatures = {25, 85, 94.5};
+    BOOST_CHECK_MESSAGE( inputFileName.temperatureSweepPoints
+                         == expectedTemperatures,
+                        "Temperatures different from what was expected.");
+
+    int bad_argc = 7;
+    char* bad_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-temperaturesweep",
+                        "25,95"};
+    ArgumentsParser badInputFileName(bad_argc, bad_argv);
+    exceptionMsg = "Empty";
+    try {
+        badInputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] ";
+    expectedMsg.append("Invalid value for flag \'-temperaturesweep\': 25,95\n");
+    expectedMsg.append(badInputFileName.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_corners )
+{
+    int sim_argc = 6;
+    char* sim_argv[] = {"./executable",
+                        "-corners",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE( inputFileName.cornersFlag == true,
+                        "Corners flag different from what was expected.");
+
+    int bad_argc = 3;
+    char* bad_argv[] = {"./executable",
+                        "-stream",
+                        "-corners"};
+    ArgumentsParser badInputFileName(bad_argc, bad_argv);
+    exceptionMsg = "Empty";
+    try {
+        badInputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] ";
+    expectedMsg.append("-corners cannot be given together with -stream!\n");
+    expectedMsg.append(badInputFileName.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_temperatures )
+{
+    int sim_argc = 7;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-temperatures",
+                        "thermal_log.csv"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE( inputFileName.temperatureLogFileName
+                         == "thermal_log.csv",
+                        "Temperature file different from what was expected.");
+
+    int bad_argc = 4;
+    char* bad_argv[] = {"./executable",
+                        "-stream",
+                        "-temperatures",
+                        "thermal_log.csv"};
+    ArgumentsParser badInputFileName(bad_argc, bad_argv);
+    exceptionMsg = "Empty";
+    try {
+        badInputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] ";
+    expectedMsg.append("-temperatures cannot be given together with -stream!\n");
+    expectedMsg.append(badInputFileName.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_thermal )
+{
+    int sim_argc = 9;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-workloads",
+                        "profiles.csv",
+                        "-thermal",
+                        "12.5,45"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK( inputFileName.thermalResistance == 12.5 );
+    BOOST_CHECK( inputFileName.ambientTemperature == 45 );
+
+    int bad_argc = 9;
+    char* bad_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-workloads",
+                        "profiles.csv",
+                        "-thermal",
+                        "12.5"};
+    ArgumentsParser badInputFileName(bad_argc, bad_argv);
+    exceptionMsg = "Empty";
+    try {
+        badInputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] ";
+    expectedMsg.append("Invalid value for flag \'-thermal\': 12.5\n");
+    expectedMsg.append(badInputFileName.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    int noWorkloads_argc = 7;
+    char* noWorkloads_argv[] = {"./executable",
+                                "-t",
+                                "technology_input/test_technology.json",
+                                "-p",
+                                "architecture_input/test_architecture.json",
+                                "-thermal",
+                                "12.5,45"};
+    ArgumentsParser noWorkloadsFileName(noWorkloads_argc, noWorkloads_argv);
+    exceptionMsg = "Empty";
+    try {
+        noWorkloadsFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] ";
+    expectedMsg.append("-thermal needs workload profiles ");
+    expectedMsg.append("(-workloads <path/to/profilefile.csv>)!\n");
+    expectedMsg.append(noWorkloadsFileName.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_progress )
+{
+    int sim_argc = 12;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-progress",
+                        "-status",
+                        "run_status.json",
+                        "-metrics",
+                        "9464",
+                        "-threads",
+                        "2"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE( inputFileName.progressFlag
+                         && inputFileName.statusFileName == "run_status.json"
+                         && inputFileName.metricsPort == 9464,
+                        "Progress flags different from what was expected.");
+
+    // The progress reports do not change the results of the run
+    vector<string> expectedArguments;
+    expectedArguments.push_back("-t");
+    expectedArguments.push_back("technology_input/test_technology.json");
+    expectedArguments.push_back("-p");
+    expectedArguments.push_back("architecture_input/test_architecture.json");
+    BOOST_CHECK( inputFileName.runArguments() == expectedArguments );
+
+    int bad_argc = 7;
+    char* bad_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-metrics",
+                        "70000"};
+    ArgumentsParser badInputFileName(bad_argc, bad_argv);
+    exceptionMsg = "Empty";
+    try {
+        badInputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] ";
+    expectedMsg.append("Invalid value for flag \'-metrics\': 70000\n");
+    expectedMsg.append(badInputFileName.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_stream )
+{
+    int sim_argc = 3;
+    char* sim_argv[] = {"./executable",
+                        "-stream",
+                        "-unordered"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE( inputFileName.streamMode
+                         && inputFileName.isUnorderedStream,
+                        "Stream flags different from what was expected.");
+
+    int bad_argc = 4;
+    char* bad_argv[] = {"./executable",
+                        "-stream",
+                        "-t",
+                        "technology_input/test_technology.json"};
+    ArgumentsParser badInputFileName(bad_argc, bad_argv);
+    exceptionMsg = "Empty";
+    try {
+        badInputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    expectedMsg = "[ERROR] ";
+    expectedMsg.append("Input files cannot be given together with -stream!\n");
+    expectedMsg.append(badInputFileName.helpMessage);
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_listfile )
+{
+    ofstream listFile("test_arguments_list.txt");
+    listFile << "# Test list file\n"
+             << "-t\n"
+             << "technology_input/test_technology.json\n"
+             << "  technology_input/techhmc_5x.json  \n"
+             << "\n"
+             << "-p\n"
+             << "architecture_input/test_architecture.json\n"
+             << "architecture_input/parhmc.json\n";
+    listFile.close();
+
+    int sim_argc = 3;
+    char* sim_argv[] = {"./executable",
+                        "@test_arguments_list.txt",
+                        "-term"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    remove("test_arguments_list.txt");
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_REQUIRE_MESSAGE( inputFileName.nConfigurations == 2,
+                        "Number of configurations different from what was expected."
+                        << "\nExpected: " << 2
+                        << "\nGot: " << inputFileName.nConfigurations);
+
+    BOOST_CHECK_MESSAGE( inputFileName.technologyFileName[1]
+                         == "technology_input/techhmc_5x.json",
+                        "\nTechnology file name missmatch!"
+                        << "\nExpected: " << "technology_input/techhmc_5x.json"
+                        << "\nGot: " << inputFileName.technologyFileName[1]);
+
+    BOOST_CHECK_MESSAGE( inputFileName.architectureFileName[1]
+                         == "architecture_input/parhmc.json",
+                        "\nArchitecture file name missmatch!"
+                        << "\nExpected: " << "architecture_input/parhmc.json"
+                        << "\nGot: " << inputFileName.architectureFileName[1]);
+
+    BOOST_CHECK_MESSAGE( inputFileName.IOTerminationCurrentFlag == true,
+                        "IO termination current flag different from what was expected."
+                        << "\nExpected: " << true
+                        << "\nGot: " << inputFileName.IOTerminationCurrentFlag);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_directory_and_glob )
+{
+    int sim_argc = 5;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input",
+                        "-p",
+                        "architecture_input/pa*.json"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    // Globs are usually expanded by the shell, but not in this test.
+    // There are 17 technology files and 11 "pa*" architecture files.
+    string expectedMsg("[ERROR] ");
+    expectedMsg.append("Number of technology files (17) is different from ");
+    expectedMsg.append("the number of archtecture files (11). Could not proceed.");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_REQUIRE_MESSAGE( inputFileName.technologyFileName.size() == 17,
+                        "Number of technology files different from what was expected."
+                        << "\nExpected: " << 17
+                        << "\nGot: " << inputFileName.technologyFileName.size());
+
+    // Directory files are sorted
+    BOOST_CHECK_MESSAGE( inputFileName.technologyFileName[0]
+                         == "technology_input/tech_22nm_ddr4_8G_512x16.json",
+                        "\nTechnology file name missmatch!"
+                        << "\nExpected: "
+                        << "technology_input/tech_22nm_ddr4_8G_512x16.json"
+                        << "\nGot: " << inputFileName.technologyFileName[0]);
+
+    BOOST_CHECK_MESSAGE( inputFileName.architectureFileName[0]
+                         == "architecture_input/par3D_custom_8x4Gbit_32ch.json",
+                        "\nArchitecture file name missmatch!"
+                        << "\nExpected: "
+                        << "architecture_input/par3D_custom_8x4Gbit_32ch.json"
+                        << "\nGot: " << inputFileName.architectureFileName[0]);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_pairs_from )
+{
+    ofstream pairsFile("test_pairs.txt");
+    pairsFile << "# technology architecture\n"
+              << "technology_input/test_technology.json "
+              << "architecture_input/test_architecture.json\n"
+              << "technology_input/techhmc_5x.json\tarchitecture_input/parhmc.json\n";
+    pairsFile.close();
+
+    int sim_argc = 5;
+    char* sim_argv[] = {"./executable",
+                        "--pairs-from",
+                        "test_pairs.txt",
+                        "-cache",
+                        "result_cache"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_REQUIRE_MESSAGE( inputFileName.nConfigurations == 2,
+                        "Number of configurations different from what was expected."
+                        << "\nExpected: " << 2
+                        << "\nGot: " << inputFileName.nConfigurations);
+
+    BOOST_CHECK_MESSAGE( inputFileName.architectureFileName[1]
+                         == "architecture_input/parhmc.json",
+                        "\nArchitecture file name missmatch!"
+                        << "\nExpected: " << "architecture_input/parhmc.json"
+                        << "\nGot: " << inputFileName.architectureFileName[1]);
+
+    // The same arguments with other pairs in the file are another run
+    pairsFile.open("test_pairs.txt");
+    pairsFile << "technology_input/techhmc_5x.json architecture_input/parhmc.json\n"
+              << "technology_input/test_technology.json "
+              << "architecture_input/test_architecture.json\n";
+    pairsFile.close();
+
+    ArgumentsParser swappedInputFileName(sim_argc, sim_argv);
+    exceptionMsg = "Empty";
+    try {
+        swappedInputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    BOOST_CHECK( exceptionMsg == "Empty" );
+    BOOST_CHECK( swappedInputFileName.runArguments()
+                 == inputFileName.runArguments() );
+    BOOST_CHECK( swappedInputFileName.filePairsHash()
+                 != inputFileName.filePairsHash() );
+
+    // A line with a single file name is an error
+    pairsFile.open("test_pairs.txt");
+    pairsFile << "technology_input/test_technology.json\n";
+    pairsFile.close();
+
+    ArgumentsParser badInputFileName(sim_argc, sim_argv);
+    exceptionMsg = "Empty";
+    try {
+        badInputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    remove("test_pairs.txt");
+
+    expectedMsg = "[ERROR] Line 1 of test_pairs.txt is not a pair of file "
+                  "names: technology_input/test_technology.json\n";
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif // ARGUMENTSPARSERTEST_CPP
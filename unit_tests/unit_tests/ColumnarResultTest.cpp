@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef COLUMNARRESULTTEST_CPP
+#define COLUMNARRESULTTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../parser/ColumnarResultWriter.h"
+#include "../../parser/ColumnarResultReader.h"
+
+BOOST_AUTO_TEST_SUITE( testColumnarResult )
+
+BOOST_AUTO_TEST_CASE( checkColumnarResult_round_trip )
+{
+  TechnologyValues techValues("technology_input/test_technology.json",
+                              "architecture_input/test_architecture.json");
+  Current dram(techValues, false);
+
+  // More rows than a chunk, to check reads across chunks
+  uint64_t nRows = ColumnarResultWriter::chunkSize + 10;
+  string fileName("columnar_result_test.col");
+  {
+    ColumnarResultWriter resultWriter(fileName);
+    for ( uint64_t row = 0; row < nRows; row++ ) {
+        dram.IDD0 = (double) row * drs::milliamperes;
+        resultWriter.append(row + 1, dram);
+    }
+    resultWriter.close();
+  }
+
+  ColumnarResultReader resultReader(fileName);
+  BOOST_CHECK( resultReader.nRows == nRows );
+  BOOST_CHECK( resultReader.chunks.size() == 2 );
+  BOOST_REQUIRE( resultReader.columns.size() > 1 );
+  BOOST_CHECK( resultReader.columns[0].name == "configuration" );
+  BOOST_CHECK( resultReader.columns[0].type == COLUMN_UINT64 );
+
+  int idd0Column = resultReader.findColumn("IDD0");
+  int trcColumn = resultReader.findColumn("trc");
+  BOOST_REQUIRE( idd0Column != -1 && trcColumn != -1 );
+  BOOST_CHECK( resultReader.findColumn("no_such_column") == -1 );
+
+  uint64_t lastRow = nRows - 1;
+  BOOST_CHECK( resultReader.uintValue(lastRow, 0) == nRows );
+  BOOST_CHECK( resultReader.value(lastRow, idd0Column) == lastRow );
+  BOOST_CHECK( resultReader.value(lastRow, trcColumn) == dram.trc.value() );
+
+  if ( ColumnarResultReader::isLittleEndianHost() ) {
+      const double* idd0Values = resultReader.float64Values(1, idd0Column);
+      BOOST_CHECK( idd0Values[9] == lastRow );
+  }
+
+  ostringstream csvText;
+  resultReader.writeCSV(csvText);
+  string header = csvText.str().substr(0, csvText.str().find('\n'));
+  BOOST_CHECK( header.find("configuration,dramFreq,") == 0 );
+
+  remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE( checkColumnarResult_bad_file )
+{
+  string exceptionMsg("Empty");
+  try {
+      ColumnarResultReader resultReader(
+                  "architecture_input/test_architecture.json");
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedMsg("[ERROR] Could not read "
+                     "architecture_input/test_architecture.json: "
+                     "it is not a DRAMSpec columnar result file!\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                      "Error message different from what was expected."
+                      << "\nExpected: " << expectedMsg
+                      << "\nGot: " << exceptionMsg);
+
+  // A file cut in the middle of a chunk
+  string fileName("columnar_result_test.col");
+  {
+    ColumnarResultWriter resultWriter(fileName);
+    resultWriter.append(1, Current());
+    resultWriter.close();
+  }
+  MappedFile resultFile(fileName);
+  ofstream truncatedFile(fileName + ".cut", ofstream::binary);
+  truncatedFile.write(resultFile.text, resultFile.length - 8);
+  truncatedFile.close();
+
+  exceptionMsg = "Empty";
+  try {
+      ColumnarResultReader resultReader(fileName + ".cut");
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  expectedMsg = "[ERROR] Could not read columnar_result_test.col.cut: "
+                "its last chunk is truncated!\n";
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                      "Error message different from what was expected."
+                      << "\nExpected: " << expectedMsg
+                      << "\nGot: " << exceptionMsg);
+
+  remove(fileName.c_str());
+  remove((fileName + ".cut").c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // COLUMNARRESULTTEST_CPP
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef JSONDOCUMENTCACHETEST_CPP
+#define JSONDOCUMENTCACHETEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../parser/JSONDocumentCache.h"
+#include "../../parser/TechnologyValues.h"
+
+BOOST_AUTO_TEST_SUITE( testJSONDocumentCache )
+
+BOOST_AUTO_TEST_CASE( checkJSONDocumentCache_merge_patch )
+{
+  // Examples from RFC 7386, Appendix A
+  const char* examples[][3] = {
+      {"{\"a\":\"b\"}", "{\"a\":\"c\"}", "{\"a\":\"c\"}"},
+      {"{\"a\":\"b\"}", "{\"b\":\"c\"}", "{\"a\":\"b\",\"b\":\"c\"}"},
+      {"{\"a\":\"b\"}", "{\"a\":null}", "{}"},
+      {"{\"a\":\"b\",\"b\":\"c\"}", "{\"a\":null}", "{\"b\":\"c\"}"},
+      {"{\"a\":[\"b\"]}", "{\"a\":\"c\"}", "{\"a\":\"c\"}"},
+      {"{\"a\":\"c\"}", "{\"a\":[\"b\"]}", "{\"a\":[\"b\"]}"},
+      {"{\"a\":{\"b\":\"c\"}}", "{\"a\":{\"b\":\"d\",\"c\":null}}",
+       "{\"a\":{\"b\":\"d\"}}"},
+      {"{\"a\":[{\"b\":\"c\"}]}", "{\"a\":[1]}", "{\"a\":[1]}"},
+      {"[\"a\",\"b\"]", "[\"c\",\"d\"]", "[\"c\",\"d\"]"},
+      {"{\"a\":\"b\"}", "[\"c\"]", "[\"c\"]"},
+      {"{\"a\":\"foo\"}", "null", "null"},
+      {"{\"a\":\"foo\"}", "\"bar\"", "\"bar\""},
+      {"{\"e\":null}", "{\"a\":1}", "{\"e\":null,\"a\":1}"},
+      {"[1,2]", "{\"a\":\"b\",\"c\":null}", "{\"a\":\"b\"}"},
+      {"{}", "{\"a\":{\"bb\":{\"ccc\":null}}}", "{\"a\":{\"bb\":{}}}"}
+  };
+
+  for ( auto& example : examples ) {
+      rapidjson::Document target, patch, expected;
+      target.Parse(example[0]);
+      patch.Parse(example[1]);
+      expected.Parse(example[2]);
+
+      JSONDocumentCache::mergePatch(target, patch, target.GetAllocator());
+
+      BOOST_CHECK_MESSAGE( target == expected,
+                          "Merge patch result different from what was expected."
+                          << "\nTarget: " << example[0]
+                          << "\nPatch: " << example[1]
+                          << "\nExpected: " << example[2]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE( checkJSONDocumentCache_extends )
+{
+  JSONDocumentCache::clear();
+  unsigned int nParsedFiles = JSONDocumentCache::nParsedFiles;
+
+  string exceptionMsg("Empty");
+  TechnologyValues baseValues, extendedValues;
+  try {
+      extendedValues = TechnologyValues(
+                          "technology_input/test_technology.json",
+                          "architecture_input/test_architecture_extends.json");
+      baseValues = TechnologyValues("technology_input/test_technology.json",
+                                    "architecture_input/test_architecture.json");
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedMsg("Empty");
+  if ( exceptionMsg != expectedMsg ) {
+      BOOST_FAIL( exceptionMsg );
+  }
+
+  // The base file is parsed once, the technology file at each load
+  BOOST_CHECK_MESSAGE( JSONDocumentCache::nParsedFiles == nParsedFiles + 4,
+                      "Number of parsed files different from what was expected."
+                      << "\nExpected: " << nParsedFiles + 4
+                      << "\nGot: " << JSONDocumentCache::nParsedFiles);
+
+  BOOST_CHECK_MESSAGE( extendedValues.dramFreq.value() == 1066,
+                      "Extended frequency different from what was expected."
+                      << "\nExpected: " << 1066
+                      << "\nGot: " << extendedValues.dramFreq.value());
+  BOOST_CHECK_MESSAGE( extendedValues.temperature.value() == 85,
+                      "Extended temperature different from what was expected."
+                      << "\nExpected: " << 85
+                      << "\nGot: " << extendedValues.temperature.value());
+
+  // Everything else comes from the base file
+  extendedValues.dramFreq = baseValues.dramFreq;
+  extendedValues.temperature = baseValues.temperature;
+  BOOST_CHECK_MESSAGE( extendedValues.canonicalValues()
+                       == baseValues.canonicalValues(),
+                      "Values not in the extending file differ from the base."
+                      << "\nExpected: " << baseValues.canonicalValues()
+                      << "\nGot: " << extendedValues.canonicalValues());
+}
+
+BOOST_AUTO_TEST_CASE( checkJSONDocumentCache_changed_base )
+{
+  JSONDocumentCache::clear();
+  ofstream baseFile("test_cache_base.json");
+  baseFile << "{\"a\": 1, \"b\": 2}";
+  baseFile.close();
+  ofstream extendingFile("test_cache_extending.json");
+  extendingFile << "{\"extends\": \"test_cache_base.json\", \"b\": 3}";
+  extendingFile.close();
+
+  rapidjson::Document jsonDocument;
+  JSONDocumentCache::load("test_cache_extending.json", "technology",
+                          jsonDocument);
+  BOOST_CHECK( jsonDocument["a"].GetInt() == 1 );
+  BOOST_CHECK( jsonDocument["b"].GetInt() == 3 );
+
+  // The base is read again once it changed
+  baseFile.open("test_cache_base.json", ofstream::trunc);
+  baseFile << "{\"a\": 10, \"b\": 2}";
+  baseFile.close();
+  rapidjson::Document changedDocument;
+  JSONDocumentCache::load("test_cache_extending.json", "technology",
+                          changedDocument);
+  BOOST_CHECK_MESSAGE( changedDocument["a"].GetInt() == 10,
+                      "Changed base file not read again.");
+  BOOST_CHECK( changedDocument["b"].GetInt() == 3 );
+
+  remove("test_cache_base.json");
+  remove("test_cache_extending.json");
+}
+
+BOOST_AUTO_TEST_CASE( checkJSONDocumentCache_bad_extends )
+{
+  string exceptionMsg("Empty");
+  try {
+      TechnologyValues techValues(
+                          "technology_input/test_technology.json",
+                          "architecture_input/test_architecture_bad_extends.json");
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedMsg("[ERROR] Could not open architecture file: "
+                     "architecture_input/no_such_base.json!\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                      "Error message different from what was expected."
+                      << "\nExpected: " << expectedMsg
+                      << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // JSONDOCUMENTCACHETEST_CPP
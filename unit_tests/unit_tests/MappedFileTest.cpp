@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef MAPPEDFILETEST_CPP
+#define MAPPEDFILETEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../utils/MappedFile.h"
+
+#include <fstream>
+#include <sstream>
+
+BOOST_AUTO_TEST_SUITE( testMappedFile )
+
+BOOST_AUTO_TEST_CASE( checkMappedFile_regular_file )
+{
+  string fileName("technology_input/test_technology.json");
+  ifstream inputFile(fileName);
+  stringstream expectedText;
+  expectedText << inputFile.rdbuf();
+
+  MappedFile mappedFile(fileName);
+  BOOST_REQUIRE( mappedFile.isOpen );
+  BOOST_CHECK( mappedFile.isMapped );
+  BOOST_CHECK_MESSAGE( string(mappedFile.text, mappedFile.length)
+                       == expectedText.str(),
+                      "Mapped file contents different from the file.");
+}
+
+BOOST_AUTO_TEST_CASE( checkMappedFile_fallback )
+{
+  // Empty files cannot be mapped, they are read as an empty buffer
+  string fileName("mapped_file_test_empty.json");
+  ofstream emptyFile(fileName, ofstream::trunc);
+  emptyFile.close();
+
+  MappedFile mappedFile(fileName);
+  BOOST_CHECK( mappedFile.isOpen );
+  BOOST_CHECK( mappedFile.isMapped == false );
+  BOOST_CHECK( mappedFile.length == 0 );
+  remove(fileName.c_str());
+
+  MappedFile missingFile("no_such_file.json");
+  BOOST_CHECK( missingFile.isOpen == false );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // MAPPEDFILETEST_CPP
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef NUMBERFORMATTEST_CPP
+#define NUMBERFORMATTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../utils/NumberFormat.h"
+
+#include <clocale>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+BOOST_AUTO_TEST_SUITE( testNumberFormat )
+
+BOOST_AUTO_TEST_CASE( checkNumberFormat_stream_text )
+{
+  // Same text as a default output stream
+  double values[] = {0.0, -0.0, 1.0, -2.5, 7812.5, 44.72751628801941,
+                     1e-9, 123456.7, 1234567.0, 3.0e300, 1.0 / 3.0,
+                     std::numeric_limits<double>::infinity(),
+                     std::numeric_limits<double>::denorm_min()};
+  for ( double value : values ) {
+      ostringstream expectedText;
+      expectedText << value;
+      char text[NUMBER_BUFFER_SIZE];
+      size_t length = formatNumber(value, text);
+      BOOST_CHECK_MESSAGE( string(text, length) == expectedText.str(),
+                          "Number text different from what was expected."
+                          << "\nExpected: " << expectedText.str()
+                          << "\nGot: " << string(text, length));
+  }
+
+  string str("IDD0,");
+  appendNumber(str, 61.25);
+  BOOST_CHECK( str == "IDD0,61.25" );
+}
+
+BOOST_AUTO_TEST_CASE( checkNumberFormat_shortest )
+{
+  double values[] = {0.1, 44.72751628801941, 1.0 / 3.0, 2.0 / 3.0 * 1e-12,
+                     std::numeric_limits<double>::max(),
+                     std::numeric_limits<double>::min()};
+  for ( double value : values ) {
+      char text[NUMBER_BUFFER_SIZE];
+      size_t length = formatShortestNumber(value, text);
+      BOOST_CHECK( strtod(text, NULL) == value );
+      BOOST_CHECK( length <= 24 );
+  }
+  char text[NUMBER_BUFFER_SIZE];
+  formatShortestNumber(0.1, text);
+  BOOST_CHECK( string(text) == "0.1" );
+}
+
+BOOST_AUTO_TEST_CASE( checkNumberFormat_locale )
+{
+  // Locales with a decimal comma do not change the text. The test needs
+  //  one of them to be installed.
+  const char* localeNames[] = {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8",
+                               "fr_FR.utf8", "pt_BR.UTF-8", "pt_BR.utf8"};
+  string previousLocale(setlocale(LC_NUMERIC, NULL));
+  bool isLocaleSet = false;
+  for ( const char* localeName : localeNames ) {
+      if ( setlocale(LC_NUMERIC, localeName) != NULL ) {
+          isLocaleSet = true;
+          break;
+      }
+  }
+  if ( isLocaleSet == false ) {
+      return;
+  }
+
+  char text[NUMBER_BUFFER_SIZE];
+  size_t length = formatNumber(-2.5, text);
+  string numberText(text, length);
+  size_t shortestLength = formatShortestNumber(0.1, text);
+  string shortestText(text, shortestLength);
+  setlocale(LC_NUMERIC, previousLocale.c_str());
+
+  BOOST_CHECK_MESSAGE( numberText == "-2.5",
+                      "Number text different from what was expected."
+                      << "\nGot: " << numberText);
+  BOOST_CHECK_MESSAGE( shortestText == "0.1",
+                      "Number text different from what was expected."
+                      << "\nGot: " << shortestText);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // NUMBERFORMATTEST_CPP
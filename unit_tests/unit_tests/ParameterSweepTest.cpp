@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef PARAMETERSWEEPTEST_CPP
+#define PARAMETERSWEEPTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../parser/ParameterSweep.h"
+
+BOOST_AUTO_TEST_SUITE( testParameterSweep )
+
+BOOST_AUTO_TEST_CASE( checkParameterSweep_product_space )
+{
+  rapidjson::Document techDocument, archDocument;
+  techDocument.Parse("{\"Vdd[V]\": {\"list\": [1.1, 1.2]}, \"Vpp[V]\": 2.5}");
+  archDocument.Parse("{\"Frequency[MHz]\": {\"range\": [800, 1200, 200]},"
+                     " \"DRAMType[-]\": \"DDR3\"}");
+
+  string exceptionMsg("Empty");
+  try {
+      ParameterSweep sweep(techDocument, archDocument);
+
+      BOOST_CHECK_MESSAGE( sweep.nPoints == 6,
+                          "Number of sweep points different from what was expected."
+                          << "\nExpected: " << 6
+                          << "\nGot: " << sweep.nPoints);
+
+      // The last swept member changes the fastest
+      sweep.setPoint(4);
+      BOOST_CHECK_MESSAGE( techDocument["Vdd[V]"].GetDouble() == 1.2,
+                          "Swept Vdd different from what was expected."
+                          << "\nExpected: " << 1.2
+                          << "\nGot: " << techDocument["Vdd[V]"].GetDouble());
+      BOOST_CHECK_MESSAGE( archDocument["Frequency[MHz]"].GetDouble() == 1000,
+                          "Swept frequency different from what was expected."
+                          << "\nExpected: " << 1000
+                          << "\nGot: "
+                          << archDocument["Frequency[MHz]"].GetDouble());
+      BOOST_CHECK_MESSAGE( techDocument["Vpp[V]"].GetDouble() == 2.5,
+                          "Member not swept was changed.");
+
+      string expectedDescription("Vdd[V]=1.2, Frequency[MHz]=1000");
+      BOOST_CHECK_MESSAGE( sweep.pointDescription(4) == expectedDescription,
+                          "Sweep point description different from what was expected."
+                          << "\nExpected: " << expectedDescription
+                          << "\nGot: " << sweep.pointDescription(4));
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedMsg("Empty");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                      "Error message different from what was expected."
+                      << "\nExpected: " << expectedMsg
+                      << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkParameterSweep_no_sweep )
+{
+  rapidjson::Document techDocument, archDocument;
+  techDocument.Parse("{\"Vdd[V]\": 1.1}");
+  archDocument.Parse("{\"Frequency[MHz]\": 800}");
+
+  ParameterSweep sweep(techDocument, archDocument);
+  BOOST_CHECK_MESSAGE( sweep.nPoints == 1,
+                      "Number of sweep points different from what was expected."
+                      << "\nExpected: " << 1
+                      << "\nGot: " << sweep.nPoints);
+  BOOST_CHECK_MESSAGE( sweep.pointDescription(0).empty(),
+                      "Sweep point description different from what was expected."
+                      << "\nExpected: " << ""
+                      << "\nGot: " << sweep.pointDescription(0));
+}
+
+BOOST_AUTO_TEST_CASE( checkParameterSweep_bad_range )
+{
+  rapidjson::Document techDocument, archDocument;
+  techDocument.Parse("{\"Vdd[V]\": 1.1}");
+  archDocument.Parse("{\"Frequency[MHz]\": {\"range\": [1200, 800, 200]}}");
+
+  string exceptionMsg("Empty");
+  try {
+      ParameterSweep sweep(techDocument, archDocument);
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedMsg("[ERROR] Sweep of member \"Frequency[MHz]\" "
+                     "is expected to have a positive step "
+                     "and first <= last!\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                      "Error message different from what was expected."
+                      << "\nExpected: " << expectedMsg
+                      << "\nGot: " << exceptionMsg);
+
+  // Misspelled members would give identical points
+  archDocument.Parse("{\"Frequency[Mhz]\": {\"list\": [800, 1066]}}");
+  exceptionMsg = "Empty";
+  try {
+      ParameterSweep sweep(techDocument, archDocument);
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  expectedMsg = "[ERROR] Sweep of member \"Frequency[Mhz]\" "
+                "does not match any input value!\n";
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                      "Error message different from what was expected."
+                      << "\nExpected: " << expectedMsg
+                      << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkParameterSweep_too_many_points )
+{
+  rapidjson::Document techDocument, archDocument;
+  techDocument.Parse("{\"Vdd[V]\": {\"range\": [0, 1e12, 1e-3]}}");
+  archDocument.Parse("{\"Frequency[MHz]\": 800}");
+
+  string exceptionMsg("Empty");
+  try {
+      ParameterSweep sweep(techDocument, archDocument);
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedMsg("[ERROR] Sweep of member \"Vdd[V]\" "
+                     "has more than 100000000 values!\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                      "Error message different from what was expected."
+                      << "\nExpected: " << expectedMsg
+                      << "\nGot: " << exceptionMsg);
+
+  // 70000 x 70000 points would wrap an unsigned int
+  techDocument.Parse("{\"Vdd[V]\": {\"range\": [1, 70000, 1]}}");
+  archDocument.Parse("{\"Frequency[MHz]\": {\"range\": [1, 70000, 1]}}");
+  exceptionMsg = "Empty";
+  try {
+      ParameterSweep sweep(techDocument, archDocument);
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  expectedMsg = "[ERROR] Sweep of member \"Frequency[MHz]\" "
+                "makes the sweep exceed 100000000 points!\n";
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                      "Error message different from what was expected."
+                      << "\nExpected: " << expectedMsg
+                      << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // PARAMETERSWEEPTEST_CPP
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef PROCESSCORNERTABLETEST_CPP
+#define PROCESSCORNERTABLETEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../core/ProcessCornerTable.h"
+
+BOOST_AUTO_TEST_SUITE( testProcessCornerTable )
+
+BOOST_AUTO_TEST_CASE( checkProcessCornerTable_read )
+{
+  TechnologyValues baseValues, cornerValues;
+  try {
+      baseValues = TechnologyValues("technology_input/test_technology.json",
+                                    "architecture_input/test_architecture.json");
+      cornerValues = TechnologyValues(
+                        "technology_input/test_technology_corners.json",
+                        "architecture_input/test_architecture.json");
+  }catch (string exceptionMsgThrown){
+      BOOST_FAIL( exceptionMsgThrown );
+  }
+
+  // Corners in the order of the file, missing multipliers are 1
+  BOOST_CHECK( baseValues.processCorners.empty() );
+  BOOST_REQUIRE( cornerValues.processCorners.size() == 3 );
+  BOOST_CHECK( cornerValues.processCorners[0].name == "SS" );
+  BOOST_CHECK( cornerValues.processCorners[0].resistanceFactor == 1.15 );
+  BOOST_CHECK( cornerValues.processCorners[0].capacitanceFactor == 1.05 );
+  BOOST_CHECK( cornerValues.processCorners[0].currentFactor == 0.85 );
+  BOOST_CHECK( cornerValues.processCorners[1].name == "TT" );
+  BOOST_CHECK( cornerValues.processCorners[1].resistanceFactor == 1 );
+  BOOST_CHECK( cornerValues.processCorners[1].capacitanceFactor == 1 );
+  BOOST_CHECK( cornerValues.processCorners[1].currentFactor == 1 );
+  BOOST_CHECK( cornerValues.processCorners[2].name == "FF" );
+
+  // The corners tell the configurations apart, the other values are equal
+  BOOST_CHECK( cornerValues.canonicalValues()
+               != baseValues.canonicalValues() );
+  cornerValues.processCorners.clear();
+  BOOST_CHECK_MESSAGE( cornerValues.canonicalValues()
+                       == baseValues.canonicalValues(),
+                      "Values without corners differ from the base."
+                      << "\nExpected: " << baseValues.canonicalValues()
+                      << "\nGot: " << cornerValues.canonicalValues());
+
+  rapidjson::Document badDocument;
+  badDocument.Parse("{\"ProcessCorners\": {\"SS\": {\"Current[-]\": -1}}}");
+  string exceptionMsg("Empty");
+  try {
+      baseValues.extractProcessCorners(badDocument);
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedMsg("[ERROR] Process corner \"SS\" in JSON document ");
+  expectedMsg.append(baseValues.techFileName);
+  expectedMsg.append(" is expected to hold positive multipliers ");
+  expectedMsg.append("\"Resistance[-]\", \"Capacitance[-]\" and ");
+  expectedMsg.append("\"Current[-]\"!\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                      "Error message different from what was expected."
+                      << "\nExpected: " << expectedMsg
+                      << "\nGot: " << exceptionMsg);
+
+  // A misspelled multiplier is not taken as 1
+  badDocument.Parse("{\"ProcessCorners\": "
+                    "{\"SS\": {\"Resistence[-]\": 1.15}}}");
+  exceptionMsg = "Empty";
+  try {
+      baseValues.extractProcessCorners(badDocument);
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  expectedMsg = "[ERROR] Process corner \"SS\" in JSON document ";
+  expectedMsg.append(baseValues.techFileName);
+  expectedMsg.append(" has unknown member \"Resistence[-]\"!\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                      "Error message different from what was expected."
+                      << "\nExpected: " << expectedMsg
+                      << "\nGot: " << exceptionMsg);
+}
+
+// Capacitances and currents are not used by the geometry, so a corner that
+//  only scales them must match a full evaluation with scaled inputs
+BOOST_AUTO_TEST_CASE( checkProcessCornerTable_full_evaluation )
+{
+  TechnologyValues techValues;
+  Current current;
+  try {
+      techValues = TechnologyValues(
+                      "technology_input/test_technology_corners.json",
+                      "architecture_input/test_architecture.json");
+      current = Current(techValues, false);
+  }catch (string exceptionMsgThrown){
+      BOOST_FAIL( exceptionMsgThrown );
+  }
+
+  ProcessCorner loadCorner = {"LOAD", 1, 1.1, 0.9};
+  current.processCorners.push_back(loadCorner);
+  ProcessCornerTable cornerTable(current);
+  BOOST_REQUIRE( cornerTable.corners.size() == 4 );
+
+  // The typical corner is the configuration itself
+  const ProcessCornerTable::CornerResult& typical = cornerTable.corners[1];
+  BOOST_CHECK( typical.corner.name == "TT" );
+  BOOST_CHECK( typical.trcd == current.trcd.value() );
+  BOOST_CHECK( typical.trc == current.trc.value() );
+  BOOST_CHECK( typical.trfc == current.trfc.value() );
+  BOOST_CHECK( typical.trcClocks == current.trc_clk.value() );
+  BOOST_CHECK( typical.idd0 == current.IDD0.value() );
+  BOOST_CHECK( typical.idd4r == current.IDD4R.value() );
+  BOOST_CHECK( typical.idd5b == current.IDD5b.value() );
+
+  TechnologyValues loadValues(techValues);
+  loadValues.wireCapacitance = 1.1*loadValues.wireCapacitance;
+  loadValues.capacitancePerCell = 1.1*loadValues.capacitancePerCell;
+  loadValues.capacitancePerBLCell = 1.1*loadValues.capacitancePerBLCell;
+  loadValues.capacitancePerWLCell = 1.1*loadValues.capacitancePerWLCell;
+  loadValues.CSLLoadCapacitance = 1.1*loadValues.CSLLoadCapacitance;
+  loadValues.Issa = 0.9*loadValues.Issa;
+  loadValues.idd2nFreqSlope = 0.9*loadValues.idd2nFreqSlope;
+  loadValues.idd2nTempAlpha = 0.9*loadValues.idd2nTempAlpha;
+  loadValues.idd2nOffset = 0.9*loadValues.idd2nOffset;
+  loadValues.IddOcdRcvSlope = 0.9*loadValues.IddOcdRcvSlope;
+  loadValues.fullySharedResourcesCurrent
+          = 0.9*loadValues.fullySharedResourcesCurrent;
+  loadValues.semiSharedResourcesCurrent
+          = 0.9*loadValues.semiSharedResourcesCurrent;
+  Current reference(loadValues, false);
+  // The leakage of an active bank is not an input value
+  reference.activeBankLeakage = 0.9*reference.activeBankLeakage;
+  reference.currentCompute();
+
+  const ProcessCornerTable::CornerResult& load = cornerTable.corners[3];
+  BOOST_CHECK_CLOSE( load.trcd, reference.trcd.value(), 1e-9 );
+  BOOST_CHECK_CLOSE( load.tcas, reference.tcas.value(), 1e-9 );
+  BOOST_CHECK_CLOSE( load.tras, reference.tras.value(), 1e-9 );
+  BOOST_CHECK_CLOSE( load.trp, reference.trp.value(), 1e-9 );
+  BOOST_CHECK_CLOSE( load.trc, reference.trc.value(), 1e-9 );
+  BOOST_CHECK_CLOSE( load.trfc, reference.trfc.value(), 1e-9 );
+  BOOST_CHECK( load.trcClocks == reference.trc_clk.value() );
+  BOOST_CHECK_CLOSE( load.idd0, reference.IDD0.value(), 1e-9 );
+  BOOST_CHECK_CLOSE( load.ipp0, reference.IPP0.value(), 1e-9 );
+  BOOST_CHECK_CLOSE( load.idd1, reference.IDD1.value(), 1e-9 );
+  BOOST_CHECK_CLOSE( load.idd2n, reference.IDD2n.value(), 1e-9 );
+  BOOST_CHECK_CLOSE( load.idd3n, reference.IDD3n.value(), 1e-9 );
+  BOOST_CHECK_CLOSE( load.idd4r, reference.IDD4R.value(), 1e-9 );
+  BOOST_CHECK_CLOSE( load.idd4w, reference.IDD4W.value(), 1e-9 );
+  BOOST_CHECK_CLOSE( load.idd5b, reference.IDD5b.value(), 1e-9 );
+
+  // Slow corners are slower than fast ones
+  BOOST_CHECK( cornerTable.corners[0].trcd > typical.trcd );
+  BOOST_CHECK( cornerTable.corners[2].trcd < typical.trcd );
+  BOOST_CHECK( cornerTable.corners[0].trc > cornerTable.corners[2].trc );
+}
+
+// The delays of the row precharge and of the column are RC products, so
+//  scaling the resistances and dividing the capacitances by the same factor
+//  keeps them. The global wordline also drives the fixed gate load of the
+//  subarrays, so tRCD and tRAS grow.
+BOOST_AUTO_TEST_CASE( checkProcessCornerTable_resistances )
+{
+  Current current("technology_input/test_technology_corners.json",
+                  "architecture_input/test_architecture.json",
+                  false);
+  current.processCorners.clear();
+  ProcessCorner rcCorner = {"RC", 1.25, 0.8, 1};
+  current.processCorners.push_back(rcCorner);
+  ProcessCornerTable cornerTable(current);
+  BOOST_CHECK_CLOSE( cornerTable.corners[0].tcas, current.tcas.value(), 1e-9 );
+  BOOST_CHECK_CLOSE( cornerTable.corners[0].trp, current.trp.value(), 1e-9 );
+  BOOST_CHECK( cornerTable.corners[0].trcd > current.trcd.value() );
+  BOOST_CHECK( cornerTable.corners[0].tras > current.tras.value() );
+
+  // A technology without corners cannot be evaluated with -corners
+  current.processCorners.clear();
+  string exceptionMsg("Empty");
+  try {
+      ProcessCornerTable emptyTable(current);
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedMsg("[ERROR] Technology file ");
+  expectedMsg.append(current.techFileName);
+  expectedMsg.append(" defines no process corners ");
+  expectedMsg.append("(member \"ProcessCorners\")!\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                      "Error message different from what was expected."
+                      << "\nExpected: " << expectedMsg
+                      << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // PROCESSCORNERTABLETEST_CPP
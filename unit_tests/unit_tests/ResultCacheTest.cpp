@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef RESULTCACHETEST_CPP
+#define RESULTCACHETEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../parser/ResultCache.h"
+
+BOOST_AUTO_TEST_SUITE( testResultCache )
+
+BOOST_AUTO_TEST_CASE( checkResultCache_store_and_load )
+{
+  string exceptionMsg("Empty");
+  TechnologyValues techValues;
+  try {
+      techValues = TechnologyValues("technology_input/test_technology.json",
+                                    "architecture_input/test_architecture.json");
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedMsg("Empty");
+  if ( exceptionMsg != expectedMsg ) {
+      BOOST_FAIL( exceptionMsg );
+  }
+
+  ResultCache resultCache("test_result_cache");
+  string key = resultCache.computeKey(techValues, true);
+
+  BOOST_CHECK_MESSAGE( key != resultCache.computeKey(techValues, false),
+                      "Cache key does not depend on the IO termination flag.");
+
+  TechnologyValues changedTechValues(techValues);
+  changedTechValues.dramFreq = 1600*drs::megahertz_clock;
+  BOOST_CHECK_MESSAGE( key != resultCache.computeKey(changedTechValues, true),
+                      "Cache key does not depend on the input values.");
+
+  changedTechValues = techValues;
+  changedTechValues.techFileName = "another_technology_file.json";
+  BOOST_CHECK_MESSAGE( key == resultCache.computeKey(changedTechValues, true),
+                      "Cache key depends on the input file names.");
+
+  Current computedCurrent(techValues, true);
+  resultCache.store(key, computedCurrent);
+
+  Current cachedCurrent;
+  BOOST_CHECK_MESSAGE( resultCache.load(key, cachedCurrent),
+                      "Stored cache entry could not be loaded.");
+
+#define CHECK_CACHED_FIELD(fieldName) \
+  BOOST_CHECK_MESSAGE( resultFieldValue(cachedCurrent.fieldName) \
+                       == resultFieldValue(computedCurrent.fieldName), \
+                      "Cached " #fieldName " different from the computed." \
+                      << "\nExpected: " << computedCurrent.fieldName \
+                      << "\nGot: " << cachedCurrent.fieldName);
+  DRAMSPEC_RESULT_FIELDS(CHECK_CACHED_FIELD)
+#undef CHECK_CACHED_FIELD
+
+  BOOST_CHECK_MESSAGE( cachedCurrent.warning == computedCurrent.warning,
+                      "Cached warning different from the computed."
+                      << "\nExpected: " << computedCurrent.warning
+                      << "\nGot: " << cachedCurrent.warning);
+
+  BOOST_CHECK_MESSAGE( resultCache.load("0000000000000000", cachedCurrent)
+                       == false,
+                      "Missing cache entry was loaded.");
+
+  BOOST_CHECK_MESSAGE( resultCache.nHits == 1 && resultCache.nMisses == 1,
+                      "Cache hits and misses different from the expected."
+                      << "\nExpected: " << 1 << " and " << 1
+                      << "\nGot: " << resultCache.nHits
+                      << " and " << resultCache.nMisses);
+
+  remove(("test_result_cache/" + key + ".json").c_str());
+  rmdir("test_result_cache");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // RESULTCACHETEST_CPP
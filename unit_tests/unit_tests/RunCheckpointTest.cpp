@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef RUNCHECKPOINTTEST_CPP
+#define RUNCHECKPOINTTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../parser/RunCheckpoint.h"
+
+#include <fstream>
+
+BOOST_AUTO_TEST_SUITE( testRunCheckpoint )
+
+BOOST_AUTO_TEST_CASE( checkRunCheckpoint_round_trip )
+{
+  RunCheckpoint checkpoint;
+  checkpoint.arguments.push_back("-t");
+  checkpoint.arguments.push_back("technology_input/test_technology.json");
+  checkpoint.filePairsHash = "0123456789abcdef";
+  checkpoint.writtenSweepsHash = "fedcba9876543210";
+  checkpoint.nWrittenConfigurations = 12;
+  checkpoint.nEvaluatedConfigurations = 7;
+  checkpoint.columnarFileSize = 5000000000ULL;
+  checkpoint.isComplete = false;
+
+  string fileName("run_checkpoint_test.json");
+  checkpoint.write(fileName);
+
+  RunCheckpoint readCheckpoint;
+  BOOST_CHECK( readCheckpoint.read(fileName) );
+  remove(fileName.c_str());
+
+  BOOST_CHECK( readCheckpoint.version == checkpoint.version );
+  BOOST_CHECK( readCheckpoint.arguments == checkpoint.arguments );
+  BOOST_CHECK( readCheckpoint.filePairsHash == "0123456789abcdef" );
+  BOOST_CHECK( readCheckpoint.writtenSweepsHash == "fedcba9876543210" );
+  BOOST_CHECK( readCheckpoint.nWrittenConfigurations == 12 );
+  BOOST_CHECK( readCheckpoint.nEvaluatedConfigurations == 7 );
+  BOOST_CHECK( readCheckpoint.columnarFileSize == 5000000000ULL );
+  BOOST_CHECK( readCheckpoint.isComplete == false );
+}
+
+BOOST_AUTO_TEST_CASE( checkRunCheckpoint_missing_file )
+{
+  RunCheckpoint checkpoint;
+  BOOST_CHECK( checkpoint.read("run_checkpoint_missing.json") == false );
+}
+
+BOOST_AUTO_TEST_CASE( checkRunCheckpoint_damaged_file )
+{
+  string fileName("run_checkpoint_test.json");
+  ofstream checkpointFile(fileName, ofstream::trunc);
+  checkpointFile << "{\"DRAMSpecVersion\": \"2.1.0\", \"written\": ";
+  checkpointFile.close();
+
+  string exceptionMsg("Empty");
+  try {
+      RunCheckpoint checkpoint;
+      checkpoint.read(fileName);
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  remove(fileName.c_str());
+
+  string expectedMsg("[ERROR] Checkpoint is damaged: "
+                     "run_checkpoint_test.json!\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                      "Error message different from what was expected."
+                      << "\nExpected: " << expectedMsg
+                      << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // RUNCHECKPOINTTEST_CPP
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef RUNPROGRESSTEST_CPP
+#define RUNPROGRESSTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../parser/RunProgress.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+BOOST_AUTO_TEST_SUITE( testRunProgress )
+
+BOOST_AUTO_TEST_CASE( checkRunProgress_counters )
+{
+  RunProgress progress;
+  // Two input file pairs, only the first one read so far
+  progress.setFiles(2);
+  progress.addFile(10);
+  progress.addDone(true);
+  progress.addDone();
+  progress.addDone();
+  progress.addError();
+  progress.addStageTime(RunProgress::STAGE_READ, chrono::milliseconds(300));
+  progress.addStageTime(RunProgress::STAGE_COMPUTE, chrono::milliseconds(700));
+  {
+      RunProgress::StageTimer writeTimer(&progress, RunProgress::STAGE_WRITE);
+      writeTimer.pause();
+  }
+  RunProgress::StageTimer unusedTimer(NULL, RunProgress::STAGE_WRITE);
+
+  string line = progress.progressLine();
+  BOOST_CHECK_MESSAGE( line.find("[PROGRESS] 3 of ~20 configurations (15.0%)")
+                       == 0, "Unexpected progress line: " << line );
+  BOOST_CHECK( line.find(", 1 errors, ") != string::npos );
+  BOOST_CHECK( line.find("time in read 30% compute 70% write 0%")
+               != string::npos );
+
+  string status = progress.statusJSON();
+  BOOST_CHECK( status.find("\"state\":\"running\"") != string::npos );
+  BOOST_CHECK( status.find("\"configurationsDone\":3") != string::npos );
+  BOOST_CHECK( status.find("\"configurationsPlanned\":20") != string::npos );
+  BOOST_CHECK( status.find("\"isPlannedEstimated\":true") != string::npos );
+
+  progress.addFile(5);
+  string metrics = progress.metricsText();
+  BOOST_CHECK( metrics.find("\ndramspec_configurations_done 3\n")
+               != string::npos );
+  BOOST_CHECK( metrics.find("\ndramspec_configurations_planned 15\n")
+               != string::npos );
+  BOOST_CHECK( metrics.find("\ndramspec_errors 1\n") != string::npos );
+  BOOST_CHECK( metrics.find("# TYPE dramspec_stage_seconds counter\n")
+               != string::npos );
+  BOOST_CHECK( metrics.find("\ndramspec_stage_seconds{stage=\"compute\"} 0.7\n")
+               != string::npos );
+}
+
+BOOST_AUTO_TEST_CASE( checkRunProgress_unknown_total )
+{
+  // A stream: the number of configurations is not known
+  RunProgress progress;
+  progress.addDone();
+
+  string line = progress.progressLine();
+  BOOST_CHECK_MESSAGE( line.find("[PROGRESS] 1 configurations, ") == 0,
+                       "Unexpected progress line: " << line );
+  BOOST_CHECK( line.find("ETA") == string::npos );
+  BOOST_CHECK( progress.statusJSON().find("\"configurationsPlanned\":null")
+               != string::npos );
+  BOOST_CHECK( progress.metricsText().find("dramspec_eta_seconds")
+               == string::npos );
+}
+
+BOOST_AUTO_TEST_CASE( checkRunProgress_metrics_server )
+{
+  MetricsServer server(0, []() { return string("dramspec_test 1\n"); });
+  BOOST_REQUIRE( server.port != 0 );
+
+  int connection = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_port = htons(server.port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  BOOST_REQUIRE( connect(connection, (sockaddr*) &address,
+                         sizeof(address)) == 0 );
+  string request("GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+  BOOST_REQUIRE( send(connection, request.data(), request.size(), 0)
+                 == (ssize_t) request.size() );
+
+  string response;
+  char buffer[1024];
+  ssize_t nRead;
+  while ( (nRead = recv(connection, buffer, sizeof(buffer), 0)) > 0 ) {
+      response.append(buffer, nRead);
+  }
+  close(connection);
+
+  BOOST_CHECK_MESSAGE( response.find("HTTP/1.0 200 OK\r\n") == 0,
+                       "Unexpected response: " << response );
+  BOOST_CHECK( response.find("Content-Type: text/plain; version=0.0.4\r\n")
+               != string::npos );
+  BOOST_CHECK( response.find("\r\n\r\ndramspec_test 1\n") != string::npos );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // RUNPROGRESSTEST_CPP
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef SELFHEATINGTEST_CPP
+#define SELFHEATINGTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../thermal/SelfHeating.h"
+
+#include <fstream>
+
+BOOST_AUTO_TEST_SUITE( testSelfHeating )
+
+WorkloadProfiles readTestProfiles()
+{
+  string fileName("self_heating_test.csv");
+  ofstream profileFile(fileName, ofstream::trunc);
+  profileFile << "name,activations[1/us],read[GB/s],write[GB/s],rowhit,idle\n"
+                 "idle,0,0,0,0,1\n"
+                 "mixed,20,1.2,0.4,0.5,0.25\n"
+                 "heavy,100,6,3,0.2,0\n";
+  profileFile.close();
+  WorkloadProfiles profiles;
+  profiles.read(fileName);
+  remove(fileName.c_str());
+  return profiles;
+}
+
+// Power of a profile from a full evaluation of the test device
+double fullPowerAt(const WorkloadProfiles& profiles, size_t profileID,
+                   double temperature)
+{
+  TechnologyValues techValues("technology_input/test_technology.json",
+                              "architecture_input/test_architecture.json");
+  techValues.temperature = temperature*bu::celsius::degrees;
+  Current current(techValues, false);
+  WorkloadPower power(profiles, current, current);
+  return power.totalPower[profileID];
+}
+
+BOOST_AUTO_TEST_CASE( checkSelfHeating_solutions )
+{
+  WorkloadProfiles profiles = readTestProfiles();
+  Current current;
+  try {
+      current = Current("technology_input/test_technology.json",
+                        "architecture_input/test_architecture.json",
+                        false);
+  }catch (string exceptionMsgThrown){
+      BOOST_FAIL( exceptionMsgThrown );
+  }
+
+  // The heavy profile heats the device beyond 85 C
+  SelfHeating selfHeating(profiles, current, 36, 45);
+  for ( size_t profileID = 0; profileID < 3; profileID++ ) {
+      double temperature = selfHeating.temperatures[profileID];
+      double power = fullPowerAt(profiles, profileID, temperature);
+      BOOST_CHECK( !selfHeating.isRunaway[profileID] );
+      BOOST_CHECK_CLOSE( selfHeating.powers[profileID], power, 1e-6 );
+      BOOST_CHECK_SMALL( 45 + 36 * power / 1000 - temperature, 1e-5 );
+      BOOST_CHECK( selfHeating.nEvaluations[profileID] <= 6 );
+  }
+  BOOST_CHECK( selfHeating.temperatures[2] > 85 );
+
+  // Same solution as the plain iteration from the ambient temperature
+  double temperature = 45;
+  for ( int iteration = 0; iteration < 200; iteration++ ) {
+      temperature = 45 + 36 * fullPowerAt(profiles, 1, temperature) / 1000;
+  }
+  BOOST_CHECK_CLOSE( selfHeating.temperatures[1], temperature, 1e-6 );
+
+  // No solution in the operating range for the heavy profile
+  SelfHeating runaway(profiles, current, 50, 45);
+  BOOST_CHECK( !runaway.isRunaway[0] );
+  BOOST_CHECK( runaway.isRunaway[2] );
+  BOOST_CHECK( runaway.temperatures[2] == 95 );
+}
+
+BOOST_AUTO_TEST_CASE( checkSelfHeating_ambient_range )
+{
+  WorkloadProfiles profiles = readTestProfiles();
+  Current current("technology_input/test_technology.json",
+                  "architecture_input/test_architecture.json",
+                  false);
+
+  string exceptionMsg("Empty");
+  try {
+      SelfHeating selfHeating(profiles, current, 10, 95);
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  BOOST_CHECK( exceptionMsg == "[ERROR] Ambient temperature outside the "
+                               "operating range from 0 to 95 degrees "
+                               "Celsius!\n" );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // SELFHEATINGTEST_CPP
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef SHARDMANIFESTTEST_CPP
+#define SHARDMANIFESTTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../parser/ShardManifest.h"
+
+#include <fstream>
+
+BOOST_AUTO_TEST_SUITE( testShardManifest )
+
+BOOST_AUTO_TEST_CASE( checkShardManifest_round_trip )
+{
+  ShardManifest manifest;
+  manifest.shardID = 2;
+  manifest.nShards = 3;
+  manifest.arguments.push_back("-t");
+  manifest.arguments.push_back("technology_input/test_technology.json");
+  manifest.filePairsHash = "0123456789abcdef";
+  manifest.sweepSizesHash = "fedcba9876543210";
+  manifest.nRunConfigurations = 5;
+  ShardManifest::Configuration configuration;
+  configuration.configuration = 2;
+  configuration.technologyFileName = "technology_input/test_technology.json";
+  configuration.architectureFileName
+          = "architecture_input/test_architecture.json";
+  configuration.sweepPoint = "Frequency[MHz]=800";
+  configuration.outputFileNames.push_back("currentresult_2.json");
+  manifest.configurations.push_back(configuration);
+  configuration.configuration = 5;
+  configuration.sweepPoint = "";
+  configuration.outputFileNames.clear();
+  manifest.configurations.push_back(configuration);
+
+  string fileName = ShardManifest::manifestFileName(2, 3);
+  BOOST_CHECK( fileName == "shard_2_of_3.json" );
+  manifest.write(fileName);
+
+  ShardManifest readManifest;
+  readManifest.read(fileName);
+  remove(fileName.c_str());
+
+  BOOST_CHECK( readManifest.version == manifest.version );
+  BOOST_CHECK( readManifest.shardID == 2 );
+  BOOST_CHECK( readManifest.nShards == 3 );
+  BOOST_CHECK( readManifest.arguments == manifest.arguments );
+  BOOST_CHECK( readManifest.filePairsHash == "0123456789abcdef" );
+  BOOST_CHECK( readManifest.sweepSizesHash == "fedcba9876543210" );
+  BOOST_CHECK( readManifest.nRunConfigurations == 5 );
+  BOOST_CHECK( readManifest.columnarFileName.empty() );
+  BOOST_REQUIRE( readManifest.configurations.size() == 2 );
+  BOOST_CHECK( readManifest.configurations[0].configuration == 2 );
+  BOOST_CHECK( readManifest.configurations[0].sweepPoint
+               == "Frequency[MHz]=800" );
+  BOOST_CHECK( readManifest.configurations[0].outputFileNames
+               == vector<string>(1, "currentresult_2.json") );
+  BOOST_CHECK( readManifest.configurations[1].configuration == 5 );
+  BOOST_CHECK( readManifest.configurations[1].architectureFileName
+               == "architecture_input/test_architecture.json" );
+  BOOST_CHECK( readManifest.configurations[1].outputFileNames.empty() );
+}
+
+BOOST_AUTO_TEST_CASE( checkShardManifest_bad_file )
+{
+  string fileName("shard_manifest_test.json");
+  ofstream manifestFile(fileName, ofstream::trunc);
+  manifestFile << "{\"DRAMSpecVersion\": \"2.1.0\", \"shard\": 1}";
+  manifestFile.close();
+
+  string exceptionMsg("Empty");
+  try {
+      ShardManifest manifest;
+      manifest.read(fileName);
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  remove(fileName.c_str());
+
+  string expectedMsg("[ERROR] Could not read shard manifest "
+                     "shard_manifest_test.json: "
+                     "a member is missing or invalid!\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                      "Error message different from what was expected."
+                      << "\nExpected: " << expectedMsg
+                      << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // SHARDMANIFESTTEST_CPP
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef SPEEDBINTABLETEST_CPP
+#define SPEEDBINTABLETEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../core/SpeedBinTable.h"
+
+#include <fstream>
+
+BOOST_AUTO_TEST_SUITE( testSpeedBinTable )
+
+// Every speed bin must match a full evaluation at its frequency
+void checkSpeedBins(const TechnologyValues& techValues,
+                    const vector<double>& frequencies)
+{
+  Current current;
+  try {
+      current = Current(techValues, false);
+  }catch (string exceptionMsgThrown){
+      BOOST_FAIL( exceptionMsgThrown );
+  }
+  SpeedBinTable speedBinTable(current, frequencies);
+  BOOST_REQUIRE( speedBinTable.speedBins.size() == frequencies.size() );
+
+  for ( size_t binID = 0; binID < frequencies.size(); binID++ ) {
+      TechnologyValues binValues(techValues);
+      binValues.dramFreq = frequencies[binID]*drs::megahertz_clock;
+      Current reference(binValues, false);
+      const SpeedBinTable::SpeedBin& speedBin
+              = speedBinTable.speedBins[binID];
+
+      BOOST_CHECK( speedBin.frequency == frequencies[binID] );
+      BOOST_CHECK( speedBin.coreFrequency
+                   == reference.dramCoreFreq.value() );
+      BOOST_CHECK( speedBin.trcd == reference.trcd_clk.value() );
+      BOOST_CHECK( speedBin.tcas == reference.tcas_clk.value() );
+      BOOST_CHECK( speedBin.tras == reference.tras_clk.value() );
+      BOOST_CHECK( speedBin.trp == reference.trp_clk.value() );
+      BOOST_CHECK( speedBin.trc == reference.trc_clk.value() );
+      BOOST_CHECK( speedBin.trl == reference.trl_clk.value() );
+      BOOST_CHECK( speedBin.twl == reference.twl_clk.value() );
+      BOOST_CHECK( speedBin.trtp == reference.trtp_clk.value() );
+      BOOST_CHECK( speedBin.tccd == reference.tccd_clk.value() );
+      BOOST_CHECK( speedBin.twr == reference.twr_clk.value() );
+      BOOST_CHECK( speedBin.trfc == reference.trfc_clk.value() );
+      BOOST_CHECK( speedBin.trefI == reference.trefI_clk.value() );
+      BOOST_CHECK_CLOSE( speedBin.IDD0, reference.IDD0.value(), 1e-9 );
+      BOOST_CHECK_CLOSE( speedBin.IDD1, reference.IDD1.value(), 1e-9 );
+      BOOST_CHECK_CLOSE( speedBin.IDD2N, reference.IDD2n.value(), 1e-9 );
+      BOOST_CHECK_CLOSE( speedBin.IDD3N, reference.IDD3n.value(), 1e-9 );
+      BOOST_CHECK_CLOSE( speedBin.IDD4R, reference.IDD4R.value(), 1e-9 );
+      BOOST_CHECK_CLOSE( speedBin.IDD4W, reference.IDD4W.value(), 1e-9 );
+      BOOST_CHECK_CLOSE( speedBin.IDD5B, reference.IDD5b.value(), 1e-9 );
+      BOOST_CHECK_CLOSE( speedBin.IPP5B, reference.IPP5b.value(), 1e-9 );
+      BOOST_CHECK( speedBin.isTooFast
+                   == (reference.dramCoreFreq > reference.maxCoreFreq) );
+  }
+}
+
+BOOST_AUTO_TEST_CASE( checkSpeedBinTable_full_evaluation )
+{
+  TechnologyValues techValues;
+  try {
+      techValues = TechnologyValues("technology_input/test_technology.json",
+                                    "architecture_input/test_architecture.json");
+  }catch (string exceptionMsgThrown){
+      BOOST_FAIL( exceptionMsgThrown );
+  }
+  vector<double> frequencies = {400, 800, 1066.5, 1600, 20000};
+  checkSpeedBins(techValues, frequencies);
+
+  // The core frequency is always calculated from the frequency
+  techValues.dramCoreFreq = 150*drs::megahertz_clock;
+  checkSpeedBins(techValues, frequencies);
+}
+
+BOOST_AUTO_TEST_CASE( checkSpeedBinTable_write )
+{
+  Current current;
+  try {
+      current = Current("technology_input/test_technology.json",
+                        "architecture_input/test_architecture.json",
+                        false);
+  }catch (string exceptionMsgThrown){
+      BOOST_FAIL( exceptionMsgThrown );
+  }
+  vector<double> frequencies = {800, 1600};
+  SpeedBinTable speedBinTable(current, frequencies);
+
+  string fileName("speedbin_test.csv");
+  speedBinTable.write(fileName);
+  ifstream tableFile(fileName);
+  vector<string> lines;
+  string line;
+  while ( getline(tableFile, line) ) {
+      lines.push_back(line);
+  }
+  tableFile.close();
+  remove(fileName.c_str());
+
+  BOOST_REQUIRE( lines.size() == 3 );
+  BOOST_CHECK( lines[0].compare(0, 30, "frequency[MHz],core_frequency[") == 0 );
+  BOOST_CHECK( lines[1].compare(0, 4, "800,") == 0 );
+  BOOST_CHECK( lines[2].compare(0, 5, "1600,") == 0 );
+
+  string report;
+  speedBinTable.appendReport(report);
+  BOOST_CHECK( report.compare(0, 28, "Speed bins (2 frequencies)\n ") == 0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // SPEEDBINTABLETEST_CPP
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef STREAMPROCESSORTEST_CPP
+#define STREAMPROCESSORTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../parser/StreamProcessor.h"
+
+BOOST_AUTO_TEST_SUITE( testStreamProcessor )
+
+BOOST_AUTO_TEST_CASE( checkStreamProcessor_ordered_results )
+{
+  int sim_argc = 4;
+  char* sim_argv[] = {"./executable",
+                      "-stream",
+                      "-threads",
+                      "3"};
+  ArgumentsParser arguments(sim_argc, sim_argv);
+  arguments.runArgParser();
+
+  // A single frequency is given for each configuration, so each result
+  //  line can be matched with its input line
+  string configuration("{\"technology\": "
+                       "\"technology_input/test_technology.json\", "
+                       "\"architecture\": "
+                       "\"architecture_input/test_architecture.json\", ");
+  stringstream input;
+  for ( unsigned int lineID = 0; lineID < 20; lineID++ ) {
+      input << configuration
+            << "\"id\": " << lineID << ", "
+            << "\"overrides\": {\"Frequency[MHz]\": " << 400 + 10*lineID << "}}"
+            << "\n";
+  }
+  input << "\n"; // Empty lines are skipped
+  input << "this is not JSON\n";
+
+  stringstream output;
+  StreamProcessor streamProcessor(arguments, NULL);
+  streamProcessor.run(input, output);
+
+  string line;
+  unsigned int lineID = 0;
+  while ( getline(output, line) ) {
+      rapidjson::Document result;
+      result.Parse(line.c_str());
+      BOOST_REQUIRE_MESSAGE( result.HasParseError() == false,
+                            "Result line is not a JSON document: " << line);
+
+      if ( lineID < 20 ) {
+          BOOST_CHECK_MESSAGE( result["id"].GetDouble() == lineID,
+                              "Result id different from what was expected."
+                              << "\nExpected: " << lineID
+                              << "\nGot: " << result["id"].GetDouble());
+          BOOST_CHECK_MESSAGE( result["Results"]["dramFreq"].GetDouble()
+                               == 400 + 10*lineID,
+                              "Result frequency different from what was expected."
+                              << "\nExpected: " << 400 + 10*lineID
+                              << "\nGot: "
+                              << result["Results"]["dramFreq"].GetDouble());
+      }
+      else {
+          // Lines without id are identified by their line number
+          BOOST_CHECK_MESSAGE( result["id"].GetDouble() == 22,
+                              "Result id different from what was expected."
+                              << "\nExpected: " << 22
+                              << "\nGot: " << result["id"].GetDouble());
+          string expectedMsg("[ERROR] Could not parse line 22 "
+                             "as a JSON object.\n");
+          BOOST_CHECK_MESSAGE( result.HasMember("Error")
+                               && result["Error"].GetString() == expectedMsg,
+                              "Error message different from what was expected."
+                              << "\nExpected: " << expectedMsg
+                              << "\nGot: " << line);
+      }
+      lineID++;
+  }
+  BOOST_CHECK_MESSAGE( lineID == 21,
+                      "Number of result lines different from what was expected."
+                      << "\nExpected: " << 21
+                      << "\nGot: " << lineID);
+}
+
+BOOST_AUTO_TEST_CASE( checkStreamProcessor_inline_documents )
+{
+  int sim_argc = 2;
+  char* sim_argv[] = {"./executable",
+                      "-stream"};
+  ArgumentsParser arguments(sim_argc, sim_argv);
+  arguments.runArgParser();
+  StreamProcessor streamProcessor(arguments, NULL);
+
+  ifstream archFile("architecture_input/test_architecture.json");
+  stringstream archText;
+  archText << archFile.rdbuf();
+  string archLine(archText.str());
+  replace(archLine.begin(), archLine.end(), '\n', ' ');
+
+  string line("{\"technology\": \"technology_input/test_technology.json\", "
+              "\"architecture\": " + archLine + "}");
+  rapidjson::Document result;
+  result.Parse(streamProcessor.evaluateLine(line, 1).c_str());
+
+  TechnologyValues techValues("technology_input/test_technology.json",
+                              "architecture_input/test_architecture.json");
+  Current dram(techValues, false);
+
+  BOOST_REQUIRE_MESSAGE( result.HasMember("Results"),
+                        "Result line has no results: "
+                        << streamProcessor.evaluateLine(line, 1));
+  BOOST_CHECK_CLOSE( result["Results"]["IDD0"].GetDouble(),
+                     dram.IDD0.value(), 1e-9 );
+  BOOST_CHECK_CLOSE( result["Results"]["trc"].GetDouble(),
+                     dram.trc.value(), 1e-9 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // STREAMPROCESSORTEST_CPP
@@ -44,6 +44,7 @@
 #include <boost/test/included/unit_test.hpp>
 
 #include "../../parser/TechnologyValues.h"
+#include "../../parser/ParameterSweep.h"
 
 BOOST_AUTO_TEST_SUITE( testTechnologyValues )
 
@@ -1251,6 +1252,191 @@ BOOST_AUTO_TEST_CASE( checkInputTechnologyValues_bad_arch_file )
                         << "\nGot: " << exceptionMsg);
 }
 
+BOOST_AUTO_TEST_CASE( checkInputTechnologyValues_canonical_values )
+{
+    string exceptionMsg("Empty");
+    TechnologyValues techValues;
+    try {
+        techValues = TechnologyValues("technology_input/test_technology.json",
+                                      "architecture_input/test_architecture.json");
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("Empty");
+    if ( exceptionMsg != expectedMsg ) {
+        BOOST_FAIL( exceptionMsg );
+    }
+
+    // Values the model ignores must not change the canonical form
+    TechnologyValues ignoredChanges(techValues);
+    ignoredChanges.techFileName = "another_technology_file.json";
+    ignoredChanges.technologyNode = 20*drs::nanometer;
+    ignoredChanges.inOutSSADelay = 1*drs::nanoseconds;
+    ignoredChanges.dramCoreFreq = 400*drs::megahertz_clock;
+    BOOST_CHECK_MESSAGE( ignoredChanges.canonicalValues()
+                         == techValues.canonicalValues(),
+                         "Canonical values depend on ignored values."
+                         << "\nExpected: " << techValues.canonicalValues()
+                         << "\nGot: " << ignoredChanges.canonicalValues());
+
+    TechnologyValues relevantChange(techValues);
+    relevantChange.temperature = 90*bu::celsius::degrees;
+    BOOST_CHECK_MESSAGE( relevantChange.canonicalValues()
+                         != techValues.canonicalValues(),
+                         "Canonical values do not depend on the temperature.");
+}
+
+BOOST_AUTO_TEST_CASE( checkInputTechnologyValues_overrides )
+{
+    vector<string> parameterOverrides;
+    parameterOverrides.push_back("Frequency[MHz]=1066");
+    parameterOverrides.push_back("Vdd[V]=1.2");
+    parameterOverrides.push_back("DRAMType[-]=DDR4");
+    parameterOverrides.push_back("VppPumpEfficiency[-]=0.5");
+
+    string exceptionMsg("Empty");
+    TechnologyValues techValues;
+    try {
+        techValues = TechnologyValues("technology_input/test_technology.json",
+                                      "architecture_input/test_architecture.json",
+                                      parameterOverrides);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("Empty");
+    if ( exceptionMsg != expectedMsg ) {
+        BOOST_FAIL( exceptionMsg );
+    }
+
+    BOOST_CHECK_MESSAGE( techValues.dramFreq.value() == 1066,
+                        "Overridden frequency different from what was expected."
+                        << "\nExpected: " << 1066
+                        << "\nGot: " << techValues.dramFreq.value());
+    BOOST_CHECK_MESSAGE( techValues.vdd.value() == 1.2,
+                        "Overridden Vdd different from what was expected."
+                        << "\nExpected: " << 1.2
+                        << "\nGot: " << techValues.vdd.value());
+    BOOST_CHECK_MESSAGE( techValues.dramType == "DDR4",
+                        "Overridden DRAM type different from what was expected."
+                        << "\nExpected: " << "DDR4"
+                        << "\nGot: " << techValues.dramType);
+    BOOST_CHECK_MESSAGE( techValues.vppPumpsEfficiency == 0.5,
+                        "Added pump efficiency different from what was expected."
+                        << "\nExpected: " << 0.5
+                        << "\nGot: " << techValues.vppPumpsEfficiency);
+    // Values not overridden are kept
+    BOOST_CHECK_MESSAGE( techValues.temperature.value() == 27,
+                        "Temperature different from what was expected."
+                        << "\nExpected: " << 27
+                        << "\nGot: " << techValues.temperature.value());
+}
+
+BOOST_AUTO_TEST_CASE( checkInputTechnologyValues_bad_override )
+{
+    vector<string> parameterOverrides;
+    parameterOverrides.push_back("Frequency[MHz]");
+
+    string exceptionMsg("Empty");
+    try {
+        TechnologyValues techValues("technology_input/test_technology.json",
+                                    "architecture_input/test_architecture.json",
+                                    parameterOverrides);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Parameter override \"Frequency[MHz]\" "
+                       "is not in the form \"Key=value\"!\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputTechnologyValues_list_override )
+{
+    // A plain list is swept like {"list": [...]}
+    vector<string> parameterOverrides;
+    parameterOverrides.push_back("Frequency[MHz]=[800, 1066]");
+
+    string exceptionMsg("Empty");
+    try {
+        TechnologyValues fileValues;
+        rapidjson::Document techDocument;
+        rapidjson::Document archDocument;
+        fileValues.loadJSONDocuments("technology_input/test_technology.json",
+                                     "architecture_input/test_architecture.json",
+                                     parameterOverrides,
+                                     techDocument,
+                                     archDocument);
+        ParameterSweep sweep(techDocument, archDocument);
+        BOOST_CHECK_MESSAGE( sweep.nPoints == 2,
+                            "Number of sweep points different from what was expected."
+                            << "\nExpected: " << 2
+                            << "\nGot: " << sweep.nPoints);
+
+        sweep.setPoint(1);
+        TechnologyValues techValues(fileValues);
+        techValues.extractValues(techDocument, archDocument);
+        BOOST_CHECK_MESSAGE( techValues.dramFreq.value() == 1066,
+                            "Swept frequency different from what was expected."
+                            << "\nExpected: " << 1066
+                            << "\nGot: " << techValues.dramFreq.value());
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputTechnologyValues_unknown_override )
+{
+    vector<string> parameterOverrides;
+    parameterOverrides.push_back("Frequency[Mhz]=1066");
+
+    string exceptionMsg("Empty");
+    try {
+        TechnologyValues techValues("technology_input/test_technology.json",
+                                    "architecture_input/test_architecture.json",
+                                    parameterOverrides);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Parameter override \"Frequency[Mhz]=1066\" "
+                       "does not match any input value!\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputTechnologyValues_parameter_schema )
+{
+    for ( int parameterID = 0; parameterID < nInputParameters; parameterID++ ) {
+        const char* jsonKey = inputParameters[parameterID].jsonKey;
+        BOOST_CHECK_MESSAGE( findInputParameter(jsonKey, strlen(jsonKey))
+                             == parameterID,
+                            "Input value not found by its key: " << jsonKey);
+    }
+
+    // Keys are matched exactly, not by prefix
+    BOOST_CHECK( findInputParameter("Vdd[V]", 6) == INPUT_vdd );
+    BOOST_CHECK( findInputParameter("Vdd[V]", 5) == -1 );
+    BOOST_CHECK( findInputParameter("Vdd[V] ", 7) == -1 );
+    BOOST_CHECK( findInputParameter("Description", 11) == -1 );
+
+    // The values of the input files are the same through the schema
+    TechnologyValues techValues("technology_input/test_technology.json",
+                                "architecture_input/test_architecture.json");
+    BOOST_CHECK( inputParameters[INPUT_dramFreq].document
+                 == ARCHITECTURE_INPUT );
+    BOOST_CHECK( string(inputParameters[INPUT_dramFreq].memberName)
+                 == "dramFreq" );
+    BOOST_CHECK( inputValue(techValues.dramFreq) == 800 );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef TEMPERATUREPROFILETEST_CPP
+#define TEMPERATUREPROFILETEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../thermal/TemperatureProfile.h"
+
+#include <fstream>
+
+BOOST_AUTO_TEST_SUITE( testTemperatureProfile )
+
+string readLogError(const string& fileName, const string& samples)
+{
+  ofstream logFile(fileName, ofstream::trunc);
+  logFile << samples;
+  logFile.close();
+
+  string exceptionMsg("Empty");
+  try {
+      TemperatureLog temperatureLog;
+      temperatureLog.read(fileName);
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  remove(fileName.c_str());
+  return exceptionMsg;
+}
+
+// Full evaluation of the test device at a temperature, with resistances
+//  that depend on it if requested
+Current evaluateAt(double temperature, bool hasTempCoefficients = false)
+{
+  TechnologyValues techValues("technology_input/test_technology.json",
+                              "architecture_input/test_architecture.json");
+  techValues.temperature = temperature*bu::celsius::degrees;
+  if ( hasTempCoefficients ) {
+      // A clock cycle of tRFC falls between 5 and 84 C at this frequency
+      techValues.dramFreq = 1600*drs::megahertz_clock;
+      techValues.wireResistanceTempCoefficient = 0.0039*drs::eergeds;
+      techValues.cellResistanceTempCoefficient = 0.002*drs::eergeds;
+      techValues.driverResistanceTempCoefficient = 0.0015*drs::eergeds;
+  }
+  return Current(techValues, false);
+}
+
+BOOST_AUTO_TEST_CASE( checkTemperatureProfile_real_input )
+{
+  string fileName("temperature_profile_test.csv");
+  ofstream logFile(fileName, ofstream::trunc);
+  logFile << " time[s] , temperature[C]\n"
+             "# Warm-up\n"
+             "0,45\n"
+             "\n"
+             "10, 85\n"
+             "30,90.5\r\n"
+             "40,60";
+  logFile.close();
+
+  TemperatureLog temperatureLog;
+  temperatureLog.read(fileName);
+  remove(fileName.c_str());
+
+  BOOST_REQUIRE( temperatureLog.times.size() == 4 );
+  BOOST_CHECK( temperatureLog.temperatures[2] == 90.5 );
+  BOOST_CHECK( temperatureLog.durations[1] == 20 );
+  BOOST_CHECK( temperatureLog.durations[3] == 0 );
+  // 85 C is still in the normal range
+  BOOST_CHECK( !temperatureLog.isExtended[1] );
+  BOOST_CHECK( temperatureLog.isExtended[2] );
+  BOOST_CHECK( temperatureLog.duration == 40 );
+  BOOST_CHECK( temperatureLog.extendedDuration == 10 );
+
+  Current current;
+  Current normal;
+  Current extended;
+  try {
+      current = Current("technology_input/test_technology.json",
+                        "architecture_input/test_architecture.json",
+                        false);
+      normal = evaluateAt(60);
+      extended = evaluateAt(90.5);
+  }catch (string exceptionMsgThrown){
+      BOOST_FAIL( exceptionMsgThrown );
+  }
+  TemperatureProfile profile(temperatureLog, current);
+
+  double vdd = current.vdd.value();
+  double normalOverhead = normal.trfc_clk.value() / normal.trefI_clk.value();
+  double extendedOverhead = extended.trfc_clk.value()
+                            / extended.trefI_clk.value();
+  BOOST_CHECK_CLOSE( profile.refreshOverhead[3], normalOverhead, 1e-9 );
+  BOOST_CHECK_CLOSE( profile.refreshOverhead[2], extendedOverhead, 1e-9 );
+  double normalPower = ( vdd * (normal.IDD5b.value() - normal.IDD3n.value())
+                         + current.vpp.value()
+                           * (normal.IPP5b.value() - normal.IPP3n.value()) )
+                       * normalOverhead;
+  BOOST_CHECK_CLOSE( profile.refreshPower[TemperatureProfile::NORMAL_RANGE],
+                     normalPower, 1e-9 );
+
+  // Every sample matches a full evaluation at its temperature
+  BOOST_CHECK_CLOSE( profile.backgroundPower[2],
+                     vdd * extended.IDD2n.value(), 1e-9 );
+  BOOST_CHECK_CLOSE( profile.backgroundPower[3],
+                     vdd * normal.IDD2n.value(), 1e-9 );
+  BOOST_CHECK( profile.highestPowerSampleID == 2 );
+
+  BOOST_CHECK_CLOSE( profile.meanRefreshOverhead,
+                     (30 * normalOverhead + 10 * extendedOverhead) / 40,
+                     1e-9 );
+  BOOST_CHECK_CLOSE( profile.maxRefreshOverhead, extendedOverhead, 1e-9 );
+  BOOST_CHECK_CLOSE( profile.backgroundEnergy,
+                     10 * profile.backgroundPower[0]
+                     + 20 * profile.backgroundPower[1]
+                     + 10 * profile.backgroundPower[2], 1e-9 );
+  BOOST_CHECK_CLOSE( profile.refreshEnergy,
+                     30 * normalPower
+                     + 10 * profile.refreshPower[
+                                TemperatureProfile::EXTENDED_RANGE],
+                     1e-9 );
+
+  // Times and temperatures are written back as they were read
+  profile.write(fileName, temperatureLog);
+  ifstream profileFile(fileName);
+  vector<string> lines;
+  string line;
+  while ( getline(profileFile, line) ) {
+      lines.push_back(line);
+  }
+  profileFile.close();
+  remove(fileName.c_str());
+  BOOST_REQUIRE( lines.size() == 5 );
+  BOOST_CHECK( lines[0] == "time[s],temperature[C],refresh_overhead,"
+                           "background[mW],refresh[mW]" );
+  BOOST_CHECK( lines[2].compare(0, 6, "10,85,") == 0 );
+  BOOST_CHECK( lines[3].compare(0, 8, "30,90.5,") == 0 );
+}
+
+BOOST_AUTO_TEST_CASE( checkTemperatureProfile_temperature_coefficients )
+{
+  string fileName("temperature_profile_test.csv");
+  ofstream logFile(fileName, ofstream::trunc);
+  logFile << "time[s],temperature[C]\n"
+             "0,5\n"
+             "10,45\n"
+             "20,84\n"
+             "30,86\n"
+             "40,94\n"
+             "50,45\n";
+  logFile.close();
+
+  TemperatureLog temperatureLog;
+  temperatureLog.read(fileName);
+  remove(fileName.c_str());
+
+  Current current;
+  vector<Current> sampleDrams;
+  try {
+      current = evaluateAt(45, true);
+      for ( double temperature : temperatureLog.temperatures ) {
+          sampleDrams.push_back(evaluateAt(temperature, true));
+      }
+  }catch (string exceptionMsgThrown){
+      BOOST_FAIL( exceptionMsgThrown );
+  }
+  TemperatureProfile profile(temperatureLog, current);
+
+  // tRFC follows the resistances at the temperature of every sample, as
+  //  in a full evaluation
+  for ( size_t sampleID = 0; sampleID < sampleDrams.size(); sampleID++ ) {
+      const Current& sampleDram = sampleDrams[sampleID];
+      BOOST_CHECK_CLOSE( profile.refreshOverhead[sampleID],
+                         sampleDram.trfc_clk.value()
+                         / sampleDram.trefI_clk.value(), 1e-9 );
+  }
+  BOOST_CHECK( sampleDrams[0].trfc_clk.value()
+               < sampleDrams[2].trfc_clk.value() );
+  double normalPower = ( current.vdd.value()
+                         * ( sampleDrams[2].IDD5b.value()
+                             - sampleDrams[2].IDD3n.value() )
+                         + current.vpp.value()
+                           * ( sampleDrams[2].IPP5b.value()
+                               - sampleDrams[2].IPP3n.value() ) )
+                       * sampleDrams[2].trfc_clk.value()
+                       / sampleDrams[2].trefI_clk.value();
+  BOOST_CHECK_CLOSE( profile.refreshPower[TemperatureProfile::NORMAL_RANGE],
+                     normalPower, 1e-9 );
+}
+
+BOOST_AUTO_TEST_CASE( checkTemperatureLog_bad_lines )
+{
+  string fileName("temperature_log_bad.csv");
+  string header("time[s],temperature[C]\n");
+  string prefix = "[ERROR] Temperature file " + fileName + ", line ";
+
+  BOOST_CHECK( readLogError(fileName, "time,temperature\n0,45\n")
+               == prefix + "1: expected the header time[s],temperature[C]!\n" );
+  BOOST_CHECK( readLogError(fileName, header + "0,45\n1\n")
+               == prefix + "3: expected a time and a temperature!\n" );
+  BOOST_CHECK( readLogError(fileName, header + "0,45\n1,4x\n")
+               == prefix + "3: expected a time and a temperature!\n" );
+  BOOST_CHECK( readLogError(fileName, header + "0,45\n1,\n2,45\n")
+               == prefix + "3: expected a time and a temperature!\n" );
+  BOOST_CHECK( readLogError(fileName, header + "5,45\n1,45\n")
+               == prefix + "3: times must not be negative nor decrease!\n" );
+  BOOST_CHECK( readLogError(fileName, header + "0,45\n1,95\n")
+               == prefix + "3: temperature outside the operating range "
+                           "from 0 to 95 degrees Celsius!\n" );
+  BOOST_CHECK( readLogError(fileName, header + "3,45\n")
+               == "[ERROR] Temperature file " + fileName
+                  + " spans no time!\n" );
+
+  string exceptionMsg("Empty");
+  try {
+      TemperatureLog temperatureLog;
+      temperatureLog.read("no_such_temperature_log.csv");
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  BOOST_CHECK( exceptionMsg == "[ERROR] Could not read temperature file: "
+                               "no_such_temperature_log.csv!\n" );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // TEMPERATUREPROFILETEST_CPP
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef TEMPERATURESWEEPTEST_CPP
+#define TEMPERATURESWEEPTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../core/TemperatureSweep.h"
+
+BOOST_AUTO_TEST_SUITE( testTemperatureSweep )
+
+TechnologyValues readHotTechnology()
+{
+  TechnologyValues techValues("technology_input/test_technology.json",
+                              "architecture_input/test_architecture.json");
+  techValues.wireResistanceTempCoefficient = 0.0039*drs::eergeds;
+  techValues.cellResistanceTempCoefficient = 0.002*drs::eergeds;
+  techValues.driverResistanceTempCoefficient = 0.0015*drs::eergeds;
+  techValues.resistanceRefTemp = 25*bu::celsius::degrees;
+  return techValues;
+}
+
+// Every point must match a full evaluation at its temperature
+BOOST_AUTO_TEST_CASE( checkTemperatureSweep_full_evaluation )
+{
+  TechnologyValues techValues;
+  Current current;
+  try {
+      techValues = readHotTechnology();
+      current = Current(techValues, false);
+  }catch (string exceptionMsgThrown){
+      BOOST_FAIL( exceptionMsgThrown );
+  }
+  vector<double> temperatures = {5, 25, 45.5, 70, 90, 94.9};
+  TemperatureSweep temperatureSweep(current, temperatures);
+  BOOST_REQUIRE( temperatureSweep.trcd.size() == temperatures.size() );
+
+  for ( size_t pointID = 0; pointID < temperatures.size(); pointID++ ) {
+      TechnologyValues pointValues(techValues);
+      pointValues.temperature = temperatures[pointID]*bu::celsius::degrees;
+      Current reference(pointValues, false);
+
+      BOOST_CHECK( temperatureSweep.temperatures[pointID]
+                   == temperatures[pointID] );
+      BOOST_CHECK_CLOSE( temperatureSweep.trcd[pointID],
+                         reference.trcd.value(), 1e-9 );
+      BOOST_CHECK_CLOSE( temperatureSweep.tcas[pointID],
+                         reference.tcas.value(), 1e-9 );
+      BOOST_CHECK_CLOSE( temperatureSweep.tras[pointID],
+                         reference.tras.value(), 1e-9 );
+      BOOST_CHECK_CLOSE( temperatureSweep.trp[pointID],
+                         reference.trp.value(), 1e-9 );
+      BOOST_CHECK_CLOSE( temperatureSweep.trc[pointID],
+                         reference.trc.value(), 1e-9 );
+      BOOST_CHECK( temperatureSweep.trcdClocks[pointID]
+                   == reference.trcd_clk.value() );
+      BOOST_CHECK( temperatureSweep.trasClocks[pointID]
+                   == reference.tras_clk.value() );
+      BOOST_CHECK( temperatureSweep.trcClocks[pointID]
+                   == reference.trc_clk.value() );
+
+      // The same delays when the temperature of a device is changed
+      Current heatedDram(current);
+      heatedDram.temperatureCompute(
+                  temperatures[pointID]*bu::celsius::degrees);
+      BOOST_CHECK_CLOSE( heatedDram.trcd.value(),
+                         reference.trcd.value(), 1e-9 );
+      BOOST_CHECK_CLOSE( heatedDram.trc.value(),
+                         reference.trc.value(), 1e-9 );
+      BOOST_CHECK( heatedDram.trfc_clk == reference.trfc_clk );
+  }
+
+  // Resistances, and so delays, grow with the temperature
+  for ( size_t pointID = 1; pointID < temperatures.size(); pointID++ ) {
+      BOOST_CHECK( temperatureSweep.trcd[pointID]
+                   > temperatureSweep.trcd[pointID-1] );
+      BOOST_CHECK( temperatureSweep.tcas[pointID]
+                   > temperatureSweep.tcas[pointID-1] );
+      BOOST_CHECK( temperatureSweep.margins[pointID]
+                   < temperatureSweep.margins[pointID-1] );
+  }
+}
+
+BOOST_AUTO_TEST_CASE( checkTemperatureSweep_margins )
+{
+  TechnologyValues techValues = readHotTechnology();
+  Current current(techValues, false);
+
+  // The timings of the configuration cover its own temperature
+  vector<double> temperatures = {techValues.temperature.value()};
+  TemperatureSweep temperatureSweep(current, temperatures);
+  BOOST_CHECK( temperatureSweep.margins[0] >= 0 );
+  BOOST_CHECK_CLOSE( temperatureSweep.margins[0],
+                     min( min( current.trcd_clk.value()
+                               * current.clkPeriod.value()
+                               - current.trcd.value(),
+                               current.tcas_clk.value()
+                               * current.clkPeriod.value()
+                               - current.tcas.value() ),
+                          min( current.tras_clk.value()
+                               * current.clkPeriod.value()
+                               - current.tras.value(),
+                               current.trp_clk.value()
+                               * current.clkPeriod.value()
+                               - current.trp.value() ) ),
+                     1e-6 );
+
+  // Without temperature coefficients, the delays do not change
+  Current fixedDram("technology_input/test_technology.json",
+                    "architecture_input/test_architecture.json",
+                    false);
+  vector<double> hotTemperatures = {10, 60, 94};
+  TemperatureSweep fixedSweep(fixedDram, hotTemperatures);
+  for ( size_t pointID = 0; pointID < hotTemperatures.size(); pointID++ ) {
+      BOOST_CHECK( fixedSweep.trcd[pointID] == fixedDram.trcd.value() );
+      BOOST_CHECK( fixedSweep.trc[pointID] == fixedDram.trc.value() );
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // TEMPERATURESWEEPTEST_CPP
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef TIMINGCHECKERTEST_CPP
+#define TIMINGCHECKERTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../trace/TimingChecker.h"
+
+#include <fstream>
+#include <sstream>
+
+BOOST_AUTO_TEST_SUITE( testTimingChecker )
+
+string readTextFile(const string& fileName)
+{
+  ifstream textFile(fileName);
+  stringstream text;
+  text << textFile.rdbuf();
+  return text.str();
+}
+
+BOOST_AUTO_TEST_CASE( checkTimingChecker_violations )
+{
+  Current current;
+  try {
+      current = Current("technology_input/test_technology.json",
+                        "architecture_input/test_architecture.json",
+                        false);
+  }catch (string exceptionMsgThrown){
+      BOOST_FAIL( exceptionMsgThrown );
+  }
+  uint64_t trcd = current.trcd_clk.value();
+  uint64_t tras = current.tras_clk.value();
+  uint64_t trp = current.trp_clk.value();
+  uint64_t trtp = current.trtp_clk.value();
+  uint64_t trfc = current.trfc_clk.value();
+
+  // A RD too early after its ACT, a RD to a closed bank in the same cycle
+  //  (too close to the first RD), an ACT too early after the PRE, and a
+  //  REF while bank 0 is open
+  uint64_t activate = 100;
+  uint64_t read = activate + trcd - 1;
+  uint64_t precharge = activate + tras + trtp;
+  uint64_t nextActivate = precharge + trp - 1;
+  uint64_t refresh = nextActivate + 1000;
+  string traceFileName("timing_checker_test.trace");
+  ofstream traceFile(traceFileName, ofstream::trunc);
+  traceFile << activate << ",ACT,0\n"
+            << read << ",RD,0\n"
+            << read << ",RD,1\n"
+            << precharge << ",PRE,0\n"
+            << nextActivate << ",ACT,0\n"
+            << refresh << ",REF\n"
+            << refresh + trfc << ",ACT,1\n";
+  traceFile.close();
+
+  string violationFileName("timing_checker_test.csv");
+  TimingChecker checker(current, current, 1);
+  checker.check(traceFileName, violationFileName);
+
+  BOOST_CHECK( checker.nCommands == 7 );
+  BOOST_CHECK( checker.nViolations[CONSTRAINT_TRCD] == 1 );
+  BOOST_CHECK( checker.nViolations[CONSTRAINT_TCCD] == 1 );
+  BOOST_CHECK( checker.nViolations[CONSTRAINT_TRP] == 1 );
+  BOOST_CHECK( checker.nViolations[CONSTRAINT_BANK_STATE] == 2 );
+  BOOST_CHECK( checker.nViolations[CONSTRAINT_TRAS] == 0 );
+  BOOST_CHECK( checker.nViolations[CONSTRAINT_TRC] == 0 );
+  BOOST_CHECK( checker.nViolations[CONSTRAINT_TRFC] == 0 );
+  BOOST_CHECK( checker.firstViolations[CONSTRAINT_TRP].cycle
+               == nextActivate );
+
+  ostringstream expectedViolations;
+  expectedViolations << "command,cycle,type,bank,constraint,allowed_cycle\n"
+                     << "2," << read << ",RD,0,tRCD," << activate + trcd
+                     << "\n"
+                     << "3," << read << ",RD,1,tCCD,"
+                     << read + (uint64_t) current.tccd_clk.value() << "\n"
+                     << "3," << read << ",RD,1,bank state," << read << "\n"
+                     << "5," << nextActivate << ",ACT,0,tRP,"
+                     << precharge + trp << "\n"
+                     << "6," << refresh << ",REF,0,bank state," << refresh
+                     << "\n";
+  BOOST_CHECK_EQUAL( readTextFile(violationFileName),
+                     expectedViolations.str() );
+
+  // The banks checked in parallel give the same violations
+  TimingChecker parallelChecker(current, current, 4);
+  parallelChecker.check(traceFileName, violationFileName);
+  BOOST_CHECK_EQUAL( readTextFile(violationFileName),
+                     expectedViolations.str() );
+
+  // The threads do not change the check, the banks do
+  BOOST_CHECK( parallelChecker.timingsKey() == checker.timingsKey() );
+  TechnologyValues moreBanks = current;
+  moreBanks.nBanks = current.nBanks * 2;
+  BOOST_CHECK( TimingChecker(current, moreBanks, 1).timingsKey()
+               != checker.timingsKey() );
+
+  remove(traceFileName.c_str());
+  remove(violationFileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE( checkTimingChecker_too_many_banks )
+{
+  string traceFileName("timing_checker_test.trace");
+  ofstream traceFile(traceFileName, ofstream::trunc);
+  traceFile << "1,ACT,8\n";
+  traceFile.close();
+
+  TechnologyValues technologyValues;
+  technologyValues.nBanks = 8;
+  string exceptionMsg("Empty");
+  try {
+      TimingChecker checker(Current(), technologyValues, 2);
+      checker.check(traceFileName, "");
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  remove(traceFileName.c_str());
+
+  string expectedMsg("[ERROR] Trace file timing_checker_test.trace uses "
+                     "bank 8, but the device has 8 banks!\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                      "Error message different from what was expected."
+                      << "\nExpected: " << expectedMsg
+                      << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // TIMINGCHECKERTEST_CPP
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef TRACEENERGYTEST_CPP
+#define TRACEENERGYTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../trace/TraceEnergy.h"
+
+#include <fstream>
+#include <cmath>
+
+BOOST_AUTO_TEST_SUITE( testTraceEnergy )
+
+string readTraceError(const string& fileName, const string& trace)
+{
+  ofstream traceFile(fileName, ofstream::trunc);
+  traceFile << trace;
+  traceFile.close();
+
+  string exceptionMsg("Empty");
+  try {
+      TraceActivity activity;
+      activity.read(fileName);
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  remove(fileName.c_str());
+  return exceptionMsg;
+}
+
+BOOST_AUTO_TEST_CASE( checkTraceActivity_commands )
+{
+  string fileName("trace_energy_test.trace");
+  ofstream traceFile(fileName, ofstream::trunc);
+  traceFile << "# cycle,command,bank\n"
+               "10,ACT,0\n"
+               "14,ACT,1\n"
+               "\n"
+               " 20 , RD , 0 \n"
+               "24,WR,1\n"
+               "30,PRE,0\n"
+               "40,PRE,1\n"
+               "50,REF\n"
+               "60,ACT,1";
+  traceFile.close();
+
+  TraceActivity activity;
+  activity.read(fileName);
+  remove(fileName.c_str());
+
+  BOOST_CHECK( activity.banks.size() == 2 );
+  BOOST_CHECK( activity.nCommands[TRACE_ACT] == 3 );
+  BOOST_CHECK( activity.nCommands[TRACE_RD] == 1 );
+  BOOST_CHECK( activity.nCommands[TRACE_WR] == 1 );
+  BOOST_CHECK( activity.nCommands[TRACE_PRE] == 2 );
+  BOOST_CHECK( activity.nCommands[TRACE_REF] == 1 );
+  BOOST_CHECK( activity.banks[0].nCommands[TRACE_ACT] == 1 );
+  BOOST_CHECK( activity.banks[1].nCommands[TRACE_ACT] == 2 );
+  BOOST_CHECK( activity.firstCycle == 10 );
+  BOOST_CHECK( activity.lastCycle == 60 );
+  // Bank 0 is open from 10 to 30, bank 1 from 14 to 40 (and is left open
+  //  at the end of the trace)
+  BOOST_CHECK( activity.banks[0].openCycles == 20 );
+  BOOST_CHECK( activity.banks[1].openCycles == 26 );
+  BOOST_CHECK( activity.anyOpenCycles == 30 );
+}
+
+BOOST_AUTO_TEST_CASE( checkTraceEnergy_real_input )
+{
+  Current current;
+  try {
+      current = Current("technology_input/test_technology.json",
+                        "architecture_input/test_architecture.json",
+                        false);
+  }catch (string exceptionMsgThrown){
+      BOOST_FAIL( exceptionMsgThrown );
+  }
+
+  TraceActivity activity;
+  vector<TraceCommand> commands = { {100, 0, TRACE_ACT},
+                                    {120, 0, TRACE_RD},
+                                    {140, 0, TRACE_PRE},
+                                    {200, 0, TRACE_REF} };
+  activity.add(commands);
+  activity.finish();
+
+  TraceEnergy energy(activity, current, current);
+
+  double tck = 1000.0 / current.dramFreq.value();
+  double vdd = current.vdd.value();
+  double vpp = current.vpp.value();
+  double trc = current.trc_clk.value() * tck;
+  double tras = current.tras_clk.value() * tck;
+  double activateEnergy = vdd * ( current.IDD0.value() * trc
+                                  - current.IDD3n.value() * tras
+                                  - current.IDD2n.value() * (trc - tras) )
+                          + vpp * ( current.IPP0.value()
+                                    - current.IPP3n.value() ) * trc;
+  double readEnergy = vdd * ( current.IDD4R.value() - current.IDD3n.value() )
+                      * current.tccd_clk.value() * tck;
+
+  BOOST_CHECK_CLOSE( energy.duration, 100 * tck, 1e-9 );
+  BOOST_CHECK_CLOSE( energy.banks[0].activate, activateEnergy, 1e-9 );
+  BOOST_CHECK_CLOSE( energy.banks[0].read, readEnergy, 1e-9 );
+  BOOST_CHECK( energy.banks[0].write == 0 );
+  BOOST_CHECK_CLOSE( energy.totalEnergy,
+                     energy.sharedBackgroundEnergy + energy.refreshEnergy
+                     + energy.banks[0].total, 1e-9 );
+  BOOST_CHECK_CLOSE( energy.averagePower,
+                     energy.totalEnergy / energy.duration, 1e-9 );
+}
+
+BOOST_AUTO_TEST_CASE( checkTraceEnergy_too_many_banks )
+{
+  TechnologyValues technologyValues;
+  technologyValues.nBanks = 8;
+  TraceActivity activity;
+  activity.traceFileName = "many_banks.trace";
+  vector<TraceCommand> commands = { {1, 8, TRACE_ACT} };
+  activity.add(commands);
+  activity.finish();
+
+  string exceptionMsg("Empty");
+  try {
+      TraceEnergy energy(activity, Current(), technologyValues);
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedMsg("[ERROR] Trace file many_banks.trace uses bank 8, "
+                     "but the device has 8 banks!\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                      "Error message different from what was expected."
+                      << "\nExpected: " << expectedMsg
+                      << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkTraceActivity_bank_above_limit )
+{
+  // Rejected before the banks are allocated
+  TraceActivity activity;
+  activity.traceFileName = "huge_bank.trace";
+  vector<TraceCommand> commands = { {1, 4000000000u, TRACE_ACT} };
+
+  string exceptionMsg("Empty");
+  try {
+      activity.add(commands);
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  string expectedMsg("[ERROR] Trace file huge_bank.trace uses bank "
+                     "4000000000, but devices have at most 65536 banks!\n");
+  BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                      "Error message different from what was expected."
+                      << "\nExpected: " << expectedMsg
+                      << "\nGot: " << exceptionMsg);
+  BOOST_CHECK( activity.banks.empty() );
+}
+
+BOOST_AUTO_TEST_CASE( checkCommandTrace_bad_lines )
+{
+  string fileName("trace_energy_test.trace");
+  string expectedMsg;
+
+  expectedMsg = "[ERROR] Trace file trace_energy_test.trace, line 2: "
+                "unknown command!\n";
+  BOOST_CHECK_EQUAL( readTraceError(fileName, "1,ACT,0\n2,NOP,0\n"),
+                     expectedMsg );
+
+  expectedMsg = "[ERROR] Trace file trace_energy_test.trace, line 3: "
+                "cycle before the one of the previous command!\n";
+  BOOST_CHECK_EQUAL( readTraceError(fileName,
+                                    "5,ACT,0\n# comment\n4,PRE,0\n"),
+                     expectedMsg );
+
+  expectedMsg = "[ERROR] Could not read trace file: missing.trace!\n";
+  string exceptionMsg("Empty");
+  try {
+      TraceActivity activity;
+      activity.read("missing.trace");
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  BOOST_CHECK_EQUAL( exceptionMsg, expectedMsg );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // TRACEENERGYTEST_CPP
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef VOLTAGESWEEPTEST_CPP
+#define VOLTAGESWEEPTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../core/VoltageSweep.h"
+#include "../../workload/WorkloadPower.h"
+
+#include <cmath>
+
+BOOST_AUTO_TEST_SUITE( testVoltageSweep )
+
+// Every point must match a full evaluation at its voltages, with the
+//  resistances given at the voltages of the configuration
+BOOST_AUTO_TEST_CASE( checkVoltageSweep_full_evaluation )
+{
+  TechnologyValues techValues;
+  Current current;
+  try {
+      techValues = TechnologyValues("technology_input/test_technology.json",
+                                    "architecture_input/test_architecture.json");
+      current = Current(techValues, false);
+  }catch (string exceptionMsgThrown){
+      BOOST_FAIL( exceptionMsgThrown );
+  }
+  double vdd = techValues.vdd.value();
+  double vpp = techValues.vpp.value();
+  vector<double> vdds = {vdd, 0.9 * vdd, vdd, 1.1 * vdd};
+  vector<double> vpps = {vpp, vpp, 0.9 * vpp, 1.1 * vpp};
+  VoltageSweep voltageSweep(current, vdds, vpps);
+  BOOST_REQUIRE( voltageSweep.points.size() == vdds.size() );
+
+  for ( size_t pointID = 0; pointID < vdds.size(); pointID++ ) {
+      TechnologyValues pointValues(techValues);
+      pointValues.referenceVdd = techValues.vdd;
+      pointValues.referenceVpp = techValues.vpp;
+      pointValues.vdd = vdds[pointID]*si::volts;
+      pointValues.vpp = vpps[pointID]*si::volts;
+      Current reference(pointValues, false);
+      WorkloadEnergies energies(reference, reference);
+      const VoltageSweep::VoltagePoint& point
+              = voltageSweep.points[pointID];
+
+      BOOST_CHECK( point.vdd == vdds[pointID] );
+      BOOST_CHECK( point.vpp == vpps[pointID] );
+      BOOST_CHECK_CLOSE( point.trcd, reference.trcd.value(), 1e-9 );
+      BOOST_CHECK_CLOSE( point.tcas, reference.tcas.value(), 1e-9 );
+      BOOST_CHECK_CLOSE( point.tras, reference.tras.value(), 1e-9 );
+      BOOST_CHECK_CLOSE( point.trp, reference.trp.value(), 1e-9 );
+      BOOST_CHECK_CLOSE( point.trc, reference.trc.value(), 1e-9 );
+      BOOST_CHECK( point.trcdClocks == reference.trcd_clk.value() );
+      BOOST_CHECK( point.tcasClocks == reference.tcas_clk.value() );
+      BOOST_CHECK( point.trcClocks == reference.trc_clk.value() );
+      BOOST_CHECK_CLOSE( point.activateEnergy, energies.activateEnergy,
+                         1e-9 );
+      BOOST_CHECK_CLOSE( point.readBitEnergy, energies.readByteEnergy / 8,
+                         1e-9 );
+      BOOST_CHECK_CLOSE( point.backgroundPower, energies.idlePower, 1e-9 );
+      BOOST_CHECK( point.isTooFast
+                   == (reference.dramCoreFreq > reference.maxCoreFreq) );
+  }
+
+  // At the voltages of the configuration, nothing changes
+  BOOST_CHECK( voltageSweep.points[0].trcd == current.trcd.value() );
+  BOOST_CHECK( voltageSweep.points[0].tcas == current.tcas.value() );
+
+  // Lower Vdd slows the periphery, lower Vpp the wordlines and cells
+  BOOST_CHECK( voltageSweep.points[1].tcas > voltageSweep.points[0].tcas );
+  BOOST_CHECK( voltageSweep.points[1].trcd == voltageSweep.points[0].trcd );
+  BOOST_CHECK( voltageSweep.points[2].trcd > voltageSweep.points[0].trcd );
+  BOOST_CHECK( voltageSweep.points[2].tcas == voltageSweep.points[0].tcas );
+  BOOST_CHECK( voltageSweep.points[3].trc < voltageSweep.points[0].trc );
+  BOOST_CHECK( voltageSweep.points[1].readBitEnergy
+               < voltageSweep.points[0].readBitEnergy );
+}
+
+BOOST_AUTO_TEST_CASE( checkVoltageSweep_alpha_power_law )
+{
+  TechnologyValues techValues("technology_input/test_technology.json",
+                              "architecture_input/test_architecture.json");
+  techValues.referenceVdd = 1.2*si::volts;
+  techValues.vdd = 1.0*si::volts;
+  techValues.driverThresholdVoltage = 0.4*si::volts;
+  techValues.alphaPowerExponent = 1.3;
+  Current current(techValues, false);
+  double expectedFactor = 1.0 / pow(0.6, 1.3) * pow(0.8, 1.3) / 1.2;
+  BOOST_CHECK_CLOSE( current.vddDriverFactor, expectedFactor, 1e-9 );
+  BOOST_CHECK( current.vppDriverFactor == 1.0 );
+
+  // No transistor conducts at or below its threshold voltage
+  vector<double> vdds = {0.4};
+  vector<double> vpps = {techValues.vpp.value()};
+  string exceptionMsg("Empty");
+  try {
+      VoltageSweep voltageSweep(current, vdds, vpps);
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  BOOST_CHECK( exceptionMsg == "[ERROR] Vdd must be higher than the "
+                               "threshold voltage of its drivers!\n" );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // VOLTAGESWEEPTEST_CPP
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef WORKLOADPOWERTEST_CPP
+#define WORKLOADPOWERTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../workload/WorkloadPower.h"
+
+#include <cmath>
+#include <fstream>
+
+BOOST_AUTO_TEST_SUITE( testWorkloadPower )
+
+string readProfilesError(const string& fileName, const string& profiles)
+{
+  ofstream profileFile(fileName, ofstream::trunc);
+  profileFile << profiles;
+  profileFile.close();
+
+  string exceptionMsg("Empty");
+  try {
+      WorkloadProfiles workloadProfiles;
+      workloadProfiles.read(fileName);
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  remove(fileName.c_str());
+  return exceptionMsg;
+}
+
+BOOST_AUTO_TEST_CASE( checkWorkloadPower_real_input )
+{
+  string fileName("workload_power_test.csv");
+  ofstream profileFile(fileName, ofstream::trunc);
+  profileFile << "name, activations[1/us], read[GB/s], write[GB/s], "
+                 "rowhit, idle\n"
+                 "# Access patterns\n"
+                 "idle,0,0,0,0,1\n"
+                 "\n"
+                 "mixed,20,1.2,0.4,0.5,0.25\n";
+  profileFile.close();
+
+  WorkloadProfiles profiles;
+  profiles.read(fileName);
+  remove(fileName.c_str());
+
+  BOOST_CHECK( profiles.names.size() == 2 );
+  BOOST_CHECK( profiles.names[1] == "mixed" );
+  BOOST_CHECK_CLOSE( profiles.activationRates[1], 0.02, 1e-9 );
+  BOOST_CHECK_CLOSE( profiles.readBandwidths[1], 1.2, 1e-9 );
+  BOOST_CHECK_CLOSE( profiles.idleFractions[1], 0.25, 1e-9 );
+
+  Current current;
+  try {
+      current = Current("technology_input/test_technology.json",
+                        "architecture_input/test_architecture.json",
+                        false);
+  }catch (string exceptionMsgThrown){
+      BOOST_FAIL( exceptionMsgThrown );
+  }
+  WorkloadPower power(profiles, current, current);
+
+  double vdd = current.vdd.value();
+  double vpp = current.vpp.value();
+  double tck = 1000.0 / current.dramFreq.value();
+  double idd2n = current.IDD2n.value();
+  double idd3n = current.IDD3n.value();
+  double ipp3n = current.IPP3n.value();
+  double refreshPower = ( vdd * (current.IDD5b.value() - idd3n)
+                          + vpp * (current.IPP5b.value() - ipp3n) )
+                        * current.trfc_clk.value()
+                        / current.trefI_clk.value();
+
+  // An idle device only draws its precharge standby and refresh power
+  BOOST_CHECK_CLOSE( power.totalPower[0], vdd * idd2n + refreshPower, 1e-9 );
+  BOOST_CHECK( std::isnan(power.energyPerBit[0]) );
+
+  // which is left empty in the CSV file
+  power.write(fileName, profiles);
+  ifstream powerFile(fileName);
+  string header, idleLine;
+  getline(powerFile, header);
+  getline(powerFile, idleLine);
+  powerFile.close();
+  remove(fileName.c_str());
+  size_t powerEnd = idleLine.find(',', 5);
+  BOOST_CHECK( idleLine.compare(0, 5, "idle,") == 0 );
+  BOOST_CHECK( powerEnd != string::npos
+               && idleLine.compare(powerEnd, 2, ",,") == 0 );
+
+  double burstBytes = current.interface.value() * current.prefetch / 8;
+  double tburst = current.tccd_clk.value() * tck;
+  double readPower = 1.2 / burstBytes
+                     * vdd * (current.IDD4R.value() - idd3n) * tburst;
+  double openPower = vdd * (idd3n - idd2n) + vpp * ipp3n;
+  double openBanks = 1 + 0.5 * (current.nBanks - 1);
+  double backgroundPower = vdd * idd2n
+                           + 0.75 * openPower
+                             * ( current.rho
+                                 + (1 - current.rho) * openBanks
+                                   / current.nBanks );
+  BOOST_CHECK_CLOSE( power.readPower[1], readPower, 1e-9 );
+  BOOST_CHECK_CLOSE( power.backgroundPower[1], backgroundPower, 1e-9 );
+  BOOST_CHECK_CLOSE( power.totalPower[1],
+                     power.activatePower[1] + power.readPower[1]
+                     + power.writePower[1] + backgroundPower + refreshPower,
+                     1e-9 );
+  BOOST_CHECK_CLOSE( power.energyPerBit[1],
+                     power.totalPower[1] / (8 * 1.6), 1e-9 );
+  BOOST_CHECK_CLOSE( power.busUtilization[1], 1.6 / burstBytes * tburst,
+                     1e-9 );
+}
+
+BOOST_AUTO_TEST_CASE( checkWorkloadProfiles_bad_lines )
+{
+  string fileName("workload_power_test.csv");
+  string header("name,activations[1/us],read[GB/s],write[GB/s],rowhit,idle\n");
+  string expectedMsg;
+
+  expectedMsg = "[ERROR] Workload file workload_power_test.csv, line 1: "
+                "expected the header " + header.substr(0, header.size() - 1)
+                + "!\n";
+  BOOST_CHECK_EQUAL( readProfilesError(fileName, "a,1,1,1,0,0\n"),
+                     expectedMsg );
+
+  expectedMsg = "[ERROR] Workload file workload_power_test.csv, line 2: "
+                "invalid value -1!\n";
+  BOOST_CHECK_EQUAL( readProfilesError(fileName, header + "a,1,-1,1,0,0\n"),
+                     expectedMsg );
+
+  expectedMsg = "[ERROR] Workload file workload_power_test.csv, line 2: "
+                "row-hit ratio and idle fraction must be between 0 and 1!\n";
+  BOOST_CHECK_EQUAL( readProfilesError(fileName, header + "a,1,1,1,2,0\n"),
+                     expectedMsg );
+
+  expectedMsg = "[ERROR] Workload file workload_power_test.csv "
+                "has no profile!\n";
+  BOOST_CHECK_EQUAL( readProfilesError(fileName, header), expectedMsg );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // WORKLOADPOWERTEST_CPP
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#include "MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string& fileName)
+{
+    text = NULL;
+    length = 0;
+    isOpen = false;
+    isMapped = false;
+
+    int fileDescriptor = open(fileName.c_str(), O_RDONLY);
+    if ( fileDescriptor < 0 ) {
+        return;
+    }
+
+    struct stat fileStatus;
+    if ( fstat(fileDescriptor, &fileStatus) == 0
+         && S_ISREG(fileStatus.st_mode)
+         && fileStatus.st_size > 0 ) {
+        void* mapping = mmap(NULL, fileStatus.st_size, PROT_READ,
+                             MAP_PRIVATE, fileDescriptor, 0);
+        if ( mapping != MAP_FAILED ) {
+            // The file is parsed from beginning to end
+            madvise(mapping, fileStatus.st_size, MADV_SEQUENTIAL);
+            text = static_cast<const char*>(mapping);
+            length = fileStatus.st_size;
+            isOpen = true;
+            isMapped = true;
+            close(fileDescriptor);
+            return;
+        }
+    }
+
+    // Buffered fallback, also for files whose size is not known in advance
+    char chunk[65536];
+    ssize_t chunkLength;
+    while ( (chunkLength = read(fileDescriptor, chunk, sizeof(chunk))) > 0 ) {
+        buffer.append(chunk, chunkLength);
+    }
+    close(fileDescriptor);
+    if ( chunkLength < 0 ) {
+        return;
+    }
+    text = buffer.data();
+    length = buffer.size();
+    isOpen = true;
+}
+
+MappedFile::~MappedFile()
+{
+    if ( isMapped ) {
+        munmap(const_cast<char*>(text), length);
+    }
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+#include "MetricsServer.h"
+
+#include <cerrno>
+#include <cstring>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+MetricsServer::MetricsServer(unsigned int port,
+                             const std::function<std::string()>& metricsText)
+    : port(port), metricsText(metricsText)
+{
+    isStopped = false;
+    listeningSocket = socket(AF_INET, SOCK_STREAM, 0);
+
+    int reuseAddress = 1;
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if ( listeningSocket < 0
+         || setsockopt(listeningSocket, SOL_SOCKET, SO_REUSEADDR,
+                       &reuseAddress, sizeof(reuseAddress)) != 0
+         || bind(listeningSocket, (sockaddr*) &address, sizeof(address)) != 0
+         || listen(listeningSocket, 8) != 0 ) {
+        std::string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not serve metrics on port ");
+        exceptionMsgThrown.append(std::to_string(port));
+        exceptionMsgThrown.append(": ");
+        exceptionMsgThrown.append(strerror(errno));
+        exceptionMsgThrown.append("!\n");
+        if ( listeningSocket >= 0 ) {
+            close(listeningSocket);
+        }
+        throw exceptionMsgThrown;
+    }
+
+    socklen_t addressLength = sizeof(address);
+    if ( getsockname(listeningSocket, (sockaddr*) &address,
+                     &addressLength) == 0 ) {
+        this->port = ntohs(address.sin_port);
+    }
+
+    server = std::thread(&MetricsServer::serve, this);
+}
+
+MetricsServer::~MetricsServer()
+{
+    isStopped = true;
+    server.join();
+    close(listeningSocket);
+}
+
+void
+MetricsServer::serve()
+{
+    // Woken up regularly to notice that the server is stopped
+    pollfd listening;
+    listening.fd = listeningSocket;
+    listening.events = POLLIN;
+    while ( !isStopped ) {
+        if ( poll(&listening, 1, 200) <= 0 ) {
+            continue;
+        }
+        int connection = accept(listeningSocket, NULL, NULL);
+        if ( connection < 0 ) {
+            continue;
+        }
+        answer(connection);
+        close(connection);
+    }
+}
+
+void
+MetricsServer::answer(int connection)
+{
+    // Only the request line is needed. A client that sends nothing is
+    //  dropped after a second, so it does not block the others.
+    std::string request;
+    char buffer[1024];
+    pollfd client;
+    client.fd = connection;
+    client.events = POLLIN;
+    while ( request.find("\r\n") == std::string::npos
+            && request.size() < 8192 ) {
+        if ( poll(&client, 1, 1000) <= 0 ) {
+            return;
+        }
+        ssize_t nRead = recv(connection, buffer, sizeof(buffer), 0);
+        if ( nRead <= 0 ) {
+            return;
+        }
+        request.append(buffer, nRead);
+    }
+
+    std::string status;
+    std::string body;
+    if ( request.compare(0, 13, "GET /metrics ") == 0
+         || request.compare(0, 6, "GET / ") == 0 ) {
+        status = "200 OK";
+        body = metricsText();
+    }
+    else {
+        status = "404 Not Found";
+        body = "Only GET /metrics is served.\n";
+    }
+
+    std::string response("HTTP/1.0 ");
+    response.append(status);
+    response.append("\r\nContent-Type: text/plain; version=0.0.4\r\n");
+    response.append("Content-Length: ");
+    response.append(std::to_string(body.size()));
+    response.append("\r\nConnection: close\r\n\r\n");
+    response.append(body);
+
+    size_t nSent = 0;
+    while ( nSent < response.size() ) {
+        ssize_t nWritten = send(connection, response.data() + nSent,
+                                response.size() - nSent, MSG_NOSIGNAL);
+        if ( nWritten <= 0 ) {
+            return;
+        }
+        nSent += nWritten;
+    }
+}
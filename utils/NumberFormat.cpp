@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+#include "NumberFormat.h"
+
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+
+namespace {
+
+// Replaces the decimal point of the C locale, if it is not '.'
+size_t fixDecimalPoint(char* text, size_t length)
+{
+    const char* decimalPoint = localeconv()->decimal_point;
+    if ( decimalPoint == NULL
+         || (decimalPoint[0] == '.' && decimalPoint[1] == '\0') ) {
+        return length;
+    }
+    size_t pointLength = strlen(decimalPoint);
+    char* pointPosition = strstr(text, decimalPoint);
+    if ( pointLength == 0 || pointPosition == NULL ) {
+        return length;
+    }
+    *pointPosition = '.';
+    memmove(pointPosition + 1, pointPosition + pointLength,
+            length - (pointPosition - text) - pointLength + 1);
+    return length - pointLength + 1;
+}
+
+// Reads back a text written by formatNumber
+double readNumber(const char* text)
+{
+    const char* decimalPoint = localeconv()->decimal_point;
+    if ( decimalPoint == NULL
+         || (decimalPoint[0] == '.' && decimalPoint[1] == '\0')
+         || strchr(text, '.') == NULL ) {
+        return strtod(text, NULL);
+    }
+    char localText[NUMBER_BUFFER_SIZE + 8];
+    const char* pointPosition = strchr(text, '.');
+    size_t integerLength = pointPosition - text;
+    memcpy(localText, text, integerLength);
+    snprintf(localText + integerLength, sizeof(localText) - integerLength,
+             "%s%s", decimalPoint, pointPosition + 1);
+    return strtod(localText, NULL);
+}
+
+// Powers of ten that are exact doubles
+const double powersOfTen[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8,
+                              1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16,
+                              1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+// Most results are written with few digits and in fixed notation (as
+//  "%g" does when the exponent is at least -4 and below the precision).
+//  Those are written here directly from the scaled and rounded value.
+//  Returns 0 when the value is out of that range or too close to a
+//  rounding tie, for snprintf to decide.
+size_t formatFixedNumber(double value, char* text, int precision)
+{
+    if ( precision < 1 || precision > 9 || !(std::fabs(value) >= 1e-4)
+         || !(std::fabs(value) < powersOfTen[precision]) ) {
+        return 0;
+    }
+    double absValue = std::fabs(value);
+    int exponent = static_cast<int>(std::floor(std::log10(absValue)));
+    double scaled = 0;
+    // The first estimate of the exponent may be off by one
+    for ( int attempt = 0; attempt < 2; attempt++ ) {
+        int scale = precision - 1 - exponent;
+        scaled = scale >= 0 ? absValue * powersOfTen[scale]
+                            : absValue / powersOfTen[-scale];
+        if ( scaled < powersOfTen[precision - 1] ) {
+            exponent--;
+        }
+        else if ( scaled >= powersOfTen[precision] ) {
+            exponent++;
+        }
+        else {
+            break;
+        }
+    }
+    if ( !(scaled >= powersOfTen[precision - 1])
+         || !(scaled < powersOfTen[precision]) ) {
+        return 0;
+    }
+
+    // Scaling is exact within a few units of 1e-7, far below the margin
+    //  kept around ties
+    double integerPart = std::floor(scaled);
+    double fraction = scaled - integerPart;
+    if ( std::fabs(fraction - 0.5) < 1e-6 ) {
+        return 0;
+    }
+    uint64_t digits = static_cast<uint64_t>(integerPart) + (fraction > 0.5);
+    if ( digits == static_cast<uint64_t>(powersOfTen[precision]) ) {
+        digits /= 10;
+        exponent++;
+    }
+    if ( exponent >= precision ) {
+        return 0;
+    }
+
+    char digitText[16];
+    for ( int digitID = precision - 1; digitID >= 0; digitID-- ) {
+        digitText[digitID] = '0' + digits % 10;
+        digits /= 10;
+    }
+    // Trailing zeros of the fraction are not written
+    int nDigits = precision;
+    int nIntegerDigits = exponent >= 0 ? exponent + 1 : 0;
+    while ( nDigits > nIntegerDigits && nDigits > 1
+            && digitText[nDigits - 1] == '0' ) {
+        nDigits--;
+    }
+
+    size_t length = 0;
+    if ( value < 0 ) {
+        text[length++] = '-';
+    }
+    if ( exponent >= 0 ) {
+        for ( int digitID = 0; digitID < nDigits; digitID++ ) {
+            if ( digitID == nIntegerDigits ) {
+                text[length++] = '.';
+            }
+            text[length++] = digitText[digitID];
+        }
+        // Integer digits dropped as trailing zeros are written back
+        for ( int digitID = nDigits; digitID < nIntegerDigits; digitID++ ) {
+            text[length++] = '0';
+        }
+    }
+    else {
+        text[length++] = '0';
+        text[length++] = '.';
+        for ( int zeroID = 1; zeroID < -exponent; zeroID++ ) {
+            text[length++] = '0';
+        }
+        for ( int digitID = 0; digitID < nDigits; digitID++ ) {
+            text[length++] = digitText[digitID];
+        }
+    }
+    text[length] = '\0';
+    return length;
+}
+
+}
+
+size_t formatNumber(double value, char* text, int precision)
+{
+    size_t fixedLength = formatFixedNumber(value, text, precision);
+    if ( fixedLength > 0 ) {
+        return fixedLength;
+    }
+
+    int length = snprintf(text, NUMBER_BUFFER_SIZE, "%.*g", precision, value);
+    if ( length < 0 ) {
+        text[0] = '\0';
+        return 0;
+    }
+    return fixDecimalPoint(text, length);
+}
+
+size_t formatShortestNumber(double value, char* text)
+{
+    size_t length = 0;
+    for ( int precision = 15; precision <= 17; precision++ ) {
+        length = formatNumber(value, text, precision);
+        if ( precision == 17 || readNumber(text) == value ) {
+            break;
+        }
+    }
+    return length;
+}
+
+void appendNumber(std::string& str, double value, int precision)
+{
+    char text[NUMBER_BUFFER_SIZE];
+    size_t length = formatNumber(value, text, precision);
+    str.append(text, length);
+}
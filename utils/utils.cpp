@@ -64,3 +64,16 @@ double timeToPercentage(double percentage)
     //  The returned amount is given in terms of number of tau's.
     return -log(1.0 - percentage/100.0);
 }
+
+std::string hashString( const std::string& str )
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    for ( unsigned int it = 0; it < str.size(); it++ ) {
+        hash ^= (unsigned char) str[it];
+        hash *= 1099511628211ULL;
+    }
+
+    char hashText[17];
+    snprintf(hashText, sizeof(hashText), "%016llx", hash);
+    return std::string(hashText);
+}
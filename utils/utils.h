@@ -42,13 +42,21 @@
 #define UTILS_H
 
 #include <cmath>
+#include <string>
 
 #define INVALID_VALUE std::numeric_limits<double>::max()
 
+// Version of the DRAMSpec model. It must be changed whenever a modification
+//  alters the results, since it is part of the result cache keys.
+#define DRAMSPEC_VERSION "2.1.0"
+
 bool isInteger( double dn );
 bool isPowerOfTwo( double n );
 
 double timeToPercentage(double percentage);
+
+// 64-bit FNV-1a hash, given as a 16 digits hexadecimal string
+std::string hashString( const std::string& str );
 #define PRINT_VAR(varName) \
     do{std::cout << #varName " = " << varName << std::endl;} while(false)
 
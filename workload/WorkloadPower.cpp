@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+#include "WorkloadPower.h"
+#include "../utils/NumberFormat.h"
+
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+const char* profileHeader
+        = "name,activations[1/us],read[GB/s],write[GB/s],rowhit,idle";
+
+string trimmedField(const string& field)
+{
+    size_t first = field.find_first_not_of(" \t\r");
+    if ( first == string::npos ) {
+        return "";
+    }
+    size_t last = field.find_last_not_of(" \t\r");
+    return field.substr(first, last - first + 1);
+}
+
+void throwProfileError(const string& fileName,
+                       unsigned long lineNumber,
+                       const string& reason)
+{
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Workload file ");
+    exceptionMsgThrown.append(fileName);
+    exceptionMsgThrown.append(", line ");
+    exceptionMsgThrown.append(to_string(lineNumber));
+    exceptionMsgThrown.append(": ");
+    exceptionMsgThrown.append(reason);
+    exceptionMsgThrown.append("!\n");
+    throw exceptionMsgThrown;
+}
+
+// Line of a result table, the label padded like the DRAMSpec tables
+void appendReportLine(string& report, const string& label, double value,
+                      const string& profileName)
+{
+    report.append(label);
+    if ( label.size() < 30 ) {
+        report.append(30 - label.size(), ' ');
+    }
+    appendNumber(report, value);
+    if ( !profileName.empty() ) {
+        report.append(" (");
+        report.append(profileName);
+        report.push_back(')');
+    }
+    report.push_back('\n');
+}
+
+}
+
+void
+WorkloadProfiles::read(const string& profileFileName)
+{
+    fileName = profileFileName;
+    ifstream profileFile(fileName);
+    if ( profileFile.is_open() == false ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not read workload file: ");
+        exceptionMsgThrown.append(fileName);
+        exceptionMsgThrown.append("!\n");
+        throw exceptionMsgThrown;
+    }
+
+    string line;
+    unsigned long lineNumber = 0;
+    bool hasHeader = false;
+    while ( getline(profileFile, line) ) {
+        lineNumber++;
+        line = trimmedField(line);
+        if ( line.empty() || line[0] == '#' ) {
+            continue;
+        }
+
+        vector<string> fields;
+        stringstream lineStream(line);
+        string field;
+        while ( getline(lineStream, field, ',') ) {
+            fields.push_back(trimmedField(field));
+        }
+
+        if ( !hasHeader ) {
+            string header;
+            for ( const string& headerField : fields ) {
+                header.append(header.empty() ? "" : ",");
+                header.append(headerField);
+            }
+            if ( header != profileHeader ) {
+                throwProfileError(fileName, lineNumber,
+                                  string("expected the header ")
+                                  + profileHeader);
+            }
+            hasHeader = true;
+            continue;
+        }
+
+        if ( fields.size() != 6 || fields[0].empty() ) {
+            throwProfileError(fileName, lineNumber,
+                              "expected a name and 5 statistics");
+        }
+        double values[5];
+        for ( int valueID = 0; valueID < 5; valueID++ ) {
+            const char* text = fields[valueID + 1].c_str();
+            char* textEnd;
+            values[valueID] = strtod(text, &textEnd);
+            if ( textEnd == text || *textEnd != '\0'
+                 || !(values[valueID] >= 0) ) {
+                throwProfileError(fileName, lineNumber,
+                                  "invalid value " + fields[valueID + 1]);
+            }
+        }
+        if ( values[3] > 1 || values[4] > 1 ) {
+            throwProfileError(fileName, lineNumber,
+                              "row-hit ratio and idle fraction must be "
+                              "between 0 and 1");
+        }
+        names.push_back(fields[0]);
+        activationRates.push_back(values[0] / 1e3);
+        readBandwidths.push_back(values[1]);
+        writeBandwidths.push_back(values[2]);
+        rowHitRatios.push_back(values[3]);
+        idleFractions.push_back(values[4]);
+        double bits = 8 * (values[1] + values[2]);
+        bitTimes.push_back(bits > 0 ? 1 / bits
+                                    : numeric_limits<double>::quiet_NaN());
+    }
+    if ( names.empty() ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Workload file ");
+        exceptionMsgThrown.append(fileName);
+        exceptionMsgThrown.append(" has no profile!\n");
+        throw exceptionMsgThrown;
+    }
+}
+
+WorkloadEnergies::WorkloadEnergies(const Current& dram,
+                                   const TechnologyValues& technologyValues)
+{
+    // Only the results are used, since results loaded from the cache have
+    //  no intermediate values. Currents in mA, times in ns and voltages
+    //  in V give energies in pJ and powers in mW.
+    double vdd = technologyValues.vdd.value();
+    double vpp = technologyValues.vpp.value();
+    double nBanks = technologyValues.nBanks;
+    double burstBytes = technologyValues.interface.value()
+                        * technologyValues.prefetch / 8;
+    double tck = 1000.0 / dram.dramFreq.value();
+    double trc = dram.trc_clk.value() * tck;
+    double tras = dram.tras_clk.value() * tck;
+    double trfc = dram.trfc_clk.value() * tck;
+    double tburst = dram.tccd_clk.value() * tck;
+    double idd2n = dram.IDD2n.value();
+    double idd3n = dram.IDD3n.value();
+    double ipp3n = dram.IPP3n.value();
+
+    activateEnergy = vdd * ( dram.IDD0.value() * trc
+                             - idd3n * tras
+                             - idd2n * (trc - tras) )
+                     + vpp * (dram.IPP0.value() - ipp3n) * trc;
+    readBurstEnergy = vdd * (dram.IDD4R.value() - idd3n) * tburst;
+    writeBurstEnergy = vdd * (dram.IDD4W.value() - idd3n) * tburst;
+    double refreshCommandPower = vdd * (dram.IDD5b.value() - idd3n)
+                                 + vpp * (dram.IPP5b.value() - ipp3n);
+    refreshEnergy = refreshCommandPower * trfc;
+    readByteEnergy = readBurstEnergy / burstBytes;
+    writeByteEnergy = writeBurstEnergy / burstBytes;
+
+    double openPower = vdd * (idd3n - idd2n) + vpp * ipp3n;
+    idlePower = vdd * idd2n;
+    sharedOpenPower = dram.rho * openPower;
+    openBankPower = (1.0 - dram.rho) * openPower / nBanks;
+    activeBackgroundPower = sharedOpenPower + openBankPower;
+    openBanksPower = openBankPower * (nBanks - 1);
+    refreshPower = refreshCommandPower
+                   * dram.trfc_clk.value() / dram.trefI_clk.value();
+    busTimePerByte = tburst / burstBytes;
+}
+
+double
+WorkloadEnergies::totalPower(const WorkloadProfiles& profiles,
+                             size_t profileID) const
+{
+    return profiles.activationRates[profileID] * activateEnergy
+           + profiles.readBandwidths[profileID] * readByteEnergy
+           + profiles.writeBandwidths[profileID] * writeByteEnergy
+           + idlePower
+           + ( 1.0 - profiles.idleFractions[profileID] )
+             * ( activeBackgroundPower
+                 + profiles.rowHitRatios[profileID] * openBanksPower )
+           + refreshPower;
+}
+
+WorkloadPower::WorkloadPower(const WorkloadProfiles& profiles,
+                             const Current& dram,
+                             const TechnologyValues& technologyValues)
+{
+    // Local copies, which the loop below keeps in registers
+    WorkloadEnergies energies(dram, technologyValues);
+    double activateEnergy = energies.activateEnergy;
+    double readByteEnergy = energies.readByteEnergy;
+    double writeByteEnergy = energies.writeByteEnergy;
+    double idlePower = energies.idlePower;
+    double activeBackgroundPower = energies.activeBackgroundPower;
+    double openBanksPower = energies.openBanksPower;
+    refreshPower = energies.refreshPower;
+    double busTimePerByte = energies.busTimePerByte;
+
+    size_t nProfiles = profiles.names.size();
+    activatePower.resize(nProfiles);
+    readPower.resize(nProfiles);
+    writePower.resize(nProfiles);
+    backgroundPower.resize(nProfiles);
+    totalPower.resize(nProfiles);
+    energyPerBit.resize(nProfiles);
+    busUtilization.resize(nProfiles);
+
+    // A single pass of straight-line arithmetic over the arrays of the
+    //  profiles, without comparisons, which the compiler vectorizes. The
+    //  arrays are distinct, which spares the checks of their overlap.
+    const double* activationRates = profiles.activationRates.data();
+    const double* readBandwidths = profiles.readBandwidths.data();
+    const double* writeBandwidths = profiles.writeBandwidths.data();
+    const double* rowHitRatios = profiles.rowHitRatios.data();
+    const double* idleFractions = profiles.idleFractions.data();
+    const double* bitTimes = profiles.bitTimes.data();
+    double* activatePowers = activatePower.data();
+    double* readPowers = readPower.data();
+    double* writePowers = writePower.data();
+    double* backgroundPowers = backgroundPower.data();
+    double* totalPowers = totalPower.data();
+    double* energiesPerBit = energyPerBit.data();
+    double* busUtilizations = busUtilization.data();
+    double profileRefreshPower = refreshPower;
+#pragma GCC ivdep
+    for ( size_t profileID = 0; profileID < nProfiles; profileID++ ) {
+        double activate = activationRates[profileID] * activateEnergy;
+        double read = readBandwidths[profileID] * readByteEnergy;
+        double write = writeBandwidths[profileID] * writeByteEnergy;
+        double background = idlePower
+                            + ( 1.0 - idleFractions[profileID] )
+                              * ( activeBackgroundPower
+                                  + rowHitRatios[profileID]
+                                    * openBanksPower );
+        double total = activate + read + write + background
+                       + profileRefreshPower;
+        activatePowers[profileID] = activate;
+        readPowers[profileID] = read;
+        writePowers[profileID] = write;
+        backgroundPowers[profileID] = background;
+        totalPowers[profileID] = total;
+        energiesPerBit[profileID] = total * bitTimes[profileID];
+        busUtilizations[profileID] = ( readBandwidths[profileID]
+                                       + writeBandwidths[profileID] )
+                                     * busTimePerByte;
+    }
+}
+
+void
+WorkloadPower::write(const string& powerFileName,
+                     const WorkloadProfiles& profiles) const
+{
+    string lines("name,power[mW],energy_per_bit[pJ],bus_utilization,"
+                 "activate[mW],read[mW],write[mW],background[mW],"
+                 "refresh[mW]\n");
+    for ( size_t profileID = 0; profileID < totalPower.size(); profileID++ ) {
+        lines.append(profiles.names[profileID]);
+        const double values[8] = {
+            totalPower[profileID], energyPerBit[profileID],
+            busUtilization[profileID], activatePower[profileID],
+            readPower[profileID], writePower[profileID],
+            backgroundPower[profileID], refreshPower
+        };
+        for ( double value : values ) {
+            lines.push_back(',');
+            // The energy per bit of a profile without any access
+            if ( !std::isnan(value) ) {
+                appendNumber(lines, value);
+            }
+        }
+        lines.push_back('\n');
+    }
+    ofstream powerFile(powerFileName, ofstream::trunc);
+    powerFile << lines;
+}
+
+void
+WorkloadPower::appendReport(string& report,
+                            const WorkloadProfiles& profiles) const
+{
+    size_t lowestID = 0;
+    size_t highestID = 0;
+    double sumPower = 0;
+    for ( size_t profileID = 0; profileID < totalPower.size(); profileID++ ) {
+        lowestID = ( totalPower[profileID] < totalPower[lowestID]
+                     ? profileID : lowestID );
+        highestID = ( totalPower[profileID] > totalPower[highestID]
+                      ? profileID : highestID );
+        sumPower += totalPower[profileID];
+    }
+
+    report.append("Workload power of ");
+    report.append(profiles.fileName);
+    report.append(" (");
+    report.append(to_string(totalPower.size()));
+    report.append(" profiles)\n");
+    appendReportLine(report, "Lowest power         [mW]",
+                     totalPower[lowestID], profiles.names[lowestID]);
+    appendReportLine(report, "Mean power           [mW]",
+                     sumPower / totalPower.size(), "");
+    appendReportLine(report, "Highest power        [mW]",
+                     totalPower[highestID], profiles.names[highestID]);
+    appendReportLine(report, "Refresh power        [mW]", refreshPower, "");
+}
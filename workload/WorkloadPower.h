@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+
+// Power of workloads known only by the statistics of their accesses, from
+//  the currents and timings computed by DRAMSpec. A profile holds:
+//  - the activation rate (ACT per us)
+//  - the read and write bandwidths (GB/s)
+//  - the row-hit ratio (accesses to a row already open, from 0 to 1)
+//  - the idle fraction (time with all banks precharged, from 0 to 1)
+// The profiles are read once for a run, and all of them are evaluated for
+//  every configuration in one pass over arrays of each statistic, which the
+//  compiler vectorizes. The power of a profile is (mW, i.e. pJ/ns):
+//  - ACT: activation rate * Vdd (IDD0 tRC - IDD3N tRAS - IDD2N (tRC - tRAS))
+//    + Vpp (IPP0 - IPP3N) tRC
+//  - RD, WR: bursts per ns * Vdd (IDD4R/W - IDD3N) tCCD, with bursts of
+//    the prefetch times the interface width
+//  - REF: (Vdd (IDD5B - IDD3N) + Vpp (IPP5B - IPP3N)) tRFC / tREFI
+//  - background: Vdd IDD2N, plus Vdd (IDD3N - IDD2N) + Vpp IPP3N while not
+//    idle, split with rho into a part shared by all banks and a part of
+//    each open bank. With a row-hit ratio h, 1 + h (banks - 1) banks are
+//    taken as open: a single one for a closed-page workload (h = 0), all
+//    of them when every row is kept open for its hits (h = 1).
+#ifndef WORKLOADPOWER_H
+#define WORKLOADPOWER_H
+
+#include "../core/Current.h"
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Profiles of a CSV file with the header line
+//  name,activations[1/us],read[GB/s],write[GB/s],rowhit,idle
+//  and one profile per line. Empty lines and lines starting with '#' are
+//  skipped.
+class WorkloadProfiles
+{
+  public:
+    // Throws if the file cannot be read or a profile is invalid
+    void read(const string& profileFileName);
+
+    string fileName;
+    vector<string> names;
+    // Statistics of every profile, in ACT per ns, bytes per ns (GB/s) and
+    //  fractions
+    vector<double> activationRates;
+    vector<double> readBandwidths;
+    vector<double> writeBandwidths;
+    vector<double> rowHitRatios;
+    vector<double> idleFractions;
+    // Time per bit read or written in ns (NaN without any access), which
+    //  does not depend on the device
+    vector<double> bitTimes;
+};
+
+// Energies and powers of a device that the power of a profile is made of
+//  (pJ and mW), with the formulas above. The energy of a command trace
+//  (TraceEnergy) is made of the same energies per command.
+class WorkloadEnergies
+{
+  public:
+    WorkloadEnergies(const Current& dram,
+                     const TechnologyValues& technologyValues);
+
+    // Total power of a single profile in mW
+    double totalPower(const WorkloadProfiles& profiles,
+                      size_t profileID) const;
+
+    // Energies of an ACT (with its PRE), of a burst read or written, and
+    //  of an all-bank REF
+    double activateEnergy;
+    double readBurstEnergy;
+    double writeBurstEnergy;
+    double refreshEnergy;
+    // Energies of a byte read or written
+    double readByteEnergy;
+    double writeByteEnergy;
+    // Background with all banks precharged, of the resources shared by
+    //  open banks, and of each open bank
+    double idlePower;
+    double sharedOpenPower;
+    double openBankPower;
+    // Background while not idle (with a single bank open), and of the open
+    //  banks but one, per row-hit ratio
+    double activeBackgroundPower;
+    double openBanksPower;
+    double refreshPower;
+    double busTimePerByte;
+};
+
+class WorkloadPower
+{
+  public:
+    WorkloadPower(const WorkloadProfiles& profiles,
+                  const Current& dram,
+                  const TechnologyValues& technologyValues);
+
+    // Writes the power of every profile to a CSV file
+    void write(const string& powerFileName,
+               const WorkloadProfiles& profiles) const;
+    // Appends the lowest, mean and highest power as lines of a result table
+    void appendReport(string& report, const WorkloadProfiles& profiles) const;
+
+    // Power of every profile in mW
+    vector<double> activatePower;
+    vector<double> readPower;
+    vector<double> writePower;
+    vector<double> backgroundPower;
+    vector<double> totalPower;
+    // Energy per bit read or written in pJ (NaN without any access, and
+    //  left empty in the CSV file)
+    vector<double> energyPerBit;
+    // Share of the column command slots used by the bursts, above 1 when
+    //  the device cannot sustain the bandwidth of the profile
+    vector<double> busUtilization;
+    // The same for every profile
+    double refreshPower;
+};
+
+#endif // WORKLOADPOWER_H